@@ -0,0 +1,32 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/geojson_polygons.hpp>
+
+using namespace mbgl;
+using namespace mbgl::benchmark;
+
+// Renders the camera grid as a batch, and reads back each image while the next one is rendered.
+// With ViewportMode::FlippedY, the images don't need to be flipped after reading them.
+static void API_renderStillsGridAsyncRead(::benchmark::State& state) {
+    GeoJSONPolygons bench({ 1000, 1000 }, state.range_x() ? ViewportMode::FlippedY : ViewportMode::Default);
+    const std::vector<CameraOptions> cameras = generateCameraGrid();
+
+    while (state.KeepRunning()) {
+        bool done = false;
+        bench.map.renderStills(bench.view, cameras, [&](std::size_t index, std::exception_ptr, Duration) {
+            bench.view.startStillImageRead();
+            if (index > 0) {
+                ::benchmark::DoNotOptimize(bench.view.finishStillImageRead());
+            }
+            done = index + 1 == cameras.size();
+        });
+
+        while (!done) {
+            util::RunLoop::Get()->runOnce();
+        }
+
+        ::benchmark::DoNotOptimize(bench.view.finishStillImageRead());
+    }
+}
+
+BENCHMARK(API_renderStillsGridAsyncRead)->Arg(0)->Arg(1);
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class BufferBenchmark {
+public:
+    explicit BufferBenchmark(bool arena) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+
+        backend.getContext().disableBufferArena = !arena;
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+    }
+
+    void render() {
+        map.getStyle().loadJSON(style);
+        mbgl::benchmark::render(map, view);
+    }
+
+    util::RunLoop loop;
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool { 4 };
+    Map map { backend, view.getSize(), 1, fileSource, threadPool, MapMode::Still };
+    const std::string style = util::read_file("benchmark/fixtures/api/query_style.json");
+};
+
+} // end namespace
+
+static void API_renderBuffers(::benchmark::State& state) {
+    BufferBenchmark bench(state.range_x());
+
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        mbgl::benchmark::discardTiles(bench.map, bench.view);
+        state.ResumeTiming();
+        bench.render();
+    }
+
+    const auto& statistics = bench.backend.getContext().statistics;
+    state.SetLabel(util::toString(statistics.buffers) + " buffers, " +
+                   util::toString(statistics.bufferBytes / 1024) + " KiB");
+}
+
+BENCHMARK(API_renderBuffers)->Arg(0)->Arg(1);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class DrawSortingBenchmark {
+public:
+    explicit DrawSortingBenchmark(bool sorting) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+
+        backend.getContext().disableDrawSorting = !sorting;
+
+        map.getStyle().loadJSON(util::read_file("benchmark/fixtures/api/query_style.json"));
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+
+        // Loads the tiles, so that only rendering is measured.
+        render();
+    }
+
+    void render() {
+        map.setBearing(map.getBearing() + 1);
+        mbgl::benchmark::render(map, view);
+    }
+
+    util::RunLoop loop;
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool { 4 };
+    Map map { backend, view.getSize(), 1, fileSource, threadPool, MapMode::Still };
+};
+
+} // end namespace
+
+static void API_renderDrawSorting(::benchmark::State& state) {
+    DrawSortingBenchmark bench(state.range_x());
+    auto& statistics = bench.backend.getContext().statistics;
+    statistics = {};
+
+    std::size_t frames = 0;
+    while (state.KeepRunning()) {
+        bench.render();
+        frames++;
+    }
+
+    if (frames) {
+        state.SetLabel(util::toString(statistics.drawCalls / frames) + " draws, " +
+                       util::toString(statistics.stateChanges / frames) + " state changes per frame");
+    }
+}
+
+BENCHMARK(API_renderDrawSorting)->Arg(0)->Arg(1);
@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/geojson_polygons.hpp>
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/style/sources/geojson_source.hpp>
+
+using namespace mbgl;
+using namespace mbgl::benchmark;
+
+static void API_renderGeoJSONPan(::benchmark::State& state) {
+    GeoJSONPolygons bench;
+
+    // Pan back and forth across the data, so that both newly generated and previously
+    // generated tiles are rendered.
+    int step = 0;
+    while (state.KeepRunning()) {
+        const double offset = (step++ % 20) * 0.01;
+        bench.map.setLatLngZoom({ 40.72 + offset / 2, -73.99 + offset }, 15);
+        render(bench.map, bench.view);
+    }
+}
+
+// Moves a single polygon of the grid, replacing the entire data of the source.
+static void API_renderGeoJSONSetData(::benchmark::State& state) {
+    GeoJSONPolygons bench;
+    FeatureCollection features = generatePolygonGrid();
+
+    int step = 0;
+    while (state.KeepRunning()) {
+        features[0] = generatePolygon(0, -73.99 + (step++ % 2) * 0.0001, 40.72);
+        bench.source->setGeoJSON(features);
+        render(bench.map, bench.view);
+    }
+}
+
+// Moves a single polygon of the grid with an incremental update.
+static void API_renderGeoJSONUpdateFeatures(::benchmark::State& state) {
+    GeoJSONPolygons bench;
+
+    int step = 0;
+    while (state.KeepRunning()) {
+        bench.source->updateFeatures({ generatePolygon(0, -73.99 + (step++ % 2) * 0.0001, 40.72) });
+        render(bench.map, bench.view);
+    }
+}
+
+BENCHMARK(API_renderGeoJSONPan);
+BENCHMARK(API_renderGeoJSONSetData);
+BENCHMARK(API_renderGeoJSONUpdateFeatures);
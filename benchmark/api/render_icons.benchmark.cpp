@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class IconBenchmark {
+public:
+    IconBenchmark() {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+    }
+
+    void render() {
+        map.getStyle().loadJSON(style);
+        mbgl::benchmark::render(map, view);
+    }
+
+    util::RunLoop loop;
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool { 4 };
+    Map map { backend, view.getSize(), 1, fileSource, threadPool, MapMode::Still };
+    const std::string style = util::read_file("benchmark/fixtures/api/query_style.json");
+};
+
+} // end namespace
+
+// Lays out, places and draws the POI, shield and place icons of a streets style. Icons share one
+// atlas texture, so the number of textures doesn't grow with the number of tiles.
+static void API_renderIcons(::benchmark::State& state) {
+    IconBenchmark bench;
+
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        mbgl::benchmark::discardTiles(bench.map, bench.view);
+        state.ResumeTiming();
+        bench.render();
+    }
+
+    const auto& statistics = bench.backend.getContext().statistics;
+    state.SetLabel(util::toString(statistics.textures) + " textures, " +
+                   util::toString(statistics.textureBytesUploaded / state.iterations() / 1024) +
+                   " KiB textures uploaded per frame");
+}
+
+BENCHMARK(API_renderIcons);
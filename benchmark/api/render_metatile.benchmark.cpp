@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/geojson_polygons.hpp>
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/metatile.hpp>
+#include <mbgl/util/image.hpp>
+
+using namespace mbgl;
+using namespace mbgl::benchmark;
+
+// Renders a 4x4 block of 256 pixel tiles one tile at a time.
+static void API_renderTiles(::benchmark::State& state) {
+    GeoJSONPolygons bench({ 256, 256 });
+
+    while (state.KeepRunning()) {
+        for (uint32_t x = 0; x < 4; x++) {
+            for (uint32_t y = 0; y < 4; y++) {
+                bench.map.jumpTo(Metatile(17, 38598 + x, 49276 + y, 1).getCamera());
+                ::benchmark::DoNotOptimize(encodePNG(render(bench.map, bench.view)));
+            }
+        }
+    }
+}
+
+// Renders the same block of tiles as a single metatile.
+static void API_renderMetatile(::benchmark::State& state) {
+    const Metatile metatile(17, 38598, 49276, 4, 64);
+    GeoJSONPolygons bench(metatile.getSize());
+
+    while (state.KeepRunning()) {
+        bench.map.jumpTo(metatile.getCamera());
+        for (const auto& tile : metatile.slice(render(bench.map, bench.view))) {
+            ::benchmark::DoNotOptimize(encodePNG(tile.image));
+        }
+    }
+}
+
+BENCHMARK(API_renderTiles);
+BENCHMARK(API_renderMetatile);
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+class PaintUpdateBenchmark {
+public:
+    PaintUpdateBenchmark() {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+
+        map.getStyle().loadJSON(util::read_file("benchmark/fixtures/api/data_driven_style.json"));
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+        mbgl::benchmark::render(map, view);
+    }
+
+    FillLayer& building() {
+        return *map.getStyle().getLayer("building")->as<FillLayer>();
+    }
+
+    util::RunLoop loop;
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool { 4 };
+    Map map { backend, view.getSize(), 1, fileSource, threadPool, MapMode::Still };
+};
+
+} // end namespace
+
+// The time from changing a property of a loaded map until the next frame is rendered. Changing a
+// data-driven paint property only evaluates the property again, while changing the filter lays
+// the tiles out again.
+static void API_renderPaintUpdate(::benchmark::State& state) {
+    PaintUpdateBenchmark bench;
+    const bool filter = state.range_x();
+    bool toggle = false;
+
+    while (state.KeepRunning()) {
+        toggle = !toggle;
+        if (filter) {
+            bench.building().setFilter(toggle
+                ? Filter(HasFilter { "type" })
+                : Filter(NotHasFilter { "type" }));
+        } else {
+            bench.building().setFillColor(SourceFunction<Color>("type", CategoricalStops<Color>({
+                { std::string("apartments"), toggle ? Color::red() : Color::blue() },
+                { std::string("house"), toggle ? Color::green() : Color::black() }
+            }), Color::white()));
+        }
+        mbgl::benchmark::render(bench.map, bench.view);
+    }
+
+    state.SetLabel(filter ? "filter" : "data-driven paint");
+}
+
+BENCHMARK(API_renderPaintUpdate)->Arg(0)->Arg(1);
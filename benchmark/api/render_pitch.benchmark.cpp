@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/rendering_stats.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class StatsBackend : public HeadlessBackend {
+public:
+    void onDidFinishRenderingFrameStats(const RenderingStats& stats_) final {
+        stats = stats_;
+    }
+
+    RenderingStats stats;
+};
+
+// Loads and renders a pitched view. Pitched views use lower zoom levels for the tiles in the
+// distance, so fewer tiles are loaded.
+class PitchBenchmark {
+public:
+    explicit PitchBenchmark(double pitch_) : pitch(pitch_) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+    }
+
+    void render() {
+        map.getStyle().loadJSON(style);
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+        map.setPitch(pitch);
+
+        bool done = false;
+        map.renderStill(view, [&](std::exception_ptr) {
+            done = true;
+        });
+        while (!done) {
+            util::RunLoop::Get()->runOnce();
+        }
+    }
+
+    const double pitch;
+    util::RunLoop loop;
+    StatsBackend backend;
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool { 4 };
+    Map map { backend, view.getSize(), 1, fileSource, threadPool, MapMode::Still };
+    const std::string style = util::read_file("benchmark/fixtures/api/query_style.json");
+};
+
+} // end namespace
+
+static void API_renderPitch(::benchmark::State& state) {
+    PitchBenchmark bench(state.range_x());
+
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        mbgl::benchmark::discardTiles(bench.map, bench.view);
+        state.ResumeTiming();
+        bench.render();
+    }
+
+    state.SetLabel(util::toString(bench.backend.stats.tiles.renderable) + " tiles");
+}
+
+BENCHMARK(API_renderPitch)->Arg(0)->Arg(30)->Arg(45)->Arg(60);
@@ -0,0 +1,168 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/rendering_stats.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+#include <mbgl/util/timer.hpp>
+
+#include <functional>
+
+using namespace mbgl;
+
+namespace {
+
+// Delays every request, like a tile server that is far away.
+class DelayedFileSource : public FileSource {
+public:
+    DelayedFileSource(FileSource& source_, Duration delay_)
+        : source(source_), delay(delay_) {
+    }
+
+    std::unique_ptr<AsyncRequest> request(const Resource& resource, Callback callback) override {
+        auto req = std::make_unique<DelayedRequest>();
+        DelayedRequest* raw = req.get();
+        raw->timer.start(delay, Duration::zero(), [this, raw, resource, callback] {
+            raw->request = source.request(resource, callback);
+        });
+        return std::move(req);
+    }
+
+    bool supportsOptionalRequests() const override {
+        return source.supportsOptionalRequests();
+    }
+
+private:
+    class DelayedRequest : public AsyncRequest {
+    public:
+        util::Timer timer;
+        std::unique_ptr<AsyncRequest> request;
+    };
+
+    FileSource& source;
+    const Duration delay;
+};
+
+class FlightBackend : public HeadlessBackend {
+public:
+    void invalidate() final {
+        dirty = true;
+    }
+
+    void onCameraDidChange(CameraChangeMode mode) final {
+        if (mode == CameraChangeMode::Animated) {
+            arrival = Clock::now();
+        }
+    }
+
+    void onDidFinishRenderingFrameStats(const RenderingStats& stats) final {
+        frames++;
+        if (stats.tiles.loading) {
+            loadingFrames++;
+        }
+    }
+
+    bool dirty = false;
+    TimePoint arrival;
+    std::size_t frames = 0;
+    std::size_t loadingFrames = 0;
+};
+
+// Flies across Manhattan in continuous mode, with tiles that take 100 ms to arrive.
+class FlightBenchmark {
+public:
+    explicit FlightBenchmark(bool prefetch) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        localFileSource.setAccessToken("foobar");
+
+        if (!prefetch) {
+            map.setPrefetchZoomDelta(0);
+            map.setPrefetchTileBudget(0);
+        }
+    }
+
+    // Returns the time from the end of the flight until all tiles at the destination are loaded.
+    Duration fly() {
+        mbgl::benchmark::discardTiles(map, view, MapMode::Continuous);
+        map.getStyle().loadJSON(style);
+        map.jumpTo(start);
+        run([&] { return map.isFullyLoaded(); });
+
+        backend.arrival = {};
+        backend.frames = 0;
+        backend.loadingFrames = 0;
+
+        map.flyTo(destination, AnimationOptions(Seconds(2)));
+        run([&] { return backend.arrival != TimePoint() && map.isFullyLoaded(); });
+
+        return Clock::now() - backend.arrival;
+    }
+
+    void run(std::function<bool()> done) {
+        while (!done()) {
+            if (backend.dirty) {
+                backend.dirty = false;
+                map.render(view);
+            }
+            if (!done()) {
+                util::RunLoop::Get()->runOnce();
+            }
+        }
+    }
+
+    util::RunLoop loop;
+    FlightBackend backend;
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource localFileSource { "benchmark/fixtures/api/cache.db", "." };
+    DelayedFileSource delayedFileSource { localFileSource, Milliseconds(100) };
+    ThreadPool threadPool { 4 };
+    Map map { backend, view.getSize(), 1, delayedFileSource, threadPool, MapMode::Continuous };
+    const std::string style = util::read_file("benchmark/fixtures/api/query_style.json");
+
+    const CameraOptions start = [] {
+        CameraOptions camera;
+        camera.center = LatLng { 40.726989, -73.992857 };
+        camera.zoom = 15.0;
+        return camera;
+    }();
+    const CameraOptions destination = [] {
+        CameraOptions camera;
+        camera.center = LatLng { 40.706, -74.009 };
+        camera.zoom = 15.0;
+        return camera;
+    }();
+};
+
+} // end namespace
+
+static void API_renderPrefetch(::benchmark::State& state) {
+    FlightBenchmark bench(state.range_x());
+
+    Duration waiting = Duration::zero();
+    std::size_t frames = 0;
+    std::size_t loadingFrames = 0;
+    std::size_t flights = 0;
+    while (state.KeepRunning()) {
+        waiting += bench.fly();
+        frames += bench.backend.frames;
+        loadingFrames += bench.backend.loadingFrames;
+        flights++;
+    }
+
+    if (flights) {
+        state.SetLabel(util::toString(std::chrono::duration_cast<Milliseconds>(waiting).count() / int64_t(flights)) +
+                       " ms loading after arrival, " + util::toString(loadingFrames) + " of " +
+                       util::toString(frames) + " frames with loading tiles");
+    }
+}
+
+BENCHMARK(API_renderPrefetch)->Arg(0)->Arg(1);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+class MapInstance {
+public:
+    MapInstance(FileSource& fileSource, Scheduler& scheduler)
+        : map(backend, view.getSize(), 1, fileSource, scheduler, MapMode::Still) {
+    }
+
+    // Maps activate their backend while rendering, so there's no scope for each of them here.
+    HeadlessBackend backend;
+    OffscreenView view{ backend.getContext(), { 1000, 1000 } };
+    Map map;
+};
+
+// Renders the same view with several Maps that share one worker pool, like a render server does.
+class SharedRenderBenchmark {
+public:
+    explicit SharedRenderBenchmark(std::size_t count) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+
+        for (std::size_t i = 0; i < count; i++) {
+            maps.push_back(std::make_unique<MapInstance>(fileSource, threadPool));
+        }
+    }
+
+    void render() {
+        std::size_t remaining = maps.size();
+        for (auto& instance : maps) {
+            instance->map.getStyle().loadJSON(style);
+            instance->map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+            instance->map.renderStill(instance->view, [&](std::exception_ptr) {
+                remaining--;
+            });
+        }
+
+        while (remaining) {
+            util::RunLoop::Get()->runOnce();
+        }
+    }
+
+    util::RunLoop loop;
+    DefaultFileSource fileSource{ "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool{ 4 };
+    const std::string style = util::read_file("benchmark/fixtures/api/query_style.json");
+    std::vector<std::unique_ptr<MapInstance>> maps;
+};
+
+} // end namespace
+
+static void API_renderShared(::benchmark::State& state) {
+    SharedRenderBenchmark bench(state.range_x());
+
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        for (auto& instance : bench.maps) {
+            mbgl::benchmark::discardTiles(instance->map, instance->view);
+        }
+        state.ResumeTiming();
+        bench.render();
+    }
+
+    const auto stats = TileDataCache::get(bench.threadPool)->getStats();
+    state.SetLabel("hit rate " + util::toString(stats.hitRate()) +
+                   ", " + util::toString(stats.bytes / 1024) + " KiB");
+}
+
+BENCHMARK(API_renderShared)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
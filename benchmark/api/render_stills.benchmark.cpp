@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/geojson_polygons.hpp>
+#include <mbgl/benchmark/util.hpp>
+
+using namespace mbgl;
+using namespace mbgl::benchmark;
+
+// Renders the camera grid one image at a time.
+static void API_renderStillGrid(::benchmark::State& state) {
+    GeoJSONPolygons bench;
+    const std::vector<CameraOptions> cameras = generateCameraGrid();
+
+    while (state.KeepRunning()) {
+        for (const auto& camera : cameras) {
+            bench.map.jumpTo(camera);
+            render(bench.map, bench.view);
+        }
+    }
+}
+
+// Renders the camera grid as a batch, which loads the tiles of the next image while reading back
+// the current one.
+static void API_renderStillsGrid(::benchmark::State& state) {
+    GeoJSONPolygons bench;
+    const std::vector<CameraOptions> cameras = generateCameraGrid();
+
+    while (state.KeepRunning()) {
+        bool done = false;
+        bench.map.renderStills(bench.view, cameras, [&](std::size_t index, std::exception_ptr, Duration) {
+            ::benchmark::DoNotOptimize(bench.view.readStillImage());
+            done = index + 1 == cameras.size();
+        });
+
+        while (!done) {
+            util::RunLoop::Get()->runOnce();
+        }
+    }
+}
+
+BENCHMARK(API_renderStillGrid);
+BENCHMARK(API_renderStillsGrid);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class ThemeSwitchBenchmark {
+public:
+    ThemeSwitchBenchmark() {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+
+        map.getStyle().loadJSON(day);
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+        mbgl::benchmark::render(map, view);
+    }
+
+    const std::string day = util::read_file("benchmark/fixtures/api/data_driven_style.json");
+    const std::string night = util::read_file("benchmark/fixtures/api/data_driven_style_night.json");
+
+    util::RunLoop loop;
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view { backend.getContext(), { 1000, 1000 } };
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool { 4 };
+    Map map { backend, view.getSize(), 1, fileSource, threadPool, MapMode::Still };
+};
+
+} // end namespace
+
+// The time from loading a style that only differs in its colors until the map is fully rendered.
+static void API_renderThemeSwitch(::benchmark::State& state) {
+    ThemeSwitchBenchmark bench;
+    bool toggle = false;
+
+    while (state.KeepRunning()) {
+        toggle = !toggle;
+        bench.map.getStyle().loadJSON(toggle ? bench.night : bench.day);
+        mbgl::benchmark::render(bench.map, bench.view);
+    }
+}
+
+BENCHMARK(API_renderThemeSwitch);
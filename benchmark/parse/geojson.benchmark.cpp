@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/conversion.hpp>
+#include <mbgl/style/conversion/geojson.hpp>
+#include <mbgl/style/conversion/json.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <sstream>
+
+using namespace mbgl;
+using namespace mbgl::style::conversion;
+
+namespace {
+
+// Generates a FeatureCollection of short line strings with a few properties each, similar in
+// shape to a large exported dataset.
+std::string generateFeatureCollection(std::size_t count) {
+    std::stringstream json;
+    json << R"JSON({"type":"FeatureCollection","features":[)JSON";
+    for (std::size_t i = 0; i < count; i++) {
+        const double lng = -180.0 + double(i % 3600) / 10.0;
+        const double lat = -80.0 + double(i / 3600 % 1600) / 10.0;
+        json << (i ? "," : "")
+             << R"JSON({"type":"Feature","id":)JSON" << i
+             << R"JSON(,"properties":{"name":"feature )JSON" << i << R"JSON(","rank":)JSON" << i % 10
+             << R"JSON(},"geometry":{"type":"LineString","coordinates":[)JSON"
+             << "[" << util::toString(lng) << "," << util::toString(lat) << "],"
+             << "[" << util::toString(lng + 0.05) << "," << util::toString(lat + 0.05) << "],"
+             << "[" << util::toString(lng + 0.1) << "," << util::toString(lat) << "]]}}";
+    }
+    json << "]}";
+    return json.str();
+}
+
+} // end namespace
+
+static void Parse_GeoJSONDocument(benchmark::State& state) {
+    const std::string json = generateFeatureCollection(state.range_x());
+
+    while (state.KeepRunning()) {
+        Error error;
+        benchmark::DoNotOptimize(convertJSON<GeoJSON>(json, error));
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+static void Parse_GeoJSONChunked(benchmark::State& state) {
+    const std::string json = generateFeatureCollection(state.range_x());
+
+    while (state.KeepRunning()) {
+        Error error;
+        benchmark::DoNotOptimize(convert<GeoJSON>(json, error));
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+BENCHMARK(Parse_GeoJSONDocument)->Arg(1000)->Arg(100000);
+BENCHMARK(Parse_GeoJSONChunked)->Arg(1000)->Arg(100000);
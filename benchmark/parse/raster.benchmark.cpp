@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/premultiply.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const char* tiles[] = {
+    "test/fixtures/image/tile.png",
+    "test/fixtures/image/tile.jpeg",
+};
+
+} // end namespace
+
+// The previous raster tile pipeline, which premultiplied the decoded image and immediately
+// unpremultiplied it again.
+static void Parse_RasterTileRoundTrip(benchmark::State& state) {
+    const std::string data = util::read_file(tiles[state.range_x()]);
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(util::unpremultiply(decodeImage(data)));
+    }
+}
+
+static void Parse_RasterTile(benchmark::State& state) {
+    const std::string data = util::read_file(tiles[state.range_x()]);
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(decodeUnassociatedImage(data));
+    }
+}
+
+static void Parse_Premultiply(benchmark::State& state) {
+    const UnassociatedImage source = decodeUnassociatedImage(util::read_file("test/fixtures/image/no_profile_alpha.png"));
+    UnassociatedImage image({ 512, 512 });
+    for (uint32_t i = 0; i < image.bytes(); i++) {
+        image.data[i] = source.data[i % source.bytes()];
+    }
+
+    while (state.KeepRunning()) {
+        image = util::unpremultiply(util::premultiply(std::move(image)));
+    }
+
+    state.SetBytesProcessed(state.iterations() * image.bytes() * 2);
+}
+
+BENCHMARK(Parse_RasterTileRoundTrip)->Arg(0)->Arg(1);
+BENCHMARK(Parse_RasterTile)->Arg(0)->Arg(1);
+BENCHMARK(Parse_Premultiply);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/sprite/sprite_parser.hpp>
+#include <mbgl/style/image.hpp>
+#include <mbgl/style/image_impl.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <algorithm>
+
+using namespace mbgl;
+
+// 367 images in a 512x512 sheet.
+static const char* spriteImagePath = "test/fixtures/resources/sprite.png";
+static const char* spriteJSONPath = "test/fixtures/resources/sprite.json";
+
+static void Parse_Sprite(benchmark::State& state) {
+    const std::string spriteImage = util::read_file(spriteImagePath);
+    const std::string spriteJSON = util::read_file(spriteJSONPath);
+    std::size_t images = 0;
+
+    while (state.KeepRunning()) {
+        images = parseSprite(spriteImage, spriteJSON).size();
+    }
+
+    state.SetLabel(util::toString(images) + " images");
+}
+
+// Parses the sprite and copies the given number of its images into an atlas, like a style that
+// only uses some of the images of its sprite.
+static void Parse_SpriteUsed(benchmark::State& state) {
+    const std::string spriteImage = util::read_file(spriteImagePath);
+    const std::string spriteJSON = util::read_file(spriteJSONPath);
+    PremultipliedImage atlas({ 1024, 1024 });
+
+    while (state.KeepRunning()) {
+        const auto images = parseSprite(spriteImage, spriteJSON);
+        const std::size_t used = std::min<std::size_t>(state.range_x(), images.size());
+
+        uint32_t x = 0;
+        for (std::size_t i = 0; i < used; i++) {
+            const style::Image::Impl& image = *images[i]->baseImpl;
+            if (x + image.size.width > atlas.size.width) {
+                x = 0;
+            }
+            image.copy({ 0, 0 }, atlas, { x, 0 }, image.size);
+            x += image.size.width;
+        }
+    }
+}
+
+BENCHMARK(Parse_Sprite);
+BENCHMARK(Parse_SpriteUsed)->Arg(20)->Arg(1000);
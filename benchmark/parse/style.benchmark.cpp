@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/parser.hpp>
+#include <mbgl/style/parsed_style.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const char* fixtures[] = {
+    "benchmark/fixtures/api/query_style.json",
+    "benchmark/fixtures/api/data_driven_style.json",
+};
+
+} // namespace
+
+static void Parse_Style(benchmark::State& state) {
+    const std::string json = util::read_file(fixtures[state.range_x()]);
+    state.SetLabel(fixtures[state.range_x()]);
+
+    while (state.KeepRunning()) {
+        style::Parser parser;
+        parser.parse(json);
+    }
+}
+
+// Loading a style that was parsed before only creates the sources and layers.
+static void Parse_StyleCached(benchmark::State& state) {
+    const std::string json = util::read_file(fixtures[state.range_x()]);
+    state.SetLabel(fixtures[state.range_x()]);
+
+    while (state.KeepRunning()) {
+        auto style = style::ParsedStyle::parse(json);
+        style->createSources();
+        style->createLayers();
+    }
+}
+
+BENCHMARK(Parse_Style)->Arg(0)->Arg(1);
+BENCHMARK(Parse_StyleCached)->Arg(0)->Arg(1);
@@ -0,0 +1,69 @@
+#include <mbgl/benchmark/geojson_polygons.hpp>
+#include <mbgl/benchmark/util.hpp>
+
+#include <mbgl/style/style.hpp>
+#include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/storage/network_status.hpp>
+
+namespace mbgl {
+namespace benchmark {
+
+using namespace style;
+
+Feature generatePolygon(uint64_t id, double lng, double lat) {
+    return Feature { Polygon<double> { {
+        { lng, lat }, { lng + 0.0004, lat }, { lng + 0.0004, lat + 0.0004 }, { lng, lat + 0.0004 }, { lng, lat }
+    } }, {}, { id } };
+}
+
+FeatureCollection generatePolygonGrid() {
+    FeatureCollection features;
+    for (int x = 0; x < 400; x++) {
+        for (int y = 0; y < 400; y++) {
+            features.push_back(generatePolygon(x * 400 + y, -73.99 + x * 0.0005, 40.72 + y * 0.0005));
+        }
+    }
+    return features;
+}
+
+std::vector<CameraOptions> generateCameraGrid() {
+    std::vector<CameraOptions> cameras;
+    for (int x = 0; x < 4; x++) {
+        for (int y = 0; y < 4; y++) {
+            CameraOptions camera;
+            camera.center = LatLng { 40.72 + y * 0.01, -73.99 + x * 0.02 };
+            camera.zoom = 15.0;
+            cameras.push_back(camera);
+        }
+    }
+    return cameras;
+}
+
+GeoJSONPolygons::GeoJSONPolygons(Size size, ViewportMode viewportMode)
+    : view(backend.getContext(), size, viewportMode),
+      map(backend, size, 1, fileSource, threadPool, MapMode::Still, GLContextMode::Unique,
+          ConstrainMode::None, viewportMode) {
+    NetworkStatus::Set(NetworkStatus::Status::Offline);
+
+    map.getStyle().loadJSON(R"STYLE({ "version": 8, "sources": {}, "layers": [] })STYLE");
+
+    auto source_ = std::make_unique<GeoJSONSource>("polygons");
+    source_->setGeoJSON(generatePolygonGrid());
+    source = source_.get();
+    map.getStyle().addSource(std::move(source_));
+
+    auto fill = std::make_unique<FillLayer>("fill", "polygons");
+    fill->setFillColor(Color::red());
+    map.getStyle().addLayer(std::move(fill));
+
+    auto line = std::make_unique<LineLayer>("line", "polygons");
+    map.getStyle().addLayer(std::move(line));
+
+    map.setLatLngZoom({ 40.72, -73.99 }, 15);
+    render(map, view);
+}
+
+} // namespace benchmark
+} // namespace mbgl
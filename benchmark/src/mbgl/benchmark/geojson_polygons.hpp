@@ -0,0 +1,48 @@
+#pragma once
+
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/util/feature.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <vector>
+
+namespace mbgl {
+
+namespace style {
+class GeoJSONSource;
+} // namespace style
+
+namespace benchmark {
+
+// A square polygon at the given coordinates.
+Feature generatePolygon(uint64_t id, double lng, double lat);
+
+// Covers the area around the starting point of GeoJSONPolygons with a grid of small polygons.
+FeatureCollection generatePolygonGrid();
+
+// Cameras for a 4x4 grid of adjacent images across the polygon grid.
+std::vector<CameraOptions> generateCameraGrid();
+
+// A still map showing the polygon grid with a fill and a line layer. The starting point has
+// been rendered once.
+class GeoJSONPolygons {
+public:
+    GeoJSONPolygons(Size = { 1000, 1000 }, ViewportMode = ViewportMode::Default);
+
+    util::RunLoop loop;
+    HeadlessBackend backend;
+    BackendScope scope { backend };
+    OffscreenView view;
+    DefaultFileSource fileSource{ "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool{ 4 };
+    Map map;
+    style::GeoJSONSource* source = nullptr;
+};
+
+} // namespace benchmark
+} // namespace mbgl
@@ -3,13 +3,14 @@
 
 #include <mbgl/map/map.hpp>
 #include <mbgl/map/view.hpp>
+#include <mbgl/style/style.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/run_loop.hpp>
 
 namespace mbgl {
 namespace benchmark {
 
-void render(Map& map, OffscreenView& view) {
+PremultipliedImage render(Map& map, OffscreenView& view) {
     PremultipliedImage result;
     map.renderStill(view, [&](std::exception_ptr) {
         result = view.readStillImage();
@@ -18,6 +19,17 @@ void render(Map& map, OffscreenView& view) {
     while (!result.valid()) {
         util::RunLoop::Get()->runOnce();
     }
+
+    return result;
+}
+
+void discardTiles(Map& map, OffscreenView& view, MapMode mode) {
+    map.getStyle().loadJSON(R"STYLE({ "version": 8, "sources": {}, "layers": [] })STYLE");
+    if (mode == MapMode::Still) {
+        render(map, view);
+    } else {
+        map.render(view);
+    }
 }
 
 } // namespace benchmark
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <mbgl/map/mode.hpp>
+#include <mbgl/util/image.hpp>
+
 namespace mbgl {
 
 class Map;
@@ -7,7 +10,13 @@ class OffscreenView;
 
 namespace benchmark {
 
-void render(Map&, OffscreenView&);
+PremultipliedImage render(Map&, OffscreenView&);
+
+// Renders an empty style, which removes the sources of the current style together with their
+// tiles. Loading the same style again only updates the layers that changed, so benchmarks that
+// measure loading tiles call this first. Maps in continuous mode are rendered without waiting for
+// a still image.
+void discardTiles(Map&, OffscreenView&, MapMode = MapMode::Still);
 
 } // namespace benchmark
 } // namespace mbgl
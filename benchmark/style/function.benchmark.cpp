@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/function/source_function.hpp>
+#include <mbgl/style/function/composite_function.hpp>
+#include <mbgl/style/function/evaluation_cache.hpp>
+#include <mbgl/util/color.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <vector>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+class BenchmarkFeature {
+public:
+    optional<Value> getValue(const std::string&) const {
+        return value;
+    }
+
+    Value value;
+};
+
+// Features with `distinct` different values of the property, cycling through them.
+template <class F>
+std::vector<BenchmarkFeature> features(std::size_t distinct, F&& value) {
+    std::vector<BenchmarkFeature> result;
+    for (std::size_t i = 0; i < 10000; i++) {
+        result.push_back({ value(i % distinct) });
+    }
+    return result;
+}
+
+std::map<float, float> numericStops(std::size_t count) {
+    std::map<float, float> stops;
+    for (std::size_t i = 0; i < count; i++) {
+        stops.emplace(float(i), float(i * i));
+    }
+    return stops;
+}
+
+} // end namespace
+
+static void Style_exponentialStops(::benchmark::State& state) {
+    const SourceFunction<float> function("property", ExponentialStops<float>(numericStops(state.range_x()), 1.5f));
+    const auto input = features(1000, [&] (std::size_t i) { return Value(double(i) * state.range_x() / 1000); });
+
+    while (state.KeepRunning()) {
+        for (const auto& feature : input) {
+            ::benchmark::DoNotOptimize(function.evaluate(feature, 0.0f));
+        }
+    }
+}
+
+static void Style_intervalStops(::benchmark::State& state) {
+    const SourceFunction<float> function("property", IntervalStops<float>(numericStops(state.range_x())));
+    const auto input = features(1000, [&] (std::size_t i) { return Value(double(i) * state.range_x() / 1000); });
+
+    while (state.KeepRunning()) {
+        for (const auto& feature : input) {
+            ::benchmark::DoNotOptimize(function.evaluate(feature, 0.0f));
+        }
+    }
+}
+
+static void Style_categoricalStops(::benchmark::State& state) {
+    std::map<CategoricalValue, float> stops;
+    for (int64_t i = 0; i < state.range_x(); i++) {
+        stops.emplace(CategoricalValue("category " + util::toString(i)), float(i));
+    }
+    const SourceFunction<float> function("property", CategoricalStops<float>(stops));
+    const auto input = features(state.range_x(), [] (std::size_t i) { return Value("category " + util::toString(i)); });
+
+    while (state.KeepRunning()) {
+        for (const auto& feature : input) {
+            ::benchmark::DoNotOptimize(function.evaluate(feature, 0.0f));
+        }
+    }
+}
+
+static void Style_identityStops(::benchmark::State& state) {
+    const SourceFunction<Color> function("property", IdentityStops<Color>());
+    const auto input = features(state.range_x(), [] (std::size_t i) {
+        return Value("rgba(" + util::toString(i % 256) + ", 0, 0, 1)");
+    });
+
+    while (state.KeepRunning()) {
+        for (const auto& feature : input) {
+            ::benchmark::DoNotOptimize(function.evaluate(feature, Color::black()));
+        }
+    }
+}
+
+static void Style_compositeFunction(::benchmark::State& state) {
+    std::map<float, std::map<float, float>> stops;
+    for (std::size_t z = 0; z < 4; z++) {
+        stops.emplace(float(z * 5), numericStops(state.range_x()));
+    }
+    const CompositeFunction<float> function("property", CompositeExponentialStops<float>(stops));
+    const auto input = features(1000, [&] (std::size_t i) { return Value(double(i) * state.range_x() / 1000); });
+
+    while (state.KeepRunning()) {
+        for (const auto& feature : input) {
+            ::benchmark::DoNotOptimize(function.evaluate(12.0f, feature, 0.0f));
+        }
+    }
+}
+
+// Evaluates the features of a tile with the given number of distinct values, with or without
+// caching the results by value, like the paint property binders do.
+static void Style_evaluationCache(::benchmark::State& state) {
+    const std::size_t distinct = state.range_x();
+    const bool cached = state.range_y();
+
+    std::map<CategoricalValue, Color> stops;
+    for (std::size_t i = 0; i < 16; i++) {
+        stops.emplace(CategoricalValue("category " + util::toString(i)), Color::red());
+    }
+    const SourceFunction<Color> function("property", CategoricalStops<Color>(stops));
+    const auto input = features(distinct, [] (std::size_t i) { return Value("category " + util::toString(i)); });
+
+    while (state.KeepRunning()) {
+        EvaluationCache<Color> cache;
+        for (const auto& feature : input) {
+            const optional<Value> value = feature.getValue(function.property);
+            if (cached) {
+                ::benchmark::DoNotOptimize(cache.get(value, [&] {
+                    return function.evaluate(value, Color::black());
+                }));
+            } else {
+                ::benchmark::DoNotOptimize(function.evaluate(value, Color::black()));
+            }
+        }
+    }
+}
+
+BENCHMARK(Style_exponentialStops)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(Style_intervalStops)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(Style_categoricalStops)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(Style_identityStops)->Arg(4)->Arg(256);
+BENCHMARK(Style_compositeFunction)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(Style_evaluationCache)
+    ->ArgPair(4, 0)->ArgPair(4, 1)
+    ->ArgPair(64, 0)->ArgPair(64, 1)
+    ->ArgPair(1000, 0)->ArgPair(1000, 1);
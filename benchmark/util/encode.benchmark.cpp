@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/string.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const char* images[] = {
+    "test/fixtures/map/no_vao/expected.png",
+    "test/fixtures/image/tile.png",
+};
+
+// A larger rendering, made of the map fixture repeated 4 x 4 times.
+PremultipliedImage tiledImage() {
+    const PremultipliedImage tile = decodeImage(util::read_file(images[0]));
+    PremultipliedImage image({ tile.size.width * 4, tile.size.height * 4 });
+    for (uint32_t y = 0; y < 4; y++) {
+        for (uint32_t x = 0; x < 4; x++) {
+            PremultipliedImage::copy(tile, image, { 0, 0 },
+                                     { x * tile.size.width, y * tile.size.height }, tile.size);
+        }
+    }
+    return image;
+}
+
+// The previous encoder: unpremultiplies a copy of the image, doesn't filter the rows, and
+// compresses them with a single zlib call. Only the image data is encoded.
+std::string encodeUnfiltered(const PremultipliedImage& pre) {
+    const auto src = util::unpremultiply(pre.clone());
+    std::string idat;
+    for (uint32_t y = 0; y < src.size.height; y++) {
+        idat.append(1, 0);
+        idat.append(reinterpret_cast<const char*>(src.data.get() + y * src.stride()), src.stride());
+    }
+    return util::compress(idat);
+}
+
+// Reports the encoded size along with the time.
+template <typename Encode>
+void encode(benchmark::State& state, const PremultipliedImage& image, Encode&& encodeImage) {
+    std::size_t size = 0;
+    while (state.KeepRunning()) {
+        size = encodeImage(image).size();
+    }
+    state.SetBytesProcessed(state.iterations() * image.bytes());
+    state.SetLabel(util::toString(size) + " bytes");
+}
+
+} // end namespace
+
+static void Encode_PNGUnfiltered(benchmark::State& state) {
+    encode(state, decodeImage(util::read_file(images[state.range_x()])), encodeUnfiltered);
+}
+
+static void Encode_PNG(benchmark::State& state) {
+    encode(state, decodeImage(util::read_file(images[state.range_x()])), [](const auto& image) {
+        return encodePNG(image);
+    });
+}
+
+static void Encode_PNGQuantized(benchmark::State& state) {
+    PNGOptions options;
+    options.quantize = true;
+    encode(state, decodeImage(util::read_file(images[state.range_x()])), [&](const auto& image) {
+        return encodePNG(image, options);
+    });
+}
+
+static void Encode_PNGLargeUnfiltered(benchmark::State& state) {
+    encode(state, tiledImage(), encodeUnfiltered);
+}
+
+static void Encode_PNGLarge(benchmark::State& state) {
+    PNGOptions options;
+    options.threads = state.range_x();
+    encode(state, tiledImage(), [&](const auto& image) {
+        return encodePNG(image, options);
+    });
+}
+
+static void Encode_JPEG(benchmark::State& state) {
+    const int quality = state.range_y();
+    encode(state, decodeImage(util::read_file(images[state.range_x()])), [&](const auto& image) {
+        return encodeJPEG(image, quality);
+    });
+}
+
+#if !defined(__APPLE__)
+static void Encode_WebP(benchmark::State& state) {
+    const int quality = state.range_y();
+    encode(state, decodeImage(util::read_file(images[state.range_x()])), [&](const auto& image) {
+        return encodeWebP(image, quality);
+    });
+}
+#endif // !defined(__APPLE__)
+
+BENCHMARK(Encode_PNGUnfiltered)->Arg(0)->Arg(1);
+BENCHMARK(Encode_PNG)->Arg(0)->Arg(1);
+BENCHMARK(Encode_PNGQuantized)->Arg(0)->Arg(1);
+BENCHMARK(Encode_PNGLargeUnfiltered);
+BENCHMARK(Encode_PNGLarge)->Arg(1)->Arg(2)->Arg(4);
+BENCHMARK(Encode_JPEG)->ArgPair(0, 75)->ArgPair(0, 90)->ArgPair(1, 75)->ArgPair(1, 90);
+#if !defined(__APPLE__)
+BENCHMARK(Encode_WebP)->ArgPair(0, 75)->ArgPair(0, 90)->ArgPair(1, 75)->ArgPair(1, 90);
+#endif // !defined(__APPLE__)
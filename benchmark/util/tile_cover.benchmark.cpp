@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/map/transform.hpp>
+#include <mbgl/util/string.hpp>
+#include <mbgl/util/tile_cover.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+
+// Computes the tiles that cover a pitched view of San Francisco at zoom level 14, with a single
+// zoom level or with lower zoom levels in the distance.
+static void Util_tileCover(::benchmark::State& state) {
+    const double pitch = state.range_x();
+    const bool lod = state.range_y();
+
+    Transform transform;
+    transform.resize({ 1000, 1000 });
+    transform.setLatLngZoom({ 37.77, -122.42 }, 14);
+    transform.setPitch(pitch * M_PI / 180.0);
+
+    std::size_t count = 0;
+    while (state.KeepRunning()) {
+        const auto tiles = lod ? util::tileCoverWithLOD(transform.getState(), 14, 0, 14)
+                               : util::tileCover(transform.getState(), 14);
+        count = tiles.size();
+        ::benchmark::DoNotOptimize(count);
+    }
+
+    state.SetLabel(util::toString(count) + " tiles");
+}
+
+BENCHMARK(Util_tileCover)
+    ->ArgPair(0, 0)->ArgPair(0, 1)
+    ->ArgPair(30, 0)->ArgPair(30, 1)
+    ->ArgPair(45, 0)->ArgPair(45, 1)
+    ->ArgPair(60, 0)->ArgPair(60, 1);
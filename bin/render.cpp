@@ -18,6 +18,8 @@
 
 namespace po = boost::program_options;
 
+#include <algorithm>
+#include <cctype>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
@@ -33,6 +35,8 @@ int main(int argc, char *argv[]) {
     uint32_t width = 512;
     uint32_t height = 512;
     static std::string output = "out.png";
+    std::string format;
+    int quality = 90;
     std::string cache_file = "cache.sqlite";
     std::string asset_root = ".";
     std::string token;
@@ -52,6 +56,8 @@ int main(int argc, char *argv[]) {
         ("token,t", po::value(&token)->value_name("key")->default_value(token), "Mapbox access token")
         ("debug", po::bool_switch(&debug)->default_value(debug), "Debug mode")
         ("output,o", po::value(&output)->value_name("file")->default_value(output), "Output file name")
+        ("format,f", po::value(&format)->value_name("png|jpeg|webp"), "Image format, defaults to the output file extension")
+        ("quality,q", po::value(&quality)->value_name("0-100")->default_value(quality), "JPEG and WebP quality")
         ("cache,d", po::value(&cache_file)->value_name("file")->default_value(cache_file), "Cache database file name")
         ("assets,d", po::value(&asset_root)->value_name("file")->default_value(asset_root), "Directory to which asset:// URLs will resolve")
     ;
@@ -65,6 +71,21 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
 
+    if (format.empty()) {
+        const auto extension = output.rfind('.');
+        format = extension == std::string::npos ? "png" : output.substr(extension + 1);
+    }
+
+    std::transform(format.begin(), format.end(), format.begin(), ::tolower);
+    if (format == "jpg") {
+        format = "jpeg";
+    }
+
+    if (format != "png" && format != "jpeg" && format != "webp") {
+        std::cout << "Error: unsupported image format " << format << std::endl << desc;
+        exit(1);
+    }
+
     using namespace mbgl;
 
     util::RunLoop loop;
@@ -113,8 +134,15 @@ int main(int argc, char *argv[]) {
             exit(1);
         }
 
+        const PremultipliedImage image = view.readStillImage();
         std::ofstream out(output, std::ios::binary);
-        out << encodePNG(view.readStillImage());
+        if (format == "jpeg") {
+            out << encodeJPEG(image, quality);
+        } else if (format == "webp") {
+            out << encodeWebP(image, quality);
+        } else {
+            out << encodePNG(image);
+        }
         out.close();
         loop.stop();
     });
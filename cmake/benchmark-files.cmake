@@ -3,12 +3,29 @@
 set(MBGL_BENCHMARK_FILES
     # api
     benchmark/api/query.benchmark.cpp
+    benchmark/api/render_async_read.benchmark.cpp
+    benchmark/api/render_buffers.benchmark.cpp
+    benchmark/api/render_data_driven.benchmark.cpp
+    benchmark/api/render_draw_sorting.benchmark.cpp
+    benchmark/api/render_geojson.benchmark.cpp
+    benchmark/api/render_icons.benchmark.cpp
+    benchmark/api/render_metatile.benchmark.cpp
+    benchmark/api/render_paint_update.benchmark.cpp
+    benchmark/api/render_pitch.benchmark.cpp
+    benchmark/api/render_prefetch.benchmark.cpp
+    benchmark/api/render_shared.benchmark.cpp
+    benchmark/api/render_stills.benchmark.cpp
+    benchmark/api/render_theme_switch.benchmark.cpp
 
     # include/mbgl
     benchmark/include/mbgl/benchmark.hpp
 
     # parse
     benchmark/parse/filter.benchmark.cpp
+    benchmark/parse/geojson.benchmark.cpp
+    benchmark/parse/raster.benchmark.cpp
+    benchmark/parse/sprite.benchmark.cpp
+    benchmark/parse/style.benchmark.cpp
     benchmark/parse/vector_tile.benchmark.cpp
 
     # src
@@ -16,6 +33,15 @@ set(MBGL_BENCHMARK_FILES
 
     # src/mbgl/benchmark
     benchmark/src/mbgl/benchmark/benchmark.cpp
+    benchmark/src/mbgl/benchmark/geojson_polygons.cpp
+    benchmark/src/mbgl/benchmark/geojson_polygons.hpp
     benchmark/src/mbgl/benchmark/util.cpp
     benchmark/src/mbgl/benchmark/util.hpp
+
+    # style
+    benchmark/style/function.benchmark.cpp
+
+    # util
+    benchmark/util/encode.benchmark.cpp
+    benchmark/util/tile_cover.benchmark.cpp
 )
@@ -50,6 +50,8 @@ set(MBGL_CORE_FILES
     # gl
     src/mbgl/gl/attribute.cpp
     src/mbgl/gl/attribute.hpp
+    src/mbgl/gl/buffer_arena.cpp
+    src/mbgl/gl/buffer_arena.hpp
     src/mbgl/gl/color_mode.cpp
     src/mbgl/gl/color_mode.hpp
     src/mbgl/gl/context.cpp
@@ -61,6 +63,8 @@ set(MBGL_CORE_FILES
     src/mbgl/gl/depth_mode.cpp
     src/mbgl/gl/depth_mode.hpp
     src/mbgl/gl/draw_mode.hpp
+    src/mbgl/gl/draw_queue.cpp
+    src/mbgl/gl/draw_queue.hpp
     src/mbgl/gl/extension.hpp
     src/mbgl/gl/features.hpp
     src/mbgl/gl/framebuffer.hpp
@@ -69,6 +73,8 @@ set(MBGL_CORE_FILES
     src/mbgl/gl/index_buffer.hpp
     src/mbgl/gl/object.cpp
     src/mbgl/gl/object.hpp
+    src/mbgl/gl/pixel_buffer.hpp
+    src/mbgl/gl/pixel_buffer_extension.hpp
     src/mbgl/gl/primitives.hpp
     src/mbgl/gl/program.hpp
     src/mbgl/gl/program_binary_extension.hpp
@@ -105,12 +111,15 @@ set(MBGL_CORE_FILES
     include/mbgl/map/change.hpp
     include/mbgl/map/map.hpp
     include/mbgl/map/map_observer.hpp
+    include/mbgl/map/metatile.hpp
     include/mbgl/map/mode.hpp
     include/mbgl/map/query.hpp
+    include/mbgl/map/rendering_stats.hpp
     include/mbgl/map/view.hpp
     src/mbgl/map/backend.cpp
     src/mbgl/map/backend_scope.cpp
     src/mbgl/map/map.cpp
+    src/mbgl/map/metatile.cpp
     src/mbgl/map/transform.cpp
     src/mbgl/map/transform.hpp
     src/mbgl/map/transform_state.cpp
@@ -163,6 +172,8 @@ set(MBGL_CORE_FILES
     src/mbgl/renderer/cross_faded_property_evaluator.cpp
     src/mbgl/renderer/cross_faded_property_evaluator.hpp
     src/mbgl/renderer/data_driven_property_evaluator.hpp
+    src/mbgl/renderer/feature_texture.cpp
+    src/mbgl/renderer/feature_texture.hpp
     src/mbgl/renderer/frame_history.cpp
     src/mbgl/renderer/frame_history.hpp
     src/mbgl/renderer/group_by_layout.cpp
@@ -353,8 +364,12 @@ set(MBGL_CORE_FILES
     src/mbgl/style/light_observer.hpp
     src/mbgl/style/observer.hpp
     src/mbgl/style/paint_property.hpp
+    src/mbgl/style/parsed_style.cpp
+    src/mbgl/style/parsed_style.hpp
     src/mbgl/style/parser.cpp
     src/mbgl/style/parser.hpp
+    src/mbgl/style/parser_worker.cpp
+    src/mbgl/style/parser_worker.hpp
     src/mbgl/style/properties.hpp
     src/mbgl/style/rapidjson_conversion.hpp
     src/mbgl/style/source.cpp
@@ -399,6 +414,7 @@ set(MBGL_CORE_FILES
     include/mbgl/style/function/interval_stops.hpp
     include/mbgl/style/function/source_function.hpp
     src/mbgl/style/function/categorical_stops.cpp
+    src/mbgl/style/function/evaluation_cache.hpp
     src/mbgl/style/function/identity_stops.cpp
 
     # style/layers
@@ -510,6 +526,8 @@ set(MBGL_CORE_FILES
     src/mbgl/tile/tile.hpp
     src/mbgl/tile/tile_cache.cpp
     src/mbgl/tile/tile_cache.hpp
+    src/mbgl/tile/tile_data_cache.cpp
+    src/mbgl/tile/tile_data_cache.hpp
     src/mbgl/tile/tile_id.hpp
     src/mbgl/tile/tile_id_io.cpp
     src/mbgl/tile/tile_loader.hpp
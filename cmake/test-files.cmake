@@ -21,6 +21,8 @@ set(MBGL_TEST_FILES
 
     # gl
     test/gl/bucket.test.cpp
+    test/gl/buffer_arena.test.cpp
+    test/gl/draw_queue.test.cpp
     test/gl/object.test.cpp
 
     # include/mbgl
@@ -28,6 +30,7 @@ set(MBGL_TEST_FILES
 
     # map
     test/map/map.test.cpp
+    test/map/metatile.test.cpp
     test/map/transform.test.cpp
 
     # math
@@ -40,6 +43,7 @@ set(MBGL_TEST_FILES
     test/programs/symbol_program.test.cpp
 
     # renderer
+    test/renderer/feature_texture.test.cpp
     test/renderer/group_by_layout.test.cpp
     test/renderer/image_manager.test.cpp
 
@@ -80,6 +84,7 @@ set(MBGL_TEST_FILES
 
     # style/conversion
     test/style/conversion/function.test.cpp
+    test/style/conversion/geojson.test.cpp
     test/style/conversion/geojson_options.test.cpp
     test/style/conversion/layer.test.cpp
     test/style/conversion/light.test.cpp
@@ -91,11 +96,13 @@ set(MBGL_TEST_FILES
     # style/function
     test/style/function/camera_function.test.cpp
     test/style/function/composite_function.test.cpp
+    test/style/function/evaluation_cache.test.cpp
     test/style/function/exponential_stops.test.cpp
     test/style/function/interval_stops.test.cpp
     test/style/function/source_function.test.cpp
 
     # style
+    test/style/parsed_style.test.cpp
     test/style/properties.test.cpp
     test/style/source.test.cpp
     test/style/style.test.cpp
@@ -114,6 +121,7 @@ set(MBGL_TEST_FILES
     test/tile/geometry_tile_data.test.cpp
     test/tile/raster_tile.test.cpp
     test/tile/tile_coordinate.test.cpp
+    test/tile/tile_data_cache.test.cpp
     test/tile/tile_id.test.cpp
     test/tile/vector_tile.test.cpp
 
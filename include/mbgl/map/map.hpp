@@ -49,6 +49,15 @@ public:
     using StillImageCallback = std::function<void (std::exception_ptr)>;
     void renderStill(View&, StillImageCallback callback);
 
+    // Renders each of the cameras into the view in turn, reusing the loaded style, tiles and GL
+    // resources between them. The callback gets called (on the render thread) once per camera, in
+    // order, with the index of the camera and the time it took from the camera being set until
+    // the image was rendered; the view contains the image until the callback returns. The tiles
+    // for the next camera already start loading while the callback runs. The batch stops at the
+    // first error.
+    using StillImageBatchCallback = std::function<void (std::size_t, std::exception_ptr, Duration)>;
+    void renderStills(View&, std::vector<CameraOptions>, StillImageBatchCallback callback);
+
     // Triggers a repaint.
     void triggerRepaint();
 
@@ -159,6 +168,18 @@ public:
     // Memory
     void onLowMemory();
 
+    // Tile prefetching
+    /** Sets how many zoom levels below the current one tiles are requested
+        in advance, so that something is shown sooner while panning or
+        zooming out. Zero disables prefetching of lower zoom levels. */
+    void setPrefetchZoomDelta(uint8_t delta);
+    uint8_t getPrefetchZoomDelta() const;
+    /** Sets the maximum number of tiles per source that are requested in
+        advance, at lower zoom levels and at the destination of a camera
+        animation. */
+    void setPrefetchTileBudget(uint32_t);
+    uint32_t getPrefetchTileBudget() const;
+
     // Debug
     void setDebug(MapDebugOptions);
     void cycleDebugOptions();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/map/rendering_stats.hpp>
 #include <mbgl/style/source.hpp>
 
 #include <cstdint>
@@ -35,6 +36,7 @@ public:
     virtual void onDidFailLoadingMap(std::exception_ptr) {}
     virtual void onWillStartRenderingFrame() {}
     virtual void onDidFinishRenderingFrame(RenderMode) {}
+    virtual void onDidFinishRenderingFrameStats(const RenderingStats&) {}
     virtual void onWillStartRenderingMap() {}
     virtual void onDidFinishRenderingMap(RenderMode) {}
     virtual void onDidFinishLoadingStyle() {}
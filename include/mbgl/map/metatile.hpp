@@ -0,0 +1,50 @@
+#pragma once
+
+#include <mbgl/map/camera.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+
+// Describes a block of size × size output tiles that is rendered in a single still render and
+// then sliced into the individual tiles. Symbol placement, clipping and uploads happen once per
+// block instead of once per tile, and labels are consistent across the seams within the block.
+// Rendering a buffer around the block lets symbols that cross its edges be placed as well.
+//
+// The map must be created with the size returned by getSize() and ConstrainMode::None, so that
+// the camera isn't moved to keep blocks at the edges of the world within the viewport.
+class Metatile {
+public:
+    // `x` and `y` are the coordinates of the top left tile of the block at zoom level `z`. The
+    // buffer and tile size are in logical pixels. Throws std::invalid_argument if the top left
+    // tile is outside the world, or if the block is wider than the world.
+    Metatile(uint8_t z, uint32_t x, uint32_t y, uint32_t size, uint32_t buffer = 0, uint32_t tileSize = 256);
+
+    // The size of the map and view, in logical pixels.
+    Size getSize() const;
+    CameraOptions getCamera() const;
+
+    struct Tile {
+        uint8_t z;
+        uint32_t x;
+        uint32_t y;
+        PremultipliedImage image;
+    };
+
+    // Slices an image rendered with the given pixel ratio into the tiles of the block. Tiles that
+    // are beyond the bottom of the world are omitted, and tiles beyond the right edge of the world
+    // are wrapped around.
+    std::vector<Tile> slice(const PremultipliedImage&, float pixelRatio = 1) const;
+
+    const uint8_t z;
+    const uint32_t x;
+    const uint32_t y;
+    const uint32_t size;
+    const uint32_t buffer;
+    const uint32_t tileSize;
+};
+
+} // namespace mbgl
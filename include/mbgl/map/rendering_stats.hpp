@@ -0,0 +1,74 @@
+#pragma once
+
+#include <mbgl/util/chrono.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+/** Statistics about a single rendered frame, reported by
+    `MapObserver::onDidFinishRenderingFrameStats`. */
+struct RenderingStats {
+    /** CPU time spent in each pass of the frame. Commands may still be
+        executing on the GPU when a pass returns, so GPU time is not included.
+        The clipping pass includes uploading the buckets of the tiles. */
+    struct Timings {
+        Duration upload = Duration::zero();
+        Duration clip = Duration::zero();
+        Duration opaque = Duration::zero();
+        Duration translucent = Duration::zero();
+        Duration total = Duration::zero();
+    };
+
+    struct Layer {
+        std::string id;
+        std::size_t drawCalls = 0;
+    };
+
+    /** Bytes of buffer and texture data uploaded to the GPU during the frame. */
+    struct Uploads {
+        std::size_t bufferBytes = 0;
+        std::size_t textureBytes = 0;
+    };
+
+    /** GL objects that exist at the end of the frame. Textures include the
+        unused texture names that are kept in a pool. */
+    struct Objects {
+        /** Storage of the buffers that hold vertex and index data. */
+        std::size_t bufferBytes = 0;
+
+        std::size_t programs = 0;
+        std::size_t shaders = 0;
+        std::size_t buffers = 0;
+        std::size_t textures = 0;
+        std::size_t vertexArrays = 0;
+        std::size_t framebuffers = 0;
+        std::size_t renderbuffers = 0;
+    };
+
+    /** Tiles of the rendered sources, by state. Tiles are "loading" until the
+        tile data was received and parsed once, "parsing" while placement or
+        parsing work is pending, and "complete" otherwise. */
+    struct Tiles {
+        std::size_t loading = 0;
+        std::size_t parsing = 0;
+        std::size_t complete = 0;
+        std::size_t renderable = 0;
+    };
+
+    Timings timings;
+
+    std::size_t drawCalls = 0;
+    std::size_t stateChanges = 0;
+
+    /** Draw calls of every rendered style layer, from bottom to top. */
+    std::vector<Layer> layers;
+
+    Uploads uploads;
+    Objects objects;
+    Tiles tiles;
+};
+
+} // namespace mbgl
@@ -128,6 +128,15 @@ public:
      */
     bool requiredResourceCountIsPrecise = false;
 
+    /**
+     * The number of glyph ranges that are known to be required for this region. This is a
+     * subset of `requiredResourceCount`.
+     *
+     * Only the ranges that contain characters of the text in the region's tiles are
+     * required, so this number is known once the tiles have been downloaded.
+     */
+    uint64_t requiredGlyphRangeCount = 0;
+
     bool complete() const {
         return completedResourceCount == requiredResourceCount;
     }
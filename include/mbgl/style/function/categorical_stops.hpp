@@ -6,6 +6,7 @@
 #include <cassert>
 #include <utility>
 #include <map>
+#include <unordered_map>
 
 namespace mbgl {
 namespace style {
@@ -15,6 +16,10 @@ public:
     using variant<bool, int64_t, std::string>::variant;
 };
 
+struct CategoricalValueHash {
+    std::size_t operator()(const CategoricalValue&) const;
+};
+
 template <class T>
 class CategoricalStops {
 public:
@@ -24,7 +29,8 @@ public:
 
     CategoricalStops() = default;
     CategoricalStops(Stops stops_)
-        : stops(std::move(stops_)) {
+        : stops(std::move(stops_)),
+          index(stops.begin(), stops.end()) {
         assert(stops.size() > 0);
     }
 
@@ -34,6 +40,11 @@ public:
                            const CategoricalStops& rhs) {
         return lhs.stops == rhs.stops;
     }
+
+private:
+    // The stops in a hash table, which is faster to search than the map. The stops must not be
+    // changed after construction.
+    std::unordered_map<CategoricalValue, T, CategoricalValueHash> index;
 };
 
 } // namespace style
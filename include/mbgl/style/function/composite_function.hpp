@@ -7,8 +7,11 @@
 #include <mbgl/util/range.hpp>
 #include <mbgl/util/variant.hpp>
 
+#include <algorithm>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace mbgl {
 
@@ -46,7 +49,15 @@ public:
     CompositeFunction(std::string property_, Stops stops_, optional<T> defaultValue_ = {})
         : property(std::move(property_)),
           stops(std::move(stops_)),
-          defaultValue(std::move(defaultValue_)) {
+          defaultValue(std::move(defaultValue_)),
+          innerStops(stops.match([] (const auto& s) {
+              std::vector<std::pair<float, InnerStops>> result;
+              result.reserve(s.stops.size());
+              for (const auto& stop : s.stops) {
+                  result.emplace_back(stop.first, s.innerStops(stop.second));
+              }
+              return result;
+          })) {
     }
 
     struct CoveringRanges {
@@ -59,31 +70,12 @@ public:
     // is the first step toward evaluating the function, and is used for in the course of both partial
     // evaluation of data-driven paint properties, and full evaluation of data-driven layout properties.
     CoveringRanges coveringRanges(float zoom) const {
-        return stops.match(
-            [&] (const auto& s) {
-                assert(!s.stops.empty());
-                auto minIt = s.stops.lower_bound(zoom);
-                auto maxIt = s.stops.upper_bound(zoom);
-                
-                // lower_bound yields first element >= zoom, but we want the *last*
-                // element <= zoom, so if we found a stop > zoom, back up by one.
-                if (minIt != s.stops.begin() && minIt != s.stops.end() && minIt->first > zoom) {
-                    minIt--;
-                }
-                
-                return CoveringRanges {
-                    zoom,
-                    Range<float> {
-                        minIt == s.stops.end() ? s.stops.rbegin()->first : minIt->first,
-                        maxIt == s.stops.end() ? s.stops.rbegin()->first : maxIt->first
-                    },
-                    Range<InnerStops> {
-                        s.innerStops(minIt == s.stops.end() ? s.stops.rbegin()->second : minIt->second),
-                        s.innerStops(maxIt == s.stops.end() ? s.stops.rbegin()->second : maxIt->second)
-                    }
-                };
-            }
-        );
+        const Range<std::size_t> covering = coveringStops(zoom);
+        return CoveringRanges {
+            zoom,
+            Range<float> { innerStops[covering.min].first, innerStops[covering.max].first },
+            Range<InnerStops> { innerStops[covering.min].second, innerStops[covering.max].second }
+        };
     }
 
     // Given a range of zoom values (typically two adjacent integer zoom levels, e.g. 5.0 and 6.0),
@@ -101,8 +93,13 @@ public:
     // feature at each of the two zoom levels. These two results are what go into the paint vertex buffers
     // for vertices associated with this feature. The shader will interpolate between them at render time.
     template <class Feature>
-    Range<T> evaluate(const Range<CoveringRanges>& ranges, const Feature& feature, T finalDefaultValue) {
-        optional<Value> value = feature.getValue(property);
+    Range<T> evaluate(const Range<CoveringRanges>& ranges, const Feature& feature, T finalDefaultValue) const {
+        return evaluate(ranges, feature.getValue(property), finalDefaultValue);
+    }
+
+    // The same as above, for the value of the property of a feature, which is missing if the feature
+    // doesn't have the property.
+    Range<T> evaluate(const Range<CoveringRanges>& ranges, const optional<Value>& value, T finalDefaultValue) const {
         if (!value) {
             return Range<T> {
                 defaultValue.value_or(finalDefaultValue),
@@ -110,8 +107,10 @@ public:
             };
         }
         return Range<T> {
-            evaluateFinal(ranges.min, *value, finalDefaultValue),
-            evaluateFinal(ranges.max, *value, finalDefaultValue)
+            evaluateFinal(ranges.min.zoom, ranges.min.coveringZoomRange, ranges.min.coveringStopsRange.min,
+                          ranges.min.coveringStopsRange.max, *value, finalDefaultValue),
+            evaluateFinal(ranges.max.zoom, ranges.max.coveringZoomRange, ranges.max.coveringStopsRange.min,
+                          ranges.max.coveringStopsRange.max, *value, finalDefaultValue)
         };
     }
 
@@ -123,7 +122,13 @@ public:
         if (!value) {
             return defaultValue.value_or(finalDefaultValue);
         }
-        return evaluateFinal(coveringRanges(zoom), *value, finalDefaultValue);
+        // Evaluates the covering inner stops in place, rather than copying them into CoveringRanges.
+        const Range<std::size_t> covering = coveringStops(zoom);
+        return evaluateFinal(zoom,
+                             Range<float> { innerStops[covering.min].first, innerStops[covering.max].first },
+                             innerStops[covering.min].second,
+                             innerStops[covering.max].second,
+                             *value, finalDefaultValue);
     }
 
     friend bool operator==(const CompositeFunction& lhs,
@@ -138,15 +143,46 @@ public:
     bool useIntegerZoom = false;
 
 private:
-    T evaluateFinal(const CoveringRanges& ranges, const Value& value, T finalDefaultValue) const {
+    // Returns the indices of the last stop <= zoom and of the first stop > zoom, clamped to the
+    // first and last stop.
+    Range<std::size_t> coveringStops(float zoom) const {
+        assert(!innerStops.empty());
+        const auto begin = innerStops.begin();
+        const auto end = innerStops.end();
+        std::size_t minIndex = std::lower_bound(begin, end, zoom, [] (const auto& stop, float z) {
+            return stop.first < z;
+        }) - begin;
+        std::size_t maxIndex = std::upper_bound(begin, end, zoom, [] (float z, const auto& stop) {
+            return z < stop.first;
+        }) - begin;
+
+        // lower_bound yields first element >= zoom, but we want the *last*
+        // element <= zoom, so if we found a stop > zoom, back up by one.
+        if (minIndex != 0 && minIndex != innerStops.size() && innerStops[minIndex].first > zoom) {
+            minIndex--;
+        }
+
+        return Range<std::size_t> {
+            std::min(minIndex, innerStops.size() - 1),
+            std::min(maxIndex, innerStops.size() - 1)
+        };
+    }
+
+    T evaluateFinal(float zoom, const Range<float>& coveringZoomRange,
+                    const InnerStops& minStops, const InnerStops& maxStops,
+                    const Value& value, T finalDefaultValue) const {
         auto eval = [&] (const auto& s) {
             return s.evaluate(value).value_or(defaultValue.value_or(finalDefaultValue));
         };
         return util::interpolate(
-            ranges.coveringStopsRange.min.match(eval),
-            ranges.coveringStopsRange.max.match(eval),
-            util::interpolationFactor(1.0f, ranges.coveringZoomRange, ranges.zoom));
+            minStops.match(eval),
+            maxStops.match(eval),
+            util::interpolationFactor(1.0f, coveringZoomRange, zoom));
     }
+
+    // The inner stops of each zoom level stop, so that they don't need to be rebuilt for every
+    // evaluation.
+    std::vector<std::pair<float, InnerStops>> innerStops;
 };
 
 } // namespace style
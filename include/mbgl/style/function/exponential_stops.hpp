@@ -3,7 +3,9 @@
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/interpolate.hpp>
 
+#include <algorithm>
 #include <map>
+#include <vector>
 
 namespace mbgl {
 namespace style {
@@ -20,21 +22,27 @@ public:
     ExponentialStops(Stops stops_, float base_ = 1.0f)
         : stops(std::move(stops_)),
           base(base_) {
+        inputs.reserve(stops.size());
+        outputs.reserve(stops.size());
+        for (const auto& stop : stops) {
+            inputs.push_back(stop.first);
+            outputs.push_back(stop.second);
+        }
     }
 
     optional<T> evaluate(float z) const {
-        if (stops.empty()) {
+        if (inputs.empty()) {
             return {};
         }
 
-        auto it = stops.upper_bound(z);
-        if (it == stops.end()) {
-            return stops.rbegin()->second;
-        } else if (it == stops.begin()) {
-            return stops.begin()->second;
+        const std::size_t i = std::upper_bound(inputs.begin(), inputs.end(), z) - inputs.begin();
+        if (i == inputs.size()) {
+            return outputs.back();
+        } else if (i == 0) {
+            return outputs.front();
         } else {
-            return util::interpolate(std::prev(it)->second, it->second,
-                util::interpolationFactor(base, { std::prev(it)->first, it->first }, z));
+            return util::interpolate(outputs[i - 1], outputs[i],
+                util::interpolationFactor(base, { inputs[i - 1], inputs[i] }, z));
         }
     }
 
@@ -50,6 +58,12 @@ public:
                            const ExponentialStops& rhs) {
         return lhs.stops == rhs.stops && lhs.base == rhs.base;
     }
+
+private:
+    // The stops as sorted arrays, which are faster to search than the map. The stops must not be
+    // changed after construction.
+    std::vector<float> inputs;
+    std::vector<T> outputs;
 };
 
 } // namespace style
@@ -2,7 +2,9 @@
 
 #include <mbgl/util/feature.hpp>
 
+#include <algorithm>
 #include <map>
+#include <vector>
 
 namespace mbgl {
 namespace style {
@@ -16,20 +18,26 @@ public:
     IntervalStops() = default;
     IntervalStops(Stops stops_)
         : stops(std::move(stops_)) {
+        inputs.reserve(stops.size());
+        outputs.reserve(stops.size());
+        for (const auto& stop : stops) {
+            inputs.push_back(stop.first);
+            outputs.push_back(stop.second);
+        }
     }
 
     optional<T> evaluate(float z) const {
-        if (stops.empty()) {
+        if (inputs.empty()) {
             return {};
         }
 
-        auto it = stops.upper_bound(z);
-        if (it == stops.end()) {
-            return stops.rbegin()->second;
-        } else if (it == stops.begin()) {
-            return stops.begin()->second;
+        const std::size_t i = std::upper_bound(inputs.begin(), inputs.end(), z) - inputs.begin();
+        if (i == inputs.size()) {
+            return outputs.back();
+        } else if (i == 0) {
+            return outputs.front();
         } else {
-            return std::prev(it)->second;
+            return outputs[i - 1];
         }
     }
 
@@ -45,6 +53,12 @@ public:
                            const IntervalStops& rhs) {
         return lhs.stops == rhs.stops;
     }
+
+private:
+    // The stops as sorted arrays, which are faster to search than the map. The stops must not be
+    // changed after construction.
+    std::vector<float> inputs;
+    std::vector<T> outputs;
 };
 
 } // namespace style
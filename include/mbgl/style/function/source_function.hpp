@@ -35,7 +35,12 @@ public:
 
     template <class Feature>
     T evaluate(const Feature& feature, T finalDefaultValue) const {
-        optional<Value> v = feature.getValue(property);
+        return evaluate(feature.getValue(property), finalDefaultValue);
+    }
+
+    // Evaluates the function for the value of the property of a feature, which is missing if the
+    // feature doesn't have the property.
+    T evaluate(const optional<Value>& v, T finalDefaultValue) const {
         if (!v) {
             return defaultValue.value_or(finalDefaultValue);
         }
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <mbgl/style/source.hpp>
+#include <mbgl/util/feature.hpp>
 #include <mbgl/util/geojson.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <vector>
+
 namespace mbgl {
 
 class AsyncRequest;
@@ -30,6 +33,14 @@ public:
     void setURL(const std::string& url);
     void setGeoJSON(const GeoJSON&);
 
+    // Adds the given features, replacing existing features with the same identifiers. Only the
+    // tiles intersecting the old or new features are regenerated. Throws std::runtime_error if a
+    // feature has no identifier, since it couldn't be replaced or removed afterwards.
+    void updateFeatures(const FeatureCollection&);
+
+    // Removes the features with the given identifiers.
+    void removeFeatures(const std::vector<FeatureIdentifier>&);
+
     optional<std::string> getURL() const;
 
     class Impl;
@@ -40,6 +40,9 @@ constexpr float  MAX_ZOOM_F = MAX_ZOOM;
 
 constexpr uint64_t DEFAULT_MAX_CACHE_SIZE = 50 * 1024 * 1024;
 
+constexpr uint8_t DEFAULT_PREFETCH_ZOOM_DELTA = 4;
+constexpr uint32_t DEFAULT_PREFETCH_TILE_BUDGET = 64;
+
 constexpr Duration DEFAULT_TRANSITION_DURATION = Milliseconds(300);
 constexpr Seconds CLOCK_SKEW_RETRY_TIMEOUT { 30 };
 
@@ -146,6 +146,29 @@ using AlphaImage = Image<ImageAlphaMode::Exclusive>;
 
 // TODO: don't use std::string for binary data.
 PremultipliedImage decodeImage(const std::string&);
-std::string encodePNG(const PremultipliedImage&);
+
+// Decodes without premultiplying, for images that are uploaded with unassociated alpha. On
+// platforms whose decoders only produce premultiplied images, this unpremultiplies the result.
+UnassociatedImage decodeUnassociatedImage(const std::string&);
+
+struct PNGOptions {
+    // Encodes the image with a palette of at most 256 colors. Images with more distinct colors
+    // are quantized, which is lossy.
+    bool quantize = false;
+
+    // zlib compression level, from 0 (none) to 9 (best).
+    int compressionLevel = 6;
+
+    // Large images are split into bands of rows that are compressed in parallel on this many
+    // threads, at a small cost in compression ratio.
+    std::size_t threads = 1;
+};
+
+std::string encodePNG(const PremultipliedImage&, const PNGOptions& = {});
+
+// Lossy encoders for opaque images, with a quality from 0 to 100. JPEG has no alpha channel, so
+// translucent pixels are composited onto black.
+std::string encodeJPEG(const PremultipliedImage&, int quality = 90);
+std::string encodeWebP(const PremultipliedImage&, int quality = 90);
 
 } // namespace mbgl
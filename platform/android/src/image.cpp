@@ -1,6 +1,8 @@
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/string.hpp>
+#include <mbgl/util/premultiply.hpp>
 
+#include <stdexcept>
 #include <string>
 
 #include "attach_env.hpp"
@@ -19,4 +21,18 @@ PremultipliedImage decodeImage(const std::string& string) {
     return android::Bitmap::GetImage(*env, bitmap);
 }
 
+// Android bitmaps are always premultiplied.
+UnassociatedImage decodeUnassociatedImage(const std::string& string) {
+    return util::unpremultiply(decodeImage(string));
+}
+
+// The encoders aren't part of the SDK, to keep it small.
+std::string encodeJPEG(const PremultipliedImage&, int) {
+    throw std::runtime_error("JPEG encoding is not supported on this platform");
+}
+
+std::string encodeWebP(const PremultipliedImage&, int) {
+    throw std::runtime_error("WebP encoding is not supported on this platform");
+}
+
 } // namespace mbgl
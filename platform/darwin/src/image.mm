@@ -1,4 +1,5 @@
 #include <mbgl/util/image+MGLAdditions.hpp>
+#include <mbgl/util/premultiply.hpp>
 
 #import <ImageIO/ImageIO.h>
 
@@ -22,6 +23,8 @@ using CGImageSourceHandle = CFHandle<CGImageSourceRef, CFTypeRef, CFRelease>;
 using CGDataProviderHandle = CFHandle<CGDataProviderRef, CGDataProviderRef, CGDataProviderRelease>;
 using CGColorSpaceHandle = CFHandle<CGColorSpaceRef, CGColorSpaceRef, CGColorSpaceRelease>;
 using CGContextHandle = CFHandle<CGContextRef, CGContextRef, CGContextRelease>;
+using CFMutableDataHandle = CFHandle<CFMutableDataRef, CFTypeRef, CFRelease>;
+using CGImageDestinationHandle = CFHandle<CGImageDestinationRef, CFTypeRef, CFRelease>;
 
 CGImageRef CGImageFromMGLPremultipliedImage(mbgl::PremultipliedImage&& src) {
     // We're converting the PremultipliedImage's backing store to a CGDataProvider, and are taking
@@ -83,7 +86,7 @@ mbgl::PremultipliedImage MGLPremultipliedImageFromCGImage(CGImageRef src) {
 
 namespace mbgl {
 
-PremultipliedImage decodeImage(const std::string& source) {
+static CGImageRef createImage(const std::string& source) {
     CFDataHandle data(CFDataCreateWithBytesNoCopy(
         kCFAllocatorDefault, reinterpret_cast<const unsigned char*>(source.data()), source.size(),
         kCFAllocatorNull));
@@ -96,12 +99,66 @@ PremultipliedImage decodeImage(const std::string& source) {
         throw std::runtime_error("CGImageSourceCreateWithData failed");
     }
 
-    CGImageHandle image(CGImageSourceCreateImageAtIndex(*imageSource, 0, NULL));
+    CGImageRef image = CGImageSourceCreateImageAtIndex(*imageSource, 0, NULL);
     if (!image) {
         throw std::runtime_error("CGImageSourceCreateImageAtIndex failed");
     }
 
+    return image;
+}
+
+PremultipliedImage decodeImage(const std::string& source) {
+    CGImageHandle image(createImage(source));
     return MGLPremultipliedImageFromCGImage(*image);
 }
 
+UnassociatedImage decodeUnassociatedImage(const std::string& source) {
+    CGImageHandle image(createImage(source));
+    PremultipliedImage premultiplied = MGLPremultipliedImageFromCGImage(*image);
+
+    // Core Graphics can only draw into premultiplied bitmaps, but opaque images, such as JPEG
+    // tiles, are identical in both representations.
+    switch (CGImageGetAlphaInfo(*image)) {
+    case kCGImageAlphaNone:
+    case kCGImageAlphaNoneSkipLast:
+    case kCGImageAlphaNoneSkipFirst:
+        return { premultiplied.size, std::move(premultiplied.data) };
+    default:
+        return util::unpremultiply(std::move(premultiplied));
+    }
+}
+
+std::string encodeJPEG(const PremultipliedImage& src, int quality) {
+    CGImageHandle image(CGImageFromMGLPremultipliedImage(src.clone()));
+    if (!image) {
+        throw std::runtime_error("CGImageCreate failed");
+    }
+
+    CFMutableDataHandle data(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    if (!data) {
+        throw std::runtime_error("CFDataCreateMutable failed");
+    }
+
+    CGImageDestinationHandle destination(
+        CGImageDestinationCreateWithData(*data, CFSTR("public.jpeg"), 1, NULL));
+    if (!destination) {
+        throw std::runtime_error("CGImageDestinationCreateWithData failed");
+    }
+
+    NSDictionary *properties = @{
+        (__bridge NSString *)kCGImageDestinationLossyCompressionQuality: @(quality / 100.0),
+    };
+    CGImageDestinationAddImage(*destination, *image, (__bridge CFDictionaryRef)properties);
+    if (!CGImageDestinationFinalize(*destination)) {
+        throw std::runtime_error("CGImageDestinationFinalize failed");
+    }
+
+    return std::string(reinterpret_cast<const char*>(CFDataGetBytePtr(*data)), CFDataGetLength(*data));
+}
+
+// ImageIO can't write WebP images.
+std::string encodeWebP(const PremultipliedImage&, int) {
+    throw std::runtime_error("WebP encoding is not supported on this platform");
+}
+
 } // namespace mbgl
@@ -5,13 +5,17 @@
 namespace mbgl {
 
 #if !defined(__ANDROID__) && !defined(__APPLE__)
-PremultipliedImage decodeWebP(const uint8_t*, size_t);
+UnassociatedImage decodeWebP(const uint8_t*, size_t);
 #endif // !defined(__ANDROID__) && !defined(__APPLE__)
 
-PremultipliedImage decodePNG(const uint8_t*, size_t);
-PremultipliedImage decodeJPEG(const uint8_t*, size_t);
+UnassociatedImage decodePNG(const uint8_t*, size_t);
+UnassociatedImage decodeJPEG(const uint8_t*, size_t);
 
-PremultipliedImage decodeImage(const std::string& string) {
+static bool isJPEG(const uint8_t* data, size_t size) {
+    return size >= 2 && (((data[0] << 8) | data[1]) & 0xffff) == 0xFFD8;
+}
+
+UnassociatedImage decodeUnassociatedImage(const std::string& string) {
     const auto* data = reinterpret_cast<const uint8_t*>(string.data());
     const size_t size = string.size();
 
@@ -32,14 +36,23 @@ PremultipliedImage decodeImage(const std::string& string) {
         }
     }
 
-    if (size >= 2) {
-        uint16_t magic = ((data[0] << 8) | data[1]) & 0xffff;
-        if (magic == 0xFFD8) {
-            return decodeJPEG(data, size);
-        }
+    if (isJPEG(data, size)) {
+        return decodeJPEG(data, size);
     }
 
     throw std::runtime_error("unsupported image type");
 }
 
+PremultipliedImage decodeImage(const std::string& string) {
+    const auto* data = reinterpret_cast<const uint8_t*>(string.data());
+
+    // JPEG images are opaque, so premultiplying them wouldn't change anything.
+    if (isJPEG(data, string.size())) {
+        UnassociatedImage image = decodeJPEG(data, string.size());
+        return { image.size, std::move(image.data) };
+    }
+
+    return util::premultiply(decodeUnassociatedImage(string));
+}
+
 } // namespace mbgl
@@ -0,0 +1,82 @@
+#include <mbgl/util/image.hpp>
+
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+extern "C"
+{
+#include <jpeglib.h>
+}
+
+namespace mbgl {
+
+static void on_error(j_common_ptr cinfo) {
+    char buffer[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, buffer);
+    throw std::runtime_error(std::string("JPEG Writer: libjpeg could not write image: ") + buffer);
+}
+
+struct jpeg_compress_guard {
+    jpeg_compress_guard(jpeg_compress_struct* cinfo)
+        : i_(cinfo) {}
+
+    ~jpeg_compress_guard() {
+        jpeg_destroy_compress(i_);
+        std::free(buffer);
+    }
+
+    jpeg_compress_struct* i_;
+    unsigned char* buffer = nullptr;
+};
+
+std::string encodeJPEG(const PremultipliedImage& src, const int quality) {
+    jpeg_compress_struct cinfo;
+    jpeg_compress_guard guard(&cinfo);
+    jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jerr.error_exit = on_error;
+    jpeg_create_compress(&cinfo);
+
+    unsigned long size = 0;
+    jpeg_mem_dest(&cinfo, &guard.buffer, &size);
+
+    cinfo.image_width = src.size.width;
+    cinfo.image_height = src.size.height;
+
+    // Premultiplied pixels are already composited onto black, so the color channels can be used
+    // as they are, and the alpha channel is dropped. libjpeg-turbo reads RGBX pixels directly.
+#if defined(JCS_EXTENSIONS)
+    cinfo.input_components = 4;
+    cinfo.in_color_space = JCS_EXT_RGBX;
+#else
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    std::vector<JSAMPLE> row(src.size.width * 3);
+#endif
+
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+
+    while (cinfo.next_scanline < cinfo.image_height) {
+        const uint8_t* pixels = src.data.get() + cinfo.next_scanline * src.stride();
+#if defined(JCS_EXTENSIONS)
+        JSAMPROW rows[1] = { const_cast<JSAMPLE*>(pixels) };
+#else
+        for (uint32_t x = 0; x < src.size.width; x++) {
+            row[x * 3 + 0] = pixels[x * 4 + 0];
+            row[x * 3 + 1] = pixels[x * 4 + 1];
+            row[x * 3 + 2] = pixels[x * 4 + 2];
+        }
+        JSAMPROW rows[1] = { row.data() };
+#endif
+        jpeg_write_scanlines(&cinfo, rows, 1);
+    }
+
+    jpeg_finish_compress(&cinfo);
+
+    return std::string(reinterpret_cast<const char*>(guard.buffer), size);
+}
+
+} // namespace mbgl
@@ -6,12 +6,15 @@
 
 #include <cstring>
 #include <cassert>
+#include <deque>
+#include <vector>
 
 namespace mbgl {
 
 class OffscreenView::Impl {
 public:
-    Impl(gl::Context& context_, const Size size_) : context(context_), size(std::move(size_)) {
+    Impl(gl::Context& context_, const Size size_, const ViewportMode viewportMode)
+        : context(context_), size(std::move(size_)), flip(viewportMode != ViewportMode::FlippedY) {
         assert(!size.isEmpty());
     }
 
@@ -29,7 +32,45 @@ public:
     }
 
     PremultipliedImage readStillImage() {
-        return context.readFramebuffer<PremultipliedImage>(size);
+        return context.readFramebuffer<PremultipliedImage>(size, flip);
+    }
+
+    void startStillImageRead() {
+        if (!context.supportsPixelBuffers()) {
+            completedReads.push_back(readStillImage());
+            return;
+        }
+
+#if not MBGL_USE_GLES2
+        // Pixel buffers are reused once their image has been retrieved; while rendering one image
+        // and reading back the previous one, two buffers are in use.
+        if (availableBuffers.empty()) {
+            availableBuffers.push_back(context.createPixelBuffer(size));
+        }
+
+        pendingReads.push_back(std::move(availableBuffers.back()));
+        availableBuffers.pop_back();
+        context.readFramebuffer(pendingReads.back());
+#endif // MBGL_USE_GLES2
+    }
+
+    PremultipliedImage finishStillImageRead() {
+        if (!completedReads.empty()) {
+            PremultipliedImage image = std::move(completedReads.front());
+            completedReads.pop_front();
+            return image;
+        }
+
+#if not MBGL_USE_GLES2
+        if (!pendingReads.empty()) {
+            PremultipliedImage image = context.readPixelBuffer<PremultipliedImage>(pendingReads.front(), flip);
+            availableBuffers.push_back(std::move(pendingReads.front()));
+            pendingReads.pop_front();
+            return image;
+        }
+#endif // MBGL_USE_GLES2
+
+        throw std::runtime_error("no still image read has been started");
     }
 
     const Size& getSize() const {
@@ -39,13 +80,20 @@ public:
 private:
     gl::Context& context;
     const Size size;
+    const bool flip;
     optional<gl::Framebuffer> framebuffer;
     optional<gl::Renderbuffer<gl::RenderbufferType::RGBA>> color;
     optional<gl::Renderbuffer<gl::RenderbufferType::DepthStencil>> depthStencil;
+
+    std::deque<PremultipliedImage> completedReads;
+#if not MBGL_USE_GLES2
+    std::deque<gl::PixelBuffer> pendingReads;
+    std::vector<gl::PixelBuffer> availableBuffers;
+#endif // MBGL_USE_GLES2
 };
 
-OffscreenView::OffscreenView(gl::Context& context, const Size size)
-    : impl(std::make_unique<Impl>(context, std::move(size))) {
+OffscreenView::OffscreenView(gl::Context& context, const Size size, const ViewportMode viewportMode)
+    : impl(std::make_unique<Impl>(context, std::move(size), viewportMode)) {
 }
 
 OffscreenView::~OffscreenView() = default;
@@ -58,6 +106,14 @@ PremultipliedImage OffscreenView::readStillImage() {
     return impl->readStillImage();
 }
 
+void OffscreenView::startStillImageRead() {
+    impl->startStillImageRead();
+}
+
+PremultipliedImage OffscreenView::finishStillImageRead() {
+    return impl->finishStillImageRead();
+}
+
 const Size& OffscreenView::getSize() const {
     return impl->getSize();
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/map/view.hpp>
+#include <mbgl/map/mode.hpp>
 #include <mbgl/util/image.hpp>
 
 namespace mbgl {
@@ -11,13 +12,22 @@ class Context;
 
 class OffscreenView : public View {
 public:
-    OffscreenView(gl::Context&, Size size = { 256, 256 });
+    // Pass the ViewportMode of the map that renders into this view. Images rendered with
+    // ViewportMode::FlippedY are already top-down, and don't need to be flipped when read back.
+    OffscreenView(gl::Context&, Size size = { 256, 256 }, ViewportMode = ViewportMode::Default);
     ~OffscreenView() override;
 
     void bind() override;
 
     PremultipliedImage readStillImage();
 
+    // Starts reading the rendered image without waiting for rendering to finish, so that the
+    // next image can be rendered while the pixels are transferred. Images are returned by
+    // finishStillImageRead() in the order they were started. Where pixel buffer objects aren't
+    // supported, the image is read synchronously.
+    void startStillImageRead();
+    PremultipliedImage finishStillImageRead();
+
     const Size& getSize() const;
 
 private:
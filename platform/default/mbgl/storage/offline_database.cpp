@@ -49,7 +49,8 @@ void OfflineDatabase::ensureSchema() {
             case 2: migrateToVersion3(); // fall through
             case 3: // no-op and fall through
             case 4: migrateToVersion5(); // fall through
-            case 5: return;
+            case 5: migrateToVersion6(); // fall through
+            case 6: return;
             default: throw std::runtime_error("unknown schema version");
             }
 
@@ -83,7 +84,7 @@ void OfflineDatabase::ensureSchema() {
         db->exec("PRAGMA journal_mode = DELETE");
         db->exec("PRAGMA synchronous = FULL");
         db->exec(schema);
-        db->exec("PRAGMA user_version = 5");
+        db->exec("PRAGMA user_version = 6");
     } catch (...) {
         Log::Error(Event::Database, "Unexpected error creating database schema: %s", util::toString(std::current_exception()).c_str());
         throw;
@@ -126,6 +127,28 @@ void OfflineDatabase::migrateToVersion5() {
     db->exec("PRAGMA user_version = 5");
 }
 
+void OfflineDatabase::migrateToVersion6() {
+    db->exec("ALTER TABLE regions ADD COLUMN glyph_range_count INTEGER");
+
+    // Regions downloaded before version 6 stored every range of the font stacks of their style,
+    // and still require them. Regions without any glyph ranges are counted by their next download.
+    // Glyph ranges are resources of kind 4.
+    // clang-format off
+    db->exec("UPDATE regions SET glyph_range_count = ( "
+             "    SELECT COUNT(*) FROM region_resources, resources "
+             "    WHERE region_id = regions.id "
+             "      AND resource_id = resources.id "
+             "      AND kind = 4) "
+             "WHERE EXISTS ( "
+             "    SELECT 1 FROM region_resources, resources "
+             "    WHERE region_id = regions.id "
+             "      AND resource_id = resources.id "
+             "      AND kind = 4)");
+    // clang-format on
+
+    db->exec("PRAGMA user_version = 6");
+}
+
 OfflineDatabase::Statement OfflineDatabase::getStatement(const char * sql) {
     auto it = statements.find(sql);
 
@@ -723,6 +746,85 @@ OfflineRegionDefinition OfflineDatabase::getRegionDefinition(int64_t regionID) {
     return decodeOfflineRegionDefinition(stmt->get<std::string>(0));
 }
 
+optional<uint64_t> OfflineDatabase::getRegionGlyphRangeCount(int64_t regionID) {
+    // clang-format off
+    Statement stmt = getStatement(
+        "SELECT glyph_range_count FROM regions WHERE id = ?1");
+    // clang-format on
+
+    stmt->bind(1, regionID);
+    if (!stmt->run()) {
+        return {};
+    }
+
+    optional<int64_t> count = stmt->get<optional<int64_t>>(0);
+    if (!count) {
+        return {};
+    }
+    return *count;
+}
+
+void OfflineDatabase::setRegionGlyphRangeCount(int64_t regionID, uint64_t count) {
+    // clang-format off
+    Statement stmt = getStatement(
+        "UPDATE regions SET glyph_range_count = ?1 WHERE id = ?2");
+    // clang-format on
+
+    stmt->bind(1, static_cast<int64_t>(count));
+    stmt->bind(2, regionID);
+    stmt->run();
+}
+
+uint64_t OfflineDatabase::getRegionCompletedGlyphRangeCount(int64_t regionID) {
+    // clang-format off
+    Statement stmt = getStatement(
+        "SELECT COUNT(*) "
+        "FROM region_resources, resources "
+        "WHERE region_id = ?1 "
+        "  AND resource_id = resources.id "
+        "  AND kind = ?2 ");
+    // clang-format on
+
+    stmt->bind(1, regionID);
+    stmt->bind(2, int(Resource::Kind::Glyphs));
+    stmt->run();
+    return stmt->get<int64_t>(0);
+}
+
+void OfflineDatabase::removeRegionGlyphs(int64_t regionID, const std::unordered_set<std::string>& required) {
+    // clang-format off
+    Statement select = getStatement(
+        "SELECT resources.id, url "
+        "FROM region_resources, resources "
+        "WHERE region_id = ?1 "
+        "  AND resource_id = resources.id "
+        "  AND kind = ?2 ");
+    // clang-format on
+
+    select->bind(1, regionID);
+    select->bind(2, int(Resource::Kind::Glyphs));
+
+    std::vector<int64_t> unused;
+    while (select->run()) {
+        if (!required.count(select->get<std::string>(1))) {
+            unused.push_back(select->get<int64_t>(0));
+        }
+    }
+
+    for (const int64_t resourceID : unused) {
+        // clang-format off
+        Statement remove = getStatement(
+            "DELETE FROM region_resources "
+            "WHERE region_id = ?1 "
+            "  AND resource_id = ?2 ");
+        // clang-format on
+
+        remove->bind(1, regionID);
+        remove->bind(2, resourceID);
+        remove->run();
+    }
+}
+
 OfflineRegionStatus OfflineDatabase::getRegionCompletedStatus(int64_t regionID) {
     OfflineRegionStatus result;
 
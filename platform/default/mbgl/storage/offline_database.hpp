@@ -8,6 +8,7 @@
 #include <mbgl/util/mapbox.hpp>
 
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <string>
 
@@ -52,6 +53,18 @@ public:
     OfflineRegionDefinition getRegionDefinition(int64_t regionID);
     OfflineRegionStatus getRegionCompletedStatus(int64_t regionID);
 
+    // The number of glyph ranges that the region requires, once its download has found out.
+    optional<uint64_t> getRegionGlyphRangeCount(int64_t regionID);
+    void setRegionGlyphRangeCount(int64_t regionID, uint64_t);
+
+    // The number of glyph ranges that the region stores.
+    uint64_t getRegionCompletedGlyphRangeCount(int64_t regionID);
+
+    // Removes the glyph ranges that aren't required anymore from the region, e.g. the ranges that
+    // regions downloaded before their count was stored have for text they don't contain. They
+    // remain in the ambient cache.
+    void removeRegionGlyphs(int64_t regionID, const std::unordered_set<std::string>& required);
+
     void setOfflineMapboxTileCountLimit(uint64_t);
     uint64_t getOfflineMapboxTileCountLimit();
     bool offlineMapboxTileCountLimitExceeded();
@@ -64,6 +77,7 @@ private:
     void removeExisting();
     void migrateToVersion3();
     void migrateToVersion5();
+    void migrateToVersion6();
 
     class Statement {
     public:
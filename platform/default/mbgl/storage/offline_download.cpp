@@ -4,25 +4,125 @@
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
 #include <mbgl/storage/http_file_source.hpp>
-#include <mbgl/style/parser.hpp>
-#include <mbgl/style/sources/vector_source.hpp>
-#include <mbgl/style/sources/raster_source.hpp>
-#include <mbgl/style/sources/geojson_source.hpp>
-#include <mbgl/style/sources/image_source.hpp>
+#include <mbgl/style/parsed_style.hpp>
+#include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/style/conversion/json.hpp>
 #include <mbgl/style/conversion/tileset.hpp>
 #include <mbgl/text/glyph.hpp>
+#include <mbgl/text/glyph_range.hpp>
+#include <mbgl/layout/symbol_layout.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/constants.hpp>
 #include <mbgl/util/mapbox.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/tile_cover.hpp>
 #include <mbgl/util/tileset.hpp>
 
+#include <algorithm>
+#include <map>
 #include <set>
 
 namespace mbgl {
 
 using namespace style;
 
+namespace {
+
+// The symbol layers of the style that have text, by the ID of the source they label.
+std::unordered_map<std::string, std::vector<Immutable<SymbolLayer::Impl>>> getTextLayers(const ParsedStyle& style) {
+    std::unordered_map<std::string, std::vector<Immutable<SymbolLayer::Impl>>> result;
+    for (const auto& layer : style.createLayers()) {
+        const SymbolLayer* symbolLayer = layer->as<SymbolLayer>();
+        if (symbolLayer && !symbolLayer->getTextField().isUndefined()) {
+            result[symbolLayer->getSourceID()].push_back(
+                staticImmutableCast<SymbolLayer::Impl>(symbolLayer->baseImpl));
+        }
+    }
+    return result;
+}
+
+// The highest zoom level that a tile is displayed at. Tiles of the highest zoom level of their
+// source are overscaled up to the highest zoom level of the region.
+uint8_t maxDisplayZoom(const OfflineRegionDefinition& definition, const Tileset& tileset, const CanonicalTileID& tileID) {
+    if (tileID.z < tileset.zoomRange.max) {
+        return tileID.z;
+    }
+    return std::max(tileID.z, static_cast<uint8_t>(std::min(definition.maxZoom, util::MAX_ZOOM)));
+}
+
+// The font stacks that a symbol layer may use for its text.
+void addFontStacks(const SymbolLayer::Impl& layer, std::set<FontStack>& fontStacks) {
+    const PropertyValue<FontStack>& textFont = layer.layout.get<TextFont>();
+    if (textFont.isUndefined()) {
+        fontStacks.insert(TextFont::defaultValue());
+    } else if (textFont.isConstant()) {
+        fontStacks.insert(textFont.asConstant());
+    } else if (textFont.isCameraFunction()) {
+        textFont.asCameraFunction().stops.match(
+            [&] (const auto& stops) {
+                for (const auto& stop : stops.stops) {
+                    fontStacks.insert(stop.second);
+                }
+            }
+        );
+    }
+}
+
+// The glyph ranges of the glyphs that the text uses, and every range of the font stacks whose
+// text isn't known in advance.
+std::map<FontStack, std::set<GlyphRange>> getGlyphRanges(const GlyphDependencies& glyphDependencies,
+                                                         const std::set<FontStack>& wholeFontStacks) {
+    std::map<FontStack, std::set<GlyphRange>> ranges;
+    for (const auto& dependency : glyphDependencies) {
+        for (const auto& glyphID : dependency.second) {
+            ranges[dependency.first].insert(getGlyphRange(glyphID));
+        }
+    }
+    for (const auto& fontStack : wholeFontStacks) {
+        for (uint32_t i = 0; i < GLYPH_RANGES_PER_FONT_STACK; i++) {
+            ranges[fontStack].insert(getGlyphRange(i * GLYPHS_PER_GLYPH_RANGE));
+        }
+    }
+    return ranges;
+}
+
+// Adds the glyphs that the layers use to label the features of a vector tile.
+void addGlyphDependencies(const std::vector<Immutable<SymbolLayer::Impl>>& layers,
+                          const Response& response,
+                          const CanonicalTileID& tileID,
+                          const uint8_t maxZoom,
+                          GlyphDependencies& glyphDependencies) {
+    if (!response.data) {
+        return;
+    }
+
+    ImageDependencies imageDependencies;
+    try {
+        VectorTileData data(response.data);
+        for (const auto& layer : layers) {
+            std::unique_ptr<GeometryTileLayer> tileLayer = data.getLayer(layer->sourceLayer);
+            if (!tileLayer) {
+                continue;
+            }
+
+            // Text that depends on the zoom level is laid out again for every zoom level
+            // that the tile is displayed at.
+            const bool zoomDependent = !layer->layout.get<TextField>().isZoomConstant() ||
+                                       !layer->layout.get<TextTransform>().isZoomConstant() ||
+                                       layer->layout.get<TextFont>().isCameraFunction();
+            const uint8_t lastZoom = zoomDependent ? maxZoom : tileID.z;
+
+            for (uint8_t z = tileID.z; z <= lastZoom; z++) {
+                SymbolLayout::getDependencies(*layer, *tileLayer, z, imageDependencies, glyphDependencies);
+            }
+        }
+    } catch (...) {
+        // Tiles that can't be parsed aren't rendered either, so they don't need any glyphs.
+    }
+}
+
+} // namespace
+
 OfflineDownload::OfflineDownload(int64_t id_,
                                  OfflineRegionDefinition&& definition_,
                                  OfflineDatabase& offlineDatabase_,
@@ -69,13 +169,12 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
         return result;
     }
 
-    style::Parser parser;
-    parser.parse(*styleResponse->data);
+    std::shared_ptr<const style::ParsedStyle> parsed = style::ParsedStyle::parse(*styleResponse->data);
 
     result.requiredResourceCountIsPrecise = true;
 
-    for (const auto& source : parser.sources) {
-        SourceType type = source->getType();
+    for (const auto& source : parsed->sourceDescriptions) {
+        SourceType type = source.type;
 
         auto handleTiledSource = [&] (const variant<std::string, Tileset>& urlOrTileset, const uint16_t tileSize) {
             if (urlOrTileset.is<Tileset>()) {
@@ -89,6 +188,7 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
                     style::conversion::Error error;
                     optional<Tileset> tileset = style::conversion::convertJSON<Tileset>(*sourceResponse->data, error);
                     if (tileset) {
+                        util::mapbox::canonicalizeTileset(*tileset, url, type, tileSize);
                         result.requiredResourceCount +=
                             definition.tileCover(type, tileSize, (*tileset).zoomRange).size();
                     }
@@ -99,33 +199,17 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
         };
 
         switch (type) {
-        case SourceType::Vector: {
-            const auto& vectorSource = *source->as<VectorSource>();
-            handleTiledSource(vectorSource.getURLOrTileset(), util::tileSize);
-            break;
-        }
-
-        case SourceType::Raster: {
-            const auto& rasterSource = *source->as<RasterSource>();
-            handleTiledSource(rasterSource.getURLOrTileset(), rasterSource.getTileSize());
+        case SourceType::Vector:
+        case SourceType::Raster:
+            handleTiledSource(*source.urlOrTileset, source.tileSize);
             break;
-        }
 
-        case SourceType::GeoJSON: {
-            const auto& geojsonSource = *source->as<GeoJSONSource>();
-            if (geojsonSource.getURL()) {
+        case SourceType::GeoJSON:
+        case SourceType::Image:
+            if (source.url) {
                 result.requiredResourceCount += 1;
             }
             break;
-        }
-
-        case SourceType::Image: {
-            const auto& imageSource = *source->as<ImageSource>();
-            if (imageSource.getURL()) {
-                result.requiredResourceCount += 1;
-            }
-            break;
-        }
 
         case SourceType::Video:
         case SourceType::Annotations:
@@ -133,11 +217,21 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
         }
     }
 
-    if (!parser.glyphURL.empty()) {
-        result.requiredResourceCount += parser.fontStacks().size() * GLYPH_RANGES_PER_FONT_STACK;
+    // The glyph ranges depend on the text of the tiles, so they're only known once a download
+    // has read all of them.
+    if (!parsed->glyphURL.empty() && !parsed->fontStacks.empty()) {
+        optional<uint64_t> glyphRangeCount = offlineDatabase.getRegionGlyphRangeCount(id);
+        if (glyphRangeCount) {
+            result.requiredGlyphRangeCount = *glyphRangeCount;
+        } else {
+            // The ranges that the download stored for the tiles it read so far.
+            result.requiredGlyphRangeCount = offlineDatabase.getRegionCompletedGlyphRangeCount(id);
+            result.requiredResourceCountIsPrecise = false;
+        }
+        result.requiredResourceCount += result.requiredGlyphRangeCount;
     }
 
-    if (!parser.spriteURL.empty()) {
+    if (!parsed->spriteURL.empty()) {
         result.requiredResourceCount += 2;
     }
 
@@ -149,20 +243,22 @@ void OfflineDownload::activateDownload() {
     status.downloadState = OfflineRegionDownloadState::Active;
     status.requiredResourceCount++;
     ensureResource(Resource::style(definition.styleURL), [&](Response styleResponse) {
-        status.requiredResourceCountIsPrecise = true;
+        std::shared_ptr<const style::ParsedStyle> parsed = style::ParsedStyle::parse(*styleResponse.data);
 
-        style::Parser parser;
-        parser.parse(*styleResponse.data);
+        glyphURL = parsed->glyphURL;
+        if (!glyphURL.empty()) {
+            textLayers = getTextLayers(*parsed);
+        }
 
-        for (const auto& source : parser.sources) {
-            SourceType type = source->getType();
+        for (const auto& source : parsed->sourceDescriptions) {
+            SourceType type = source.type;
+            const std::string sourceID = source.id;
 
             auto handleTiledSource = [&] (const variant<std::string, Tileset>& urlOrTileset, const uint16_t tileSize) {
                 if (urlOrTileset.is<Tileset>()) {
-                    queueTiles(type, tileSize, urlOrTileset.get<Tileset>());
+                    queueTiles(type, tileSize, urlOrTileset.get<Tileset>(), sourceID);
                 } else {
                     const auto& url = urlOrTileset.get<std::string>();
-                    status.requiredResourceCountIsPrecise = false;
                     status.requiredResourceCount++;
                     requiredSourceURLs.insert(url);
 
@@ -171,46 +267,39 @@ void OfflineDownload::activateDownload() {
                         optional<Tileset> tileset = style::conversion::convertJSON<Tileset>(*sourceResponse.data, error);
                         if (tileset) {
                             util::mapbox::canonicalizeTileset(*tileset, url, type, tileSize);
-                            queueTiles(type, tileSize, *tileset);
+                            queueTiles(type, tileSize, *tileset, sourceID);
 
                             requiredSourceURLs.erase(url);
-                            if (requiredSourceURLs.empty()) {
-                                status.requiredResourceCountIsPrecise = true;
-                            }
+                            queueGlyphs();
                         }
                     });
                 }
             };
 
             switch (type) {
-            case SourceType::Vector: {
-                const auto& vectorSource = *source->as<VectorSource>();
-                handleTiledSource(vectorSource.getURLOrTileset(), util::tileSize);
-                break;
-            }
-
-            case SourceType::Raster: {
-                const auto& rasterSource = *source->as<RasterSource>();
-                handleTiledSource(rasterSource.getURLOrTileset(), rasterSource.getTileSize());
+            case SourceType::Vector:
+            case SourceType::Raster:
+                handleTiledSource(*source.urlOrTileset, source.tileSize);
                 break;
-            }
 
             case SourceType::GeoJSON: {
-                const auto& geojsonSource = *source->as<GeoJSONSource>();
-                if (geojsonSource.getURL()) {
-                    queueResource(Resource::source(*geojsonSource.getURL()));
+                if (source.url) {
+                    queueResource(Resource::source(*source.url));
+                }
+                auto layers = textLayers.find(sourceID);
+                if (layers != textLayers.end()) {
+                    for (const auto& layer : layers->second) {
+                        addFontStacks(*layer, wholeFontStacks);
+                    }
                 }
                 break;
             }
 
-            case SourceType::Image: {
-                const auto& imageSource = *source->as<ImageSource>();
-                auto imageUrl = imageSource.getURL();
-                if (imageUrl && !imageUrl->empty()) {
-                    queueResource(Resource::image(*imageUrl));
+            case SourceType::Image:
+                if (source.url && !source.url->empty()) {
+                    queueResource(Resource::image(*source.url));
                 }
                 break;
-            }
 
             case SourceType::Video:
             case SourceType::Annotations:
@@ -218,18 +307,12 @@ void OfflineDownload::activateDownload() {
             }
         }
 
-        if (!parser.glyphURL.empty()) {
-            for (const auto& fontStack : parser.fontStacks()) {
-                for (char16_t i = 0; i < GLYPH_RANGES_PER_FONT_STACK; i++) {
-                    queueResource(Resource::glyphs(parser.glyphURL, fontStack, getGlyphRange(i * GLYPHS_PER_GLYPH_RANGE)));
-                }
-            }
+        if (!parsed->spriteURL.empty()) {
+            queueResource(Resource::spriteImage(parsed->spriteURL, definition.pixelRatio));
+            queueResource(Resource::spriteJSON(parsed->spriteURL, definition.pixelRatio));
         }
 
-        if (!parser.spriteURL.empty()) {
-            queueResource(Resource::spriteImage(parser.spriteURL, definition.pixelRatio));
-            queueResource(Resource::spriteJSON(parser.spriteURL, definition.pixelRatio));
-        }
+        queueGlyphs();
 
         continueDownload();
     });
@@ -253,13 +336,13 @@ void OfflineDownload::activateDownload() {
    the first few errors is fruitless anyway.
 */
 void OfflineDownload::continueDownload() {
-    if (resourcesRemaining.empty() && status.complete()) {
+    if (resourcesRemaining.empty() && (status.complete() || (tileCountLimitExceeded && requests.empty()))) {
         setState(OfflineRegionDownloadState::Inactive);
         return;
     }
 
     while (!resourcesRemaining.empty() && requests.size() < HTTPFileSource::maximumConcurrentRequests()) {
-        ensureResource(resourcesRemaining.front());
+        ensureResource(resourcesRemaining.front().first, resourcesRemaining.front().second);
         resourcesRemaining.pop_front();
     }
 }
@@ -268,21 +351,86 @@ void OfflineDownload::deactivateDownload() {
     requiredSourceURLs.clear();
     resourcesRemaining.clear();
     requests.clear();
+
+    textLayers.clear();
+    glyphURL.clear();
+    glyphDependencies.clear();
+    wholeFontStacks.clear();
+    queuedGlyphRanges.clear();
+    queuedGlyphURLs.clear();
+    tilesToRead = 0;
+    glyphRangesCounted = false;
+    tileCountLimitExceeded = false;
 }
 
-void OfflineDownload::queueResource(Resource resource) {
+void OfflineDownload::queueResource(Resource resource, std::function<void (Response)> callback) {
     status.requiredResourceCount++;
-    resourcesRemaining.push_front(std::move(resource));
+    resourcesRemaining.emplace_front(std::move(resource), std::move(callback));
 }
 
-void OfflineDownload::queueTiles(SourceType type, uint16_t tileSize, const Tileset& tileset) {
+void OfflineDownload::queueTiles(SourceType type, uint16_t tileSize, const Tileset& tileset, const std::string& sourceID) {
+    auto layers = textLayers.find(sourceID);
+
     for (const auto& tile : definition.tileCover(type, tileSize, tileset.zoomRange)) {
         status.requiredResourceCount++;
-        resourcesRemaining.push_back(
-            Resource::tile(tileset.tiles[0], definition.pixelRatio, tile.x, tile.y, tile.z, tileset.scheme));
+
+        std::function<void (Response)> callback;
+        if (layers != textLayers.end()) {
+            tilesToRead++;
+            const uint8_t maxZoom = maxDisplayZoom(definition, tileset, tile);
+            callback = [=](Response tileResponse) {
+                addGlyphDependencies(textLayers.at(sourceID), tileResponse, tile, maxZoom, glyphDependencies);
+                tilesToRead--;
+                queueGlyphs();
+            };
+        }
+
+        resourcesRemaining.emplace_back(
+            Resource::tile(tileset.tiles[0], definition.pixelRatio, tile.x, tile.y, tile.z, tileset.scheme),
+            std::move(callback));
     }
 }
 
+/*
+   Queue the glyph ranges that the text of the tiles read so far uses, and that haven't been
+   queued yet. They are queued ahead of the remaining tiles, so that the region has the glyphs of
+   the tiles it stored even if the download stops early. Once the tiles of all sources with text
+   have been read, the number of glyph ranges is known and stored with the region. Until then,
+   the required resource count is a lower bound.
+*/
+void OfflineDownload::queueGlyphs() {
+    for (const auto& fontStackRanges : getGlyphRanges(glyphDependencies, wholeFontStacks)) {
+        for (const auto& range : fontStackRanges.second) {
+            if (!queuedGlyphRanges[fontStackRanges.first].insert(range).second) {
+                continue;
+            }
+            Resource resource = Resource::glyphs(glyphURL, fontStackRanges.first, range);
+            queuedGlyphURLs.insert(resource.url);
+            status.requiredGlyphRangeCount++;
+            queueResource(std::move(resource));
+        }
+    }
+    glyphDependencies.clear();
+    wholeFontStacks.clear();
+
+    if (glyphRangesCounted) {
+        return;
+    }
+
+    if (!requiredSourceURLs.empty() || tilesToRead > 0) {
+        status.requiredResourceCountIsPrecise = false;
+        return;
+    }
+
+    glyphRangesCounted = true;
+    status.requiredResourceCountIsPrecise = true;
+
+    // The region may hold ranges that an earlier download required, which would otherwise be
+    // counted as completed resources.
+    offlineDatabase.removeRegionGlyphs(id, queuedGlyphURLs);
+    offlineDatabase.setRegionGlyphRangeCount(id, status.requiredGlyphRangeCount);
+}
+
 void OfflineDownload::ensureResource(const Resource& resource,
                                      std::function<void(Response)> callback) {
     auto workRequestsIt = requests.insert(requests.begin(), nullptr);
@@ -354,8 +502,20 @@ void OfflineDownload::ensureResource(const Resource& resource,
 bool OfflineDownload::checkTileCountLimit(const Resource& resource) {
     if (resource.kind == Resource::Kind::Tile && util::mapbox::isMapboxURL(resource.url) &&
         offlineDatabase.offlineMapboxTileCountLimitExceeded()) {
-        observer->mapboxTileCountLimitExceeded(offlineDatabase.getOfflineMapboxTileCountLimit());
-        setState(OfflineRegionDownloadState::Inactive);
+        if (!tileCountLimitExceeded) {
+            tileCountLimitExceeded = true;
+            observer->mapboxTileCountLimitExceeded(offlineDatabase.getOfflineMapboxTileCountLimit());
+
+            // The other resources, like the glyphs of the tiles that were stored, are still
+            // downloaded.
+            resourcesRemaining.erase(
+                std::remove_if(resourcesRemaining.begin(), resourcesRemaining.end(), [] (const auto& entry) {
+                    return entry.first.kind == Resource::Kind::Tile && util::mapbox::isMapboxURL(entry.first.url);
+                }),
+                resourcesRemaining.end());
+        }
+
+        continueDownload();
         return true;
     }
 
@@ -2,11 +2,20 @@
 
 #include <mbgl/storage/offline.hpp>
 #include <mbgl/storage/resource.hpp>
+#include <mbgl/style/layers/symbol_layer.hpp>
+#include <mbgl/text/glyph.hpp>
+#include <mbgl/text/glyph_range.hpp>
+#include <mbgl/util/immutable.hpp>
 
 #include <list>
+#include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <memory>
 #include <deque>
+#include <set>
+#include <functional>
+#include <vector>
 
 namespace mbgl {
 
@@ -57,10 +66,30 @@ private:
 
     std::list<std::unique_ptr<AsyncRequest>> requests;
     std::unordered_set<std::string> requiredSourceURLs;
-    std::deque<Resource> resourcesRemaining;
+    std::deque<std::pair<Resource, std::function<void (Response)>>> resourcesRemaining;
 
-    void queueResource(Resource);
-    void queueTiles(SourceType, uint16_t tileSize, const Tileset&);
+    /*
+     * Glyphs are only downloaded for the text that the tiles of the region contain. The
+     * tiles of sources with text layers are read as they are downloaded, and the glyph
+     * ranges of their text are queued right away. GeoJSON sources aren't tiled, so all
+     * ranges of the font stacks that label them are downloaded.
+     */
+    std::unordered_map<std::string, std::vector<Immutable<style::SymbolLayer::Impl>>> textLayers;
+    std::string glyphURL;
+    GlyphDependencies glyphDependencies;
+    std::set<FontStack> wholeFontStacks;
+    std::map<FontStack, std::set<GlyphRange>> queuedGlyphRanges;
+    std::unordered_set<std::string> queuedGlyphURLs;
+    std::size_t tilesToRead = 0;
+    bool glyphRangesCounted = false;
+
+    // Once reached, the remaining Mapbox tiles are skipped, and the download stops after the
+    // other resources it has queued.
+    bool tileCountLimitExceeded = false;
+
+    void queueResource(Resource, std::function<void (Response)> = {});
+    void queueTiles(SourceType, uint16_t tileSize, const Tileset&, const std::string& sourceID);
+    void queueGlyphs();
 };
 
 } // namespace mbgl
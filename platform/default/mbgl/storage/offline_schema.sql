@@ -32,7 +32,8 @@ CREATE TABLE regions (
   definition TEXT NOT NULL,   -- JSON formatted definition of region. Regions may be of variant types:
                               -- e.g. bbox and zoom range, route path, flyTo parameters, etc. Note that
                               -- the set of tiles required for a region may span multiple sources.
-  description BLOB            -- User provided data in user-defined format
+  description BLOB,           -- User provided data in user-defined format
+  glyph_range_count INTEGER   -- Number of glyph ranges that the text of the region uses, once known
 );
 
 CREATE TABLE region_resources (
@@ -1,14 +1,20 @@
-#include <mbgl/util/compression.hpp>
 #include <mbgl/util/image.hpp>
-#include <mbgl/util/premultiply.hpp>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
 #include <boost/crc.hpp>
 #pragma GCC diagnostic pop
 
+#include <zlib.h>
+
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <future>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 #define NETWORK_BYTE_UINT32(value)                                                                 \
     char(value >> 24), char(value >> 16), char(value >> 8), char(value >> 0)
@@ -33,45 +39,425 @@ void addChunk(std::string& png, const char* type, const char* data = "", const u
     png.append(crc, 4);
 }
 
+// Unpremultiplies a row of pixels, rounding the same way as util::unpremultiply().
+void unpremultiplyRow(const uint8_t* src, uint8_t* dst, const std::size_t bytes) {
+    for (std::size_t i = 0; i < bytes; i += 4) {
+        const uint8_t a = src[i + 3];
+        if (a && a != 255) {
+            dst[i + 0] = (255 * src[i + 0] + (a / 2)) / a;
+            dst[i + 1] = (255 * src[i + 1] + (a / 2)) / a;
+            dst[i + 2] = (255 * src[i + 2] + (a / 2)) / a;
+        } else {
+            dst[i + 0] = src[i + 0];
+            dst[i + 1] = src[i + 1];
+            dst[i + 2] = src[i + 2];
+        }
+        dst[i + 3] = a;
+    }
+}
+
+inline uint8_t paethPredictor(const uint8_t a, const uint8_t b, const uint8_t c) {
+    const int p = a + b - c;
+    const int pa = std::abs(p - a);
+    const int pb = std::abs(p - b);
+    const int pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return pb <= pc ? b : c;
+}
+
+// Filters an RGBA row with each of the five PNG filter types, and appends the filter type and
+// the filtered row with the smallest sum of absolute (signed) values, which usually compresses
+// best. `scratch` holds the filtered candidates.
+void filterRow(const uint8_t* row, const uint8_t* prev, const std::size_t stride,
+               std::vector<uint8_t>& scratch, std::vector<uint8_t>& out) {
+    scratch.resize(stride * 5);
+    uint8_t* filtered[5];
+    for (std::size_t f = 0; f < 5; f++) {
+        filtered[f] = scratch.data() + f * stride;
+    }
+
+    uint32_t sums[5] = { 0, 0, 0, 0, 0 };
+    for (std::size_t i = 0; i < stride; i++) {
+        const uint8_t x = row[i];
+        const uint8_t a = i >= 4 ? row[i - 4] : 0;
+        const uint8_t b = prev[i];
+        const uint8_t c = i >= 4 ? prev[i - 4] : 0;
+
+        filtered[0][i] = x;
+        filtered[1][i] = x - a;
+        filtered[2][i] = x - b;
+        filtered[3][i] = x - ((a + b) >> 1);
+        filtered[4][i] = x - paethPredictor(a, b, c);
+
+        for (std::size_t f = 0; f < 5; f++) {
+            sums[f] += std::abs(static_cast<int8_t>(filtered[f][i]));
+        }
+    }
+
+    const std::size_t best = std::min_element(sums, sums + 5) - sums;
+    out.push_back(static_cast<uint8_t>(best));
+    out.insert(out.end(), filtered[best], filtered[best] + stride);
+}
+
+// Compresses a band of the image data as a raw deflate stream. Bands other than the last end with
+// a sync flush, which aligns them to a byte boundary so that they can be concatenated. The data
+// preceding the band is used as a dictionary, so that matches can reach back across bands.
+std::string deflateBand(const uint8_t* data, const std::size_t size, const std::size_t dictionarySize,
+                        const bool last, const int level) {
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+
+    if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("failed to initialize deflate");
+    }
+
+    if (dictionarySize) {
+        deflateSetDictionary(&stream, data - dictionarySize, uInt(dictionarySize));
+    }
+
+    stream.next_in = const_cast<Bytef*>(data);
+    stream.avail_in = uInt(size);
+
+    std::string result;
+    char out[16384];
+
+    int code;
+    do {
+        stream.next_out = reinterpret_cast<Bytef*>(out);
+        stream.avail_out = sizeof(out);
+        code = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+        result.append(out, sizeof(out) - stream.avail_out);
+    } while (code == Z_OK && stream.avail_out == 0);
+
+    deflateEnd(&stream);
+
+    if (code != (last ? Z_STREAM_END : Z_OK)) {
+        throw std::runtime_error(stream.msg ? stream.msg : "compression error");
+    }
+
+    return result;
+}
+
+// Compresses the filtered rows into a zlib stream. Large images are split into bands of rows that
+// are compressed in parallel.
+std::string compressRows(const std::vector<uint8_t>& data, const std::size_t rowBytes,
+                         const mbgl::PNGOptions& options) {
+    // Smaller bands aren't worth a thread, and lose too much compression at the band boundaries.
+    const std::size_t minBandSize = 256 * 1024;
+    const std::size_t windowSize = 32768;
+
+    const std::size_t rows = rowBytes ? data.size() / rowBytes : 0;
+    const std::size_t bandCount = std::max<std::size_t>(1, std::min(options.threads, data.size() / minBandSize));
+    const std::size_t rowsPerBand = (rows + bandCount - 1) / bandCount;
+
+    std::vector<std::future<std::string>> bands;
+    for (std::size_t band = 0; band < bandCount; band++) {
+        const std::size_t begin = std::min(rows, band * rowsPerBand) * rowBytes;
+        const std::size_t end = std::min(rows, (band + 1) * rowsPerBand) * rowBytes;
+        const bool last = band + 1 == bandCount;
+        bands.push_back(std::async(bandCount > 1 ? std::launch::async : std::launch::deferred,
+                                   [&data, begin, end, last, level = options.compressionLevel, windowSize] {
+            return deflateBand(data.data() + begin, end - begin, std::min(begin, windowSize), last, level);
+        }));
+    }
+
+    const uLong checksum = adler32(adler32(0L, Z_NULL, 0), data.data(), uInt(data.size()));
+
+    // zlib header for a 32 KB window with default compression.
+    std::string result = { char(0x78), char(0x9C) };
+    for (auto& band : bands) {
+        result += band.get();
+    }
+    const char trailer[4] = { NETWORK_BYTE_UINT32(checksum) };
+    result.append(trailer, 4);
+    return result;
+}
+
+// Unpremultiplies rows [begin, end) of the image and appends each of them, preceded by its filter
+// type. Without filters, every row uses filter type 0.
+void appendRows(const mbgl::PremultipliedImage& image, const std::size_t begin, const std::size_t end,
+                const bool useFilters, std::vector<uint8_t>& out) {
+    const std::size_t stride = image.stride();
+    std::vector<uint8_t> prev(stride, 0);
+    std::vector<uint8_t> row(stride);
+    std::vector<uint8_t> scratch;
+
+    if (useFilters && begin > 0) {
+        unpremultiplyRow(image.data.get() + (begin - 1) * stride, prev.data(), stride);
+    }
+
+    for (std::size_t y = begin; y < end; y++) {
+        unpremultiplyRow(image.data.get() + y * stride, row.data(), stride);
+        if (useFilters) {
+            filterRow(row.data(), prev.data(), stride, scratch, out);
+            std::swap(row, prev);
+        } else {
+            out.push_back(0);
+            out.insert(out.end(), row.begin(), row.end());
+        }
+    }
+}
+
+// Flat shaded images, like most rendered maps, often compress better without filters. Evenly
+// spaced groups of rows are compressed at the fastest level, with and without filters, to choose.
+bool shouldUseFilters(const mbgl::PremultipliedImage& image) {
+    const std::size_t groups = 8;
+    const std::size_t groupRows = 8;
+    const std::size_t rows = image.size.height;
+
+    std::vector<uint8_t> filtered;
+    std::vector<uint8_t> unfiltered;
+    if (rows <= groups * groupRows) {
+        appendRows(image, 0, rows, true, filtered);
+        appendRows(image, 0, rows, false, unfiltered);
+    } else {
+        for (std::size_t group = 0; group < groups; group++) {
+            const std::size_t first = group * rows / groups;
+            appendRows(image, first, first + groupRows, true, filtered);
+            appendRows(image, first, first + groupRows, false, unfiltered);
+        }
+    }
+
+    return deflateBand(filtered.data(), filtered.size(), 0, true, 1).size() <
+           deflateBand(unfiltered.data(), unfiltered.size(), 0, true, 1).size();
+}
+
+inline uint8_t channel(const uint32_t color, const int index) {
+    return color >> (index * 8);
+}
+
+struct Palette {
+    // Unassociated RGBA colors, with red in the lowest byte. Translucent colors come first, so
+    // that the tRNS chunk can omit the trailing opaque colors.
+    std::vector<uint32_t> colors;
+    std::size_t translucent = 0;
+
+    // The palette index of every pixel.
+    std::vector<uint8_t> indices;
+};
+
+// Reduces the image to at most 256 colors by median cut: the group of colors with the widest
+// channel range is repeatedly split at the median of that channel, weighted by the number of
+// pixels. Each group becomes a palette entry with the group's average color. Images with no more
+// than 256 colors are represented exactly.
+Palette quantize(const mbgl::PremultipliedImage& image) {
+    const std::size_t stride = image.stride();
+    const std::size_t pixelCount = image.size.width * image.size.height;
+
+    std::vector<uint32_t> pixels(pixelCount);
+    std::vector<uint8_t> row(stride);
+    for (std::size_t y = 0; y < image.size.height; y++) {
+        unpremultiplyRow(image.data.get() + y * stride, row.data(), stride);
+        for (std::size_t x = 0; x < image.size.width; x++) {
+            const uint8_t* p = row.data() + x * 4;
+            // All fully transparent pixels share one palette entry.
+            pixels[y * image.size.width + x] = p[3] ? uint32_t(p[0]) | uint32_t(p[1]) << 8 |
+                                                      uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24
+                                                    : 0;
+        }
+    }
+
+    struct ColorCount {
+        uint32_t color;
+        uint32_t count;
+    };
+
+    std::vector<ColorCount> colors;
+    {
+        std::unordered_map<uint32_t, uint32_t> positions;
+        for (const uint32_t pixel : pixels) {
+            auto it = positions.emplace(pixel, colors.size());
+            if (it.second) {
+                colors.push_back({ pixel, 0 });
+            }
+            colors[it.first->second].count++;
+        }
+    }
+
+    struct Box {
+        std::size_t begin;
+        std::size_t end;
+        int channel;
+        int range;
+    };
+
+    const auto measure = [&](const std::size_t begin, const std::size_t end) {
+        Box box { begin, end, 0, 0 };
+        for (int c = 0; c < 4; c++) {
+            uint8_t min = 255;
+            uint8_t max = 0;
+            for (std::size_t i = begin; i < end; i++) {
+                min = std::min(min, channel(colors[i].color, c));
+                max = std::max(max, channel(colors[i].color, c));
+            }
+            if (max - min > box.range) {
+                box.channel = c;
+                box.range = max - min;
+            }
+        }
+        return box;
+    };
+
+    std::vector<Box> boxes;
+    if (!colors.empty()) {
+        boxes.push_back(measure(0, colors.size()));
+    }
+
+    while (boxes.size() < 256) {
+        auto widest = std::max_element(boxes.begin(), boxes.end(), [](const Box& a, const Box& b) {
+            return a.range < b.range;
+        });
+        if (widest == boxes.end() || widest->range == 0) {
+            // Every box contains a single color.
+            break;
+        }
+
+        const Box box = *widest;
+        const int c = box.channel;
+        std::sort(colors.begin() + box.begin, colors.begin() + box.end, [c](const ColorCount& a, const ColorCount& b) {
+            return channel(a.color, c) < channel(b.color, c);
+        });
+
+        uint64_t total = 0;
+        for (std::size_t i = box.begin; i < box.end; i++) {
+            total += colors[i].count;
+        }
+
+        // Split at the weighted median, keeping at least one color on either side.
+        uint64_t sum = 0;
+        std::size_t split = box.begin + 1;
+        for (std::size_t i = box.begin; i + 1 < box.end; i++) {
+            sum += colors[i].count;
+            split = i + 1;
+            if (sum * 2 >= total) {
+                break;
+            }
+        }
+
+        *widest = measure(box.begin, split);
+        boxes.push_back(measure(split, box.end));
+    }
+
+    std::vector<uint32_t> averages;
+    for (const Box& box : boxes) {
+        uint64_t total = 0;
+        uint64_t sums[4] = { 0, 0, 0, 0 };
+        for (std::size_t i = box.begin; i < box.end; i++) {
+            total += colors[i].count;
+            for (int c = 0; c < 4; c++) {
+                sums[c] += uint64_t(channel(colors[i].color, c)) * colors[i].count;
+            }
+        }
+
+        uint32_t color = 0;
+        for (int c = 0; c < 4; c++) {
+            color |= uint32_t((sums[c] + total / 2) / total) << (c * 8);
+        }
+        averages.push_back(color);
+    }
+
+    // Put translucent entries first.
+    std::vector<std::size_t> order(boxes.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_partition(order.begin(), order.end(), [&](const std::size_t i) {
+        return channel(averages[i], 3) != 255;
+    });
+
+    Palette palette;
+    std::unordered_map<uint32_t, uint8_t> indices;
+    for (const std::size_t i : order) {
+        const auto index = static_cast<uint8_t>(palette.colors.size());
+        for (std::size_t j = boxes[i].begin; j < boxes[i].end; j++) {
+            indices.emplace(colors[j].color, index);
+        }
+
+        if (channel(averages[i], 3) != 255) {
+            palette.translucent = palette.colors.size() + 1;
+        }
+        palette.colors.push_back(averages[i]);
+    }
+
+    palette.indices.reserve(pixelCount);
+    for (const uint32_t pixel : pixels) {
+        palette.indices.push_back(indices[pixel]);
+    }
+
+    return palette;
+}
+
 } // namespace
 
 namespace mbgl {
 
 // Encode PNGs without libpng.
-std::string encodePNG(const PremultipliedImage& pre) {
-    // Make copy of the image so that we can unpremultiply it.
-    const auto src = util::unpremultiply(pre.clone());
+std::string encodePNG(const PremultipliedImage& src, const PNGOptions& options) {
+    // An empty image has no colors to make a palette from.
+    const bool usePalette = options.quantize && !src.size.isEmpty();
 
     // PNG magic bytes
     const char preamble[8] = { char(0x89), 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
 
-    // IHDR chunk for our RGBA image.
+    // IHDR chunk for our RGBA or palette image.
     const char ihdr[13] = {
         NETWORK_BYTE_UINT32(src.size.width),  // width
         NETWORK_BYTE_UINT32(src.size.height), // height
         8,                                    // bit depth == 8 bits
-        6,                                    // color type == RGBA
+        char(usePalette ? 3 : 6),             // color type == palette or RGBA
         0,                                    // compression method == deflate
         0,                                    // filter method == default
         0,                                    // interlace method == none
     };
 
-    // Prepare the (compressed) data chunk.
-    const auto stride = src.stride();
+    std::string plte;
+    std::string trns;
     std::string idat;
-    for (uint32_t y = 0; y < src.size.height; y++) {
-        // Every scanline needs to be prefixed with one byte that indicates the filter type.
-        idat.append(1, 0); // filter type 0
-        idat.append((const char*)(src.data.get() + y * stride), stride);
+
+    if (usePalette) {
+        const Palette palette = quantize(src);
+        for (std::size_t i = 0; i < palette.colors.size(); i++) {
+            const uint32_t color = palette.colors[i];
+            plte.append({ char(channel(color, 0)), char(channel(color, 1)), char(channel(color, 2)) });
+            if (i < palette.translucent) {
+                trns.append(1, char(channel(color, 3)));
+            }
+        }
+
+        // Filters rarely help palette images, so every scanline uses filter type 0.
+        const std::size_t width = src.size.width;
+        std::vector<uint8_t> rows;
+        rows.reserve((width + 1) * src.size.height);
+        for (std::size_t y = 0; y < src.size.height; y++) {
+            rows.push_back(0);
+            rows.insert(rows.end(), palette.indices.begin() + y * width,
+                        palette.indices.begin() + (y + 1) * width);
+        }
+        idat = compressRows(rows, width + 1, options);
+    } else {
+        // The filters are chosen from a sample, so that only the chosen rows are built for the
+        // whole image.
+        const std::size_t stride = src.stride();
+        std::vector<uint8_t> rows;
+        rows.reserve((stride + 1) * src.size.height);
+        appendRows(src, 0, src.size.height, shouldUseFilters(src), rows);
+        idat = compressRows(rows, stride + 1, options);
     }
-    idat = util::compress(idat);
 
     // Assemble the PNG.
     std::string png;
-    png.reserve((8 /* preamble */) + (12 + 13 /* IHDR */) +
-                (12 + idat.size() /* IDAT */) + (12 /* IEND */));
+    png.reserve((8 /* preamble */) + (12 + 13 /* IHDR */) + (12 + plte.size() /* PLTE */) +
+                (12 + trns.size() /* tRNS */) + (12 + idat.size() /* IDAT */) + (12 /* IEND */));
     png.append(preamble, 8);
     addChunk(png, "IHDR", ihdr, 13);
+    if (!plte.empty()) {
+        addChunk(png, "PLTE", plte.data(), static_cast<uint32_t>(plte.size()));
+    }
+    if (!trns.empty()) {
+        addChunk(png, "tRNS", trns.data(), static_cast<uint32_t>(trns.size()));
+    }
     addChunk(png, "IDAT", idat.data(), static_cast<uint32_t>(idat.size()));
     addChunk(png, "IEND");
     return png;
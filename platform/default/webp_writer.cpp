@@ -0,0 +1,31 @@
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/premultiply.hpp>
+
+#include <cstdlib>
+#include <stdexcept>
+
+extern "C"
+{
+#include <webp/encode.h>
+}
+
+namespace mbgl {
+
+std::string encodeWebP(const PremultipliedImage& pre, const int quality) {
+    // WebP stores unassociated alpha. Opaque pixels are left as they are, so this is cheap for the
+    // common case of opaque map images.
+    const auto src = util::unpremultiply(pre.clone());
+
+    uint8_t* output = nullptr;
+    const size_t size = WebPEncodeRGBA(src.data.get(), src.size.width, src.size.height,
+                                       src.stride(), quality, &output);
+    if (size == 0) {
+        throw std::runtime_error("failed to encode WebP data");
+    }
+
+    std::string webp(reinterpret_cast<const char*>(output), size);
+    std::free(output);
+    return webp;
+}
+
+} // namespace mbgl
@@ -74,9 +74,11 @@ macro(mbgl_platform_core)
         # Image handling
         PRIVATE platform/default/image.cpp
         PRIVATE platform/default/jpeg_reader.cpp
+        PRIVATE platform/default/jpeg_writer.cpp
         PRIVATE platform/default/png_writer.cpp
         PRIVATE platform/default/png_reader.cpp
         PRIVATE platform/default/webp_reader.cpp
+        PRIVATE platform/default/webp_writer.cpp
 
         # Headless view
         PRIVATE platform/default/mbgl/gl/headless_backend.cpp
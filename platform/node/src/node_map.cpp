@@ -15,6 +15,8 @@
 #include <mbgl/map/query.hpp>
 #include <mbgl/util/premultiply.hpp>
 
+#include <stdexcept>
+
 #include <unistd.h>
 
 namespace node_mbgl {
@@ -29,6 +31,8 @@ struct NodeMap::RenderOptions {
     unsigned int height = 512;
     std::vector<std::string> classes;
     mbgl::MapDebugOptions debugOptions = mbgl::MapDebugOptions::NoDebug;
+    ImageFormat format = ImageFormat::Raw;
+    int quality = 90;
 };
 
 Nan::Persistent<v8::Function> NodeMap::constructor;
@@ -151,6 +155,13 @@ void NodeMap::New(const Nan::FunctionCallbackInfo<v8::Value>& info) {
         return Nan::ThrowError("Options object 'ratio' property must be a number");
     }
 
+    if (Nan::Has(options, Nan::New("threads").ToLocalChecked()).FromJust()) {
+        auto threads = Nan::Get(options, Nan::New("threads").ToLocalChecked()).ToLocalChecked();
+        if (!threads->IsUint32() || threads->Uint32Value() == 0) {
+            return Nan::ThrowError("Options object 'threads' property must be a positive integer");
+        }
+    }
+
     info.This()->SetInternalField(1, options);
 
     try {
@@ -311,9 +322,43 @@ NodeMap::RenderOptions NodeMap::ParseOptions(v8::Local<v8::Object> obj) {
         }
     }
 
+    if (Nan::Has(obj, Nan::New("format").ToLocalChecked()).FromJust()) {
+        const std::string format { *Nan::Utf8String(Nan::Get(obj, Nan::New("format").ToLocalChecked()).ToLocalChecked()) };
+        if (format == "raw") {
+            options.format = ImageFormat::Raw;
+        } else if (format == "png") {
+            options.format = ImageFormat::PNG;
+        } else if (format == "jpeg") {
+            options.format = ImageFormat::JPEG;
+        } else if (format == "webp") {
+            options.format = ImageFormat::WebP;
+        } else {
+            throw std::invalid_argument("Unsupported image format " + format);
+        }
+    }
+
+    if (Nan::Has(obj, Nan::New("quality").ToLocalChecked()).FromJust()) {
+        options.quality = Nan::Get(obj, Nan::New("quality").ToLocalChecked()).ToLocalChecked()->IntegerValue();
+    }
+
     return options;
 }
 
+static std::string encodeImage(const mbgl::PremultipliedImage& image, NodeMap::ImageFormat format, int quality) {
+    switch (format) {
+    case NodeMap::ImageFormat::PNG:
+        return mbgl::encodePNG(image);
+    case NodeMap::ImageFormat::JPEG:
+        return mbgl::encodeJPEG(image, quality);
+    case NodeMap::ImageFormat::WebP:
+        return mbgl::encodeWebP(image, quality);
+    case NodeMap::ImageFormat::Raw:
+        break;
+    }
+    assert(false);
+    return {};
+}
+
 /**
  * Render an image from the currently-loaded style
  *
@@ -326,6 +371,8 @@ NodeMap::RenderOptions NodeMap::ParseOptions(v8::Local<v8::Object> obj) {
  * of the map
  * @param {number} [options.bearing=0] rotation
  * @param {Array<string>} [options.classes=[]] style classes
+ * @param {string} [options.format='raw'] `raw` for unencoded RGBA pixels, or `png`, `jpeg` or `webp`
+ * @param {number} [options.quality=90] quality of `jpeg` and `webp` images, from 0 to 100
  * @param {Function} callback
  * @returns {undefined} calls callback
  * @throws {Error} if stylesheet is not loaded or if map is already rendering
@@ -350,7 +397,12 @@ void NodeMap::Render(const Nan::FunctionCallbackInfo<v8::Value>& info) {
         return Nan::ThrowError("Map is currently rendering an image");
     }
 
-    auto options = ParseOptions(Nan::To<v8::Object>(info[0]).ToLocalChecked());
+    RenderOptions options;
+    try {
+        options = ParseOptions(Nan::To<v8::Object>(info[0]).ToLocalChecked());
+    } catch (const std::invalid_argument& ex) {
+        return Nan::ThrowTypeError(ex.what());
+    }
 
     assert(!nodeMap->callback);
     assert(!nodeMap->image.data);
@@ -397,15 +449,21 @@ void NodeMap::startRender(NodeMap::RenderOptions options) {
         map->setDebug(options.debugOptions);
     }
 
-    map->renderStill(*view, [this](const std::exception_ptr eptr) {
+    map->renderStill(*view, [this, format = options.format, quality = options.quality](const std::exception_ptr eptr) {
         if (eptr) {
             error = std::move(eptr);
-            uv_async_send(async);
-        } else {
+        } else if (format == ImageFormat::Raw) {
             assert(!image.data);
             image = view->readStillImage();
-            uv_async_send(async);
+        } else {
+            assert(encodedImage.empty());
+            try {
+                encodedImage = encodeImage(view->readStillImage(), format, quality);
+            } catch (...) {
+                error = std::current_exception();
+            }
         }
+        uv_async_send(async);
     });
 
     // Retain this object, otherwise it might get destructed before we are finished rendering the
@@ -430,11 +488,14 @@ void NodeMap::renderFinished() {
     // Move the callback and image out of the way so that the callback can start a new render call.
     auto cb = std::move(callback);
     auto img = std::move(image);
+    auto encoded = std::move(encodedImage);
+    encodedImage.clear();
     assert(cb);
 
     // These have to be empty to be prepared for the next render call.
     assert(!callback);
     assert(!image.data);
+    assert(encodedImage.empty());
 
     if (error) {
         std::string errorMessage;
@@ -454,6 +515,12 @@ void NodeMap::renderFinished() {
         assert(!error);
 
         cb->Call(1, argv);
+    } else if (!encoded.empty()) {
+        v8::Local<v8::Value> argv[] = {
+            Nan::Null(),
+            Nan::CopyBuffer(encoded.data(), encoded.size()).ToLocalChecked()
+        };
+        cb->Call(2, argv);
     } else if (img.data) {
         v8::Local<v8::Object> pixels = Nan::NewBuffer(
             reinterpret_cast<char *>(img.data.get()), img.bytes(),
@@ -531,7 +598,7 @@ void NodeMap::cancel() {
     auto style = map->getStyle().getJSON();
 
     map = std::make_unique<mbgl::Map>(backend, mbgl::Size{ 256, 256 },
-            pixelRatio, *this, threadpool, mbgl::MapMode::Still);
+            pixelRatio, *this, *threadpool, mbgl::MapMode::Still);
 
     // FIXME: Reload the style after recreating the map. We need to find
     // a better way of canceling an ongoing rendering on the core level
@@ -982,11 +1049,20 @@ NodeMap::NodeMap(v8::Local<v8::Object> options)
                            ->NumberValue()
                      : 1.0;
       }()),
+      threadpool([&]() -> std::shared_ptr<mbgl::Scheduler> {
+          Nan::HandleScope scope;
+          if (Nan::Has(options, Nan::New("threads").ToLocalChecked()).FromJust()) {
+              return sharedThreadPool(Nan::Get(options, Nan::New("threads").ToLocalChecked())
+                                          .ToLocalChecked()
+                                          ->Uint32Value());
+          }
+          return std::make_shared<NodeThreadPool>();
+      }()),
       map(std::make_unique<mbgl::Map>(backend,
                                       mbgl::Size{ 256, 256 },
                                       pixelRatio,
                                       *this,
-                                      threadpool,
+                                      *threadpool,
                                       mbgl::MapMode::Still)),
       async(new uv_async_t) {
 
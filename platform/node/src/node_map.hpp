@@ -26,6 +26,8 @@ public:
 class NodeMap : public Nan::ObjectWrap,
                 public mbgl::FileSource {
 public:
+    enum class ImageFormat { Raw, PNG, JPEG, WebP };
+
     struct RenderOptions;
     class RenderWorker;
 
@@ -70,11 +72,12 @@ public:
     const float pixelRatio;
     NodeBackend backend;
     std::unique_ptr<mbgl::OffscreenView> view;
-    NodeThreadPool threadpool;
+    std::shared_ptr<mbgl::Scheduler> threadpool;
     std::unique_ptr<mbgl::Map> map;
 
     std::exception_ptr error;
     mbgl::PremultipliedImage image;
+    std::string encodedImage;
     std::unique_ptr<Nan::Callback> callback;
 
     // Async for delivering the notifications of render completion.
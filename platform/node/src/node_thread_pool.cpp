@@ -2,6 +2,10 @@
 #include "util/async_queue.hpp"
 
 #include <mbgl/actor/mailbox.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+
+#include <mutex>
+#include <unordered_map>
 
 namespace node_mbgl {
 
@@ -34,4 +38,18 @@ void NodeThreadPool::Worker::WorkComplete() {
     // no-op to avoid calling nullptr callback
 }
 
+std::shared_ptr<mbgl::Scheduler> sharedThreadPool(std::size_t threads) {
+    static std::mutex mutex;
+    static std::unordered_map<std::size_t, std::weak_ptr<mbgl::Scheduler>> pools;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto pool = pools[threads].lock();
+    if (!pool) {
+        pool = std::make_shared<mbgl::ThreadPool>(threads);
+        pools[threads] = pool;
+    }
+    return pool;
+}
+
 } // namespace node_mbgl
@@ -2,6 +2,8 @@
 
 #include <mbgl/actor/scheduler.hpp>
 
+#include <memory>
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -34,4 +36,9 @@ private:
     };
 };
 
+// Returns a pool of native threads that is shared by all maps asking for one of the same size.
+// Unlike NodeThreadPool, it doesn't allocate a libuv work request for every message, and doesn't
+// compete with Node's file system and DNS requests for the libuv threadpool.
+std::shared_ptr<mbgl::Scheduler> sharedThreadPool(std::size_t threads);
+
 } // namespace node_mbgl
@@ -15,90 +15,101 @@ var params = {
     ratio: 2
 };
 
-test('Benchmark', function(t) {
-    console.time('Time');
-
-    var renderCount = 0;
-    var failureCount = 0;
-    var cancelCount = 0;
-
-    var options = {
-        request: function(req, callback) {
-            setTimeout(function() {
-                var num = Math.floor(Math.random() * 100);
-
-                if (req.url == firstRequest && num < params.failurePercentage) {
-                    callback(new Error('Failure'));
-                } else if (req.url == firstRequest && num > 99 - params.timeoutPercentage) {
-                    setTimeout(function() { callback(new Error('Timeout')); }, params.renderingTimeout * 5);
-                } else {
-                    var data = mockfs.dataForRequest(req);
-                    callback(null, { data: mockfs.dataForRequest(req) });
-                }
-            }, 0);
-        },
-        ratio: params.ratio,
-    };
-
-    var mapPool = []
+// Renders from a pool of maps concurrently, with workers on the libuv threadpool or on a native
+// pool of the given size.
+function benchmark(name, threads) {
+    test('Benchmark (' + name + ')', function(t) {
+        console.time('Time');
+
+        var renderCount = 0;
+        var failureCount = 0;
+        var cancelCount = 0;
+
+        var options = {
+            request: function(req, callback) {
+                setTimeout(function() {
+                    var num = Math.floor(Math.random() * 100);
+
+                    if (req.url == firstRequest && num < params.failurePercentage) {
+                        callback(new Error('Failure'));
+                    } else if (req.url == firstRequest && num > 99 - params.timeoutPercentage) {
+                        setTimeout(function() { callback(new Error('Timeout')); }, params.renderingTimeout * 5);
+                    } else {
+                        var data = mockfs.dataForRequest(req);
+                        callback(null, { data: mockfs.dataForRequest(req) });
+                    }
+                }, 0);
+            },
+            ratio: params.ratio,
+        };
+
+        if (threads) {
+            options.threads = threads;
+        }
 
-    for (var i = 0; i < params.mapPoolSize; ++i) {
-        var map = new mbgl.Map(options);
-        mapPool.push(map);
-    }
+        var mapPool = []
 
-    var interval = setInterval(function () {
-        if (mapPool.length == 0 || renderCount == params.numRenderings) {
-            return;
+        for (var i = 0; i < params.mapPoolSize; ++i) {
+            var map = new mbgl.Map(options);
+            mapPool.push(map);
         }
 
-        var map = mapPool.shift();
+        var interval = setInterval(function () {
+            if (mapPool.length == 0 || renderCount == params.numRenderings) {
+                return;
+            }
 
-        map.load('{ "version": 8, "sources": {}, "layers": [] }');
-        map.load(mockfs.style_vector);
+            var map = mapPool.shift();
 
-        renderCount += 1;
+            map.load('{ "version": 8, "sources": {}, "layers": [] }');
+            map.load(mockfs.style_vector);
 
-        if (renderCount % (params.numRenderings / 100) == 0) {
-            // Print some progress, so slow build bots don't timeout.
-            t.comment('Rendering (' + renderCount.toString() +
-                '/' + params.numRenderings.toString() + ')');
-        }
+            renderCount += 1;
 
-        if (renderCount == params.numRenderings) {
-            clearInterval(interval);
-            t.end();
-            console.timeEnd('Time');
-            console.log('Failures: ' + failureCount);
-            console.log('Canceled: ' + cancelCount);
+            if (renderCount % (params.numRenderings / 100) == 0) {
+                // Print some progress, so slow build bots don't timeout.
+                t.comment('Rendering (' + renderCount.toString() +
+                    '/' + params.numRenderings.toString() + ')');
+            }
 
-            return;
-        }
+            if (renderCount == params.numRenderings) {
+                clearInterval(interval);
+                t.end();
+                console.timeEnd('Time');
+                console.log('Failures: ' + failureCount);
+                console.log('Canceled: ' + cancelCount);
 
-        var mapTimeout = setTimeout(function() {
-            map.cancel();
-        }, params.renderingTimeout);
+                return;
+            }
 
-        map.render({ zoom: 16 }, function(err, pixels) {
-            clearTimeout(mapTimeout);
+            var mapTimeout = setTimeout(function() {
+                map.cancel();
+            }, params.renderingTimeout);
 
-            if (err) {
-                if (err.message == 'Failure') {
-                    failureCount += 1;
-                }
+            map.render({ zoom: 16 }, function(err, pixels) {
+                clearTimeout(mapTimeout);
 
-                if (err.message == 'Canceled') {
-                    cancelCount += 1;
-                }
+                if (err) {
+                    if (err.message == 'Failure') {
+                        failureCount += 1;
+                    }
+
+                    if (err.message == 'Canceled') {
+                        cancelCount += 1;
+                    }
 
-                // We cancel the request before it gets a
-                // timeout error from the file source.
-                if (err.message == 'Timeout') {
-                    t.fail('should never happen');
+                    // We cancel the request before it gets a
+                    // timeout error from the file source.
+                    if (err.message == 'Timeout') {
+                        t.fail('should never happen');
+                    }
                 }
-            }
 
-            mapPool.push(map);
-        });
-    }, 1);
-});
+                mapPool.push(map);
+            });
+        }, 1);
+    });
+}
+
+benchmark('libuv threadpool');
+benchmark('native threadpool', 4);
@@ -89,6 +89,32 @@ test('Map', function(t) {
         t.end();
     });
 
+    t.test('optional threads property must be a positive integer', function(t) {
+        var options = {
+            request: function() {}
+        };
+
+        options.threads = 'test';
+        t.throws(function() {
+            new mbgl.Map(options);
+        }, /Options object 'threads' property must be a positive integer/);
+
+        options.threads = 0;
+        t.throws(function() {
+            new mbgl.Map(options);
+        }, /Options object 'threads' property must be a positive integer/);
+
+        options.threads = 2;
+        t.doesNotThrow(function() {
+            var map = new mbgl.Map(options);
+            var other = new mbgl.Map(options);
+            map.release();
+            other.release();
+        });
+
+        t.end();
+    });
+
     t.test('instanceof mbgl.Map', function(t) {
         var options = {
             request: function() {},
@@ -494,6 +520,51 @@ test('Map', function(t) {
             });
         });
 
+        t.test('returns an encoded image', function(t) {
+            var signatures = {
+                png: [0x89, 0x50, 0x4E, 0x47],
+                jpeg: [0xFF, 0xD8, 0xFF],
+                webp: [0x52, 0x49, 0x46, 0x46]
+            };
+            var formats = Object.keys(signatures);
+            if (process.platform === 'darwin') {
+                // ImageIO can't write WebP images.
+                formats.pop();
+            }
+
+            var map = new mbgl.Map(options);
+            map.load(style);
+
+            function render() {
+                var format = formats.shift();
+                map.render({ format: format, quality: 80 }, function(err, data) {
+                    t.error(err);
+                    t.ok(data instanceof Buffer);
+                    t.deepEqual(Array.prototype.slice.call(data, 0, signatures[format].length), signatures[format], format);
+                    if (formats.length) {
+                        render();
+                    } else {
+                        map.release();
+                        t.end();
+                    }
+                });
+            }
+
+            render();
+        });
+
+        t.test('throws with an unsupported format', function(t) {
+            var map = new mbgl.Map(options);
+            map.load(style);
+
+            t.throws(function() {
+                map.render({ format: 'gif' }, function() {});
+            }, /Unsupported image format gif/);
+
+            map.release();
+            t.end();
+        });
+
         t.test('can be called several times in serial', function(t) {
             var completed = 0;
             var remaining = 10;
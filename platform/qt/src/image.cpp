@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/premultiply.hpp>
 
 #include <QBuffer>
 #include <QByteArray>
@@ -6,7 +7,7 @@
 
 namespace mbgl {
 
-std::string encodePNG(const PremultipliedImage& pre) {
+static std::string encodeQImage(const PremultipliedImage& pre, const char* format, int quality) {
     QImage image(pre.data.get(), pre.size.width, pre.size.height,
         QImage::Format_ARGB32_Premultiplied);
 
@@ -14,41 +15,38 @@ std::string encodePNG(const PremultipliedImage& pre) {
     QBuffer buffer(&array);
 
     buffer.open(QIODevice::WriteOnly);
-    image.rgbSwapped().save(&buffer, "PNG");
+    if (!image.rgbSwapped().save(&buffer, format, quality)) {
+        throw std::runtime_error(std::string("failed to encode ") + format + " image");
+    }
 
     return std::string(array.constData(), array.size());
 }
 
-#if !defined(QT_IMAGE_DECODERS)
-PremultipliedImage decodeJPEG(const uint8_t*, size_t);
-PremultipliedImage decodeWebP(const uint8_t*, size_t);
-#endif
+// QImage doesn't expose the PNG encoder settings, so the options are ignored.
+std::string encodePNG(const PremultipliedImage& pre, const PNGOptions&) {
+    return encodeQImage(pre, "PNG", -1);
+}
 
-PremultipliedImage decodeImage(const std::string& string) {
-    const uint8_t* data = reinterpret_cast<const uint8_t*>(string.data());
-    const size_t size = string.size();
+std::string encodeJPEG(const PremultipliedImage& pre, int quality) {
+    return encodeQImage(pre, "JPG", quality);
+}
 
-#if !defined(QT_IMAGE_DECODERS)
-    if (size >= 12) {
-        uint32_t riff_magic = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
-        uint32_t webp_magic = (data[8] << 24) | (data[9] << 16) | (data[10] << 8) | data[11];
-        if (riff_magic == 0x52494646 && webp_magic == 0x57454250) {
-            return decodeWebP(data, size);
-        }
-    }
+// Requires the Qt WebP image format plugin.
+std::string encodeWebP(const PremultipliedImage& pre, int quality) {
+    return encodeQImage(pre, "WEBP", quality);
+}
 
-    if (size >= 2) {
-        uint16_t magic = ((data[0] << 8) | data[1]) & 0xffff;
-        if (magic == 0xFFD8) {
-            return decodeJPEG(data, size);
-        }
-    }
+#if !defined(QT_IMAGE_DECODERS)
+UnassociatedImage decodeJPEG(const uint8_t*, size_t);
+UnassociatedImage decodeWebP(const uint8_t*, size_t);
 #endif
 
+template <typename T>
+static T decodeQImage(const uint8_t* data, size_t size, QImage::Format format) {
     QImage image =
         QImage::fromData(data, size)
         .rgbSwapped()
-        .convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        .convertToFormat(format);
 
     if (image.isNull()) {
         throw std::runtime_error("Unsupported image type");
@@ -60,4 +58,55 @@ PremultipliedImage decodeImage(const std::string& string) {
     return { { static_cast<uint32_t>(image.width()), static_cast<uint32_t>(image.height()) },
              std::move(img) };
 }
+
+#if !defined(QT_IMAGE_DECODERS)
+static bool isWebP(const uint8_t* data, size_t size) {
+    if (size >= 12) {
+        uint32_t riff_magic = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+        uint32_t webp_magic = (data[8] << 24) | (data[9] << 16) | (data[10] << 8) | data[11];
+        return riff_magic == 0x52494646 && webp_magic == 0x57454250;
+    }
+    return false;
+}
+
+static bool isJPEG(const uint8_t* data, size_t size) {
+    return size >= 2 && (((data[0] << 8) | data[1]) & 0xffff) == 0xFFD8;
+}
+#endif
+
+PremultipliedImage decodeImage(const std::string& string) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(string.data());
+    const size_t size = string.size();
+
+#if !defined(QT_IMAGE_DECODERS)
+    if (isWebP(data, size)) {
+        return util::premultiply(decodeWebP(data, size));
+    }
+
+    // JPEG images are opaque, so premultiplying them wouldn't change anything.
+    if (isJPEG(data, size)) {
+        UnassociatedImage image = decodeJPEG(data, size);
+        return { image.size, std::move(image.data) };
+    }
+#endif
+
+    return decodeQImage<PremultipliedImage>(data, size, QImage::Format_ARGB32_Premultiplied);
+}
+
+UnassociatedImage decodeUnassociatedImage(const std::string& string) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(string.data());
+    const size_t size = string.size();
+
+#if !defined(QT_IMAGE_DECODERS)
+    if (isWebP(data, size)) {
+        return decodeWebP(data, size);
+    }
+
+    if (isJPEG(data, size)) {
+        return decodeJPEG(data, size);
+    }
+#endif
+
+    return decodeQImage<UnassociatedImage>(data, size, QImage::Format_ARGB32);
+}
 }
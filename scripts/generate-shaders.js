@@ -8,9 +8,40 @@ const outputPath = 'src/mbgl/shaders';
 
 require('./style-code');
 
-const vertexPrelude = fs.readFileSync(path.join(inputPath, '_prelude.vertex.glsl'));
 const fragmentPrelude = fs.readFileSync(path.join(inputPath, '_prelude.fragment.glsl'));
 
+// Native only: data-driven paint property values may be read from a texture with one texel per
+// feature instead of from vertex attributes. See FeatureTexture.
+const vertexPrelude = fs.readFileSync(path.join(inputPath, '_prelude.vertex.glsl')) + `
+#ifdef HAS_FEATURE_TEXTURE
+uniform sampler2D u_feature_texture;
+uniform highp vec2 u_feature_texture_size;
+attribute highp vec2 a_feature;
+
+// The texel of the feature in the block that starts at the given row.
+highp vec4 feature_texel(const highp float row) {
+    return texture2D(u_feature_texture, (a_feature + vec2(0.5, row + 0.5)) / u_feature_texture_size);
+}
+
+// Read a pair of colors from the blocks at feature[0] and feature[1] and interpolate between them.
+vec4 feature_mix_vec4(const highp vec4 feature, const float t) {
+    return mix(feature_texel(feature[0]), feature_texel(feature[1]), t);
+}
+
+// Values other than colors are stored as 24 bit fixed point numbers between feature[2] and
+// feature[2] + feature[3].
+highp float feature_float(const highp float row, const highp vec4 feature) {
+    highp vec3 bytes = floor(feature_texel(row).rgb * 255.0 + 0.5);
+    return feature[2] + feature[3] * dot(bytes, vec3(65536.0, 256.0, 1.0)) / 16777215.0;
+}
+
+// Read a pair of values from the blocks at feature[0] and feature[1] and interpolate between them.
+float feature_mix_vec2(const highp vec4 feature, const float t) {
+    return mix(feature_float(feature[0], feature), feature_float(feature[1], feature), t);
+}
+#endif
+`;
+
 writeIfModified(path.join(outputPath, 'preludes.hpp'), `// NOTE: DO NOT CHANGE THIS FILE. IT IS AUTOMATICALLY GENERATED.
 
 #pragma once
@@ -86,13 +117,21 @@ uniform ${precision} ${type} u_${name};
             return operation === "define" ? `
 #ifndef HAS_UNIFORM_u_${name}
 uniform lowp float a_${name}_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_${name}_feature;
+#else
 attribute ${precision} ${a_type} a_${name};
+#endif
 varying ${precision} ${type} ${name};
 #else
 uniform ${precision} ${type} u_${name};
 #endif` : `
 #ifndef HAS_UNIFORM_u_${name}
+#ifdef HAS_FEATURE_TEXTURE
+    ${name} = feature_mix_${a_type}(a_${name}_feature, a_${name}_t);
+#else
     ${name} = unpack_mix_${a_type}(a_${name}, a_${name}_t);
+#endif
 #else
     ${precision} ${type} ${name} = u_${name};
 #endif`;
@@ -100,12 +139,20 @@ uniform ${precision} ${type} u_${name};
             return operation === "define" ? `
 #ifndef HAS_UNIFORM_u_${name}
 uniform lowp float a_${name}_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_${name}_feature;
+#else
 attribute ${precision} ${a_type} a_${name};
+#endif
 #else
 uniform ${precision} ${type} u_${name};
 #endif` : `
 #ifndef HAS_UNIFORM_u_${name}
+#ifdef HAS_FEATURE_TEXTURE
+    ${precision} ${type} ${name} = feature_mix_${a_type}(a_${name}_feature, a_${name}_t);
+#else
     ${precision} ${type} ${name} = unpack_mix_${a_type}(a_${name}, a_${name}_t);
+#endif
 #else
     ${precision} ${type} ${name} = u_${name};
 #endif`;
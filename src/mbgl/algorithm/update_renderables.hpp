@@ -4,6 +4,7 @@
 #include <mbgl/util/range.hpp>
 #include <mbgl/storage/resource.hpp>
 
+#include <algorithm>
 #include <unordered_set>
 
 namespace mbgl {
@@ -25,13 +26,23 @@ void updateRenderables(GetTileFn getTile,
     bool covered;
     int32_t overscaledZ;
 
+    // The ideal tiles of a pitched view have several zoom levels. Only the tiles with the highest
+    // zoom level are overscaled; the tiles in the distance use the data of their own zoom level.
+    uint8_t idealZoom = 0;
+    for (const auto& idealRenderTileID : idealTileIDs) {
+        idealZoom = std::max(idealZoom, idealRenderTileID.canonical.z);
+    }
+
     // for (all in the set of ideal tiles of the source) {
     for (const auto& idealRenderTileID : idealTileIDs) {
+        const uint8_t tileZoom =
+            idealRenderTileID.canonical.z == idealZoom ? dataTileZoom : idealRenderTileID.canonical.z;
+
         assert(idealRenderTileID.canonical.z >= zoomRange.min);
         assert(idealRenderTileID.canonical.z <= zoomRange.max);
-        assert(dataTileZoom >= idealRenderTileID.canonical.z);
+        assert(tileZoom >= idealRenderTileID.canonical.z);
 
-        const OverscaledTileID idealDataTileID(dataTileZoom, idealRenderTileID.canonical);
+        const OverscaledTileID idealDataTileID(tileZoom, idealRenderTileID.canonical);
         auto tile = getTile(idealDataTileID);
         if (!tile) {
             tile = createTile(idealDataTileID);
@@ -50,7 +61,7 @@ void updateRenderables(GetTileFn getTile,
             // The tile isn't loaded yet, but retain it anyway because it's an ideal tile.
             retainTile(*tile, Resource::Necessity::Required);
             covered = true;
-            overscaledZ = dataTileZoom + 1;
+            overscaledZ = tileZoom + 1;
             if (overscaledZ > zoomRange.max) {
                 // We're looking for an overzoomed child tile.
                 const auto childDataTileID = idealDataTileID.scaledTo(overscaledZ);
@@ -79,7 +90,7 @@ void updateRenderables(GetTileFn getTile,
 
             if (!covered) {
                 // We couldn't find child tiles that entirely cover the ideal tile.
-                for (overscaledZ = dataTileZoom - 1; overscaledZ >= zoomRange.min; --overscaledZ) {
+                for (overscaledZ = tileZoom - 1; overscaledZ >= zoomRange.min; --overscaledZ) {
                     const auto parentDataTileID = idealDataTileID.scaledTo(overscaledZ);
                     const auto parentRenderTileID =
                         parentDataTileID.unwrapTo(idealRenderTileID.wrap);
@@ -8,9 +8,12 @@
 #include <mbgl/style/layers/symbol_layer.hpp>
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/storage/file_source.hpp>
+#include <mbgl/util/tile_coordinate.hpp>
 
 #include <boost/function_output_iterator.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
 using namespace style;
@@ -46,18 +49,21 @@ void AnnotationManager::add(const AnnotationID& id, const SymbolAnnotation& anno
     auto impl = std::make_shared<SymbolAnnotationImpl>(id, annotation);
     symbolTree.insert(impl);
     symbolAnnotations.emplace(id, impl);
+    invalidate(LatLngBounds::singleton({ annotation.geometry.y, annotation.geometry.x }));
 }
 
 void AnnotationManager::add(const AnnotationID& id, const LineAnnotation& annotation, const uint8_t maxZoom) {
     ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
         std::make_unique<LineAnnotationImpl>(id, annotation, maxZoom)).first->second;
     obsoleteShapeAnnotationLayers.erase(impl.layerID);
+    invalidate(impl.bounds());
 }
 
 void AnnotationManager::add(const AnnotationID& id, const FillAnnotation& annotation, const uint8_t maxZoom) {
     ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
         std::make_unique<FillAnnotationImpl>(id, annotation, maxZoom)).first->second;
     obsoleteShapeAnnotationLayers.erase(impl.layerID);
+    invalidate(impl.bounds());
 }
 
 Update AnnotationManager::update(const AnnotationID& id, const SymbolAnnotation& annotation, const uint8_t maxZoom) {
@@ -117,9 +123,12 @@ void AnnotationManager::removeAndAdd(const AnnotationID& id, const Annotation& a
 
 void AnnotationManager::remove(const AnnotationID& id) {
     if (symbolAnnotations.find(id) != symbolAnnotations.end()) {
+        const Point<double>& point = symbolAnnotations.at(id)->annotation.geometry;
+        invalidate(LatLngBounds::singleton({ point.y, point.x }));
         symbolTree.remove(symbolAnnotations.at(id));
         symbolAnnotations.erase(id);
     } else if (shapeAnnotations.find(id) != shapeAnnotations.end()) {
+        invalidate(shapeAnnotations.at(id)->bounds());
         obsoleteShapeAnnotationLayers.insert(shapeAnnotations.at(id)->layerID);
         shapeAnnotations.erase(id);
     } else {
@@ -127,6 +136,32 @@ void AnnotationManager::remove(const AnnotationID& id) {
     }
 }
 
+void AnnotationManager::invalidate(const LatLngBounds& bounds) {
+    invalidatedBounds.push_back(bounds);
+}
+
+// Returns whether a change within the given bounds may alter the contents of the tile. Shape
+// tiles include geometry within a buffer around the tile, and that buffer wraps around the
+// antimeridian, so we test the bounds against the buffered tile in all adjacent world copies.
+static bool affectsTile(const LatLngBounds& bounds, const CanonicalTileID& tileID) {
+    const double buffer = double(ShapeAnnotationImpl::tileBuffer) / util::EXTENT;
+    const double worldSize = std::pow(2.0, tileID.z);
+    const TileCoordinatePoint nw = TileCoordinate::fromLatLng(tileID.z, bounds.northwest()).p;
+    const TileCoordinatePoint se = TileCoordinate::fromLatLng(tileID.z, bounds.southeast()).p;
+
+    if (nw.y > tileID.y + 1 + buffer || se.y < tileID.y - buffer) {
+        return false;
+    }
+
+    for (const double wrap : { -worldSize, 0.0, worldSize }) {
+        if (nw.x + wrap <= tileID.x + 1 + buffer && se.x + wrap >= tileID.x - buffer) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 std::unique_ptr<AnnotationTileData> AnnotationManager::getTileData(const CanonicalTileID& tileID) {
     if (symbolAnnotations.empty() && shapeAnnotations.empty())
         return nullptr;
@@ -199,9 +234,21 @@ void AnnotationManager::updateStyle(Style::Impl& style) {
 
 void AnnotationManager::updateData() {
     std::lock_guard<std::mutex> lock(mutex);
+    if (invalidatedBounds.empty()) {
+        return;
+    }
+
+    // Only regenerate the tiles that intersect a changed annotation's old or new bounds; all
+    // other tiles keep their current data, and therefore their buckets.
     for (auto& tile : tiles) {
-        tile->setData(getTileData(tile->id.canonical));
+        const CanonicalTileID& tileID = tile->id.canonical;
+        if (std::any_of(invalidatedBounds.begin(), invalidatedBounds.end(),
+                        [&](const LatLngBounds& bounds) { return affectsTile(bounds, tileID); })) {
+            tile->setData(getTileData(tileID));
+        }
     }
+
+    invalidatedBounds.clear();
 }
 
 void AnnotationManager::addTile(AnnotationTile& tile) {
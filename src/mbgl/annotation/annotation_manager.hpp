@@ -5,6 +5,7 @@
 #include <mbgl/style/image.hpp>
 #include <mbgl/map/update.hpp>
 #include <mbgl/style/style.hpp>
+#include <mbgl/util/geo.hpp>
 #include <mbgl/util/noncopyable.hpp>
 
 #include <mutex>
@@ -15,7 +16,6 @@
 
 namespace mbgl {
 
-class LatLngBounds;
 class AnnotationTile;
 class AnnotationTileData;
 class SymbolAnnotationImpl;
@@ -56,6 +56,10 @@ private:
 
     void remove(const AnnotationID&);
 
+    // Records the region covered by an added or removed annotation, so that the next
+    // updateData() call only regenerates the tiles that intersect it.
+    void invalidate(const LatLngBounds&);
+
     std::unique_ptr<AnnotationTileData> getTileData(const CanonicalTileID&);
 
     std::mutex mutex;
@@ -76,6 +80,7 @@ private:
     std::unordered_set<std::string> obsoleteShapeAnnotationLayers;
     std::unordered_set<std::string> obsoleteImages;
     std::unordered_set<AnnotationTile*> tiles;
+    std::vector<LatLngBounds> invalidatedBounds;
 
     friend class AnnotationTile;
 };
@@ -77,4 +77,8 @@ void RenderAnnotationSource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
 
+void RenderAnnotationSource::countTiles(RenderingStats::Tiles& stats) const {
+    tilePyramid.countTiles(stats);
+}
+
 } // namespace mbgl
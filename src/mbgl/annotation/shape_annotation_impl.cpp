@@ -7,6 +7,8 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/geometry.hpp>
 
+#include <mapbox/geometry/envelope.hpp>
+
 namespace mbgl {
 
 using namespace style;
@@ -28,7 +30,7 @@ void ShapeAnnotationImpl::updateTileData(const CanonicalTileID& tileID, Annotati
         }));
         mapbox::geojsonvt::Options options;
         options.maxZoom = maxZoom;
-        options.buffer = 255u;
+        options.buffer = tileBuffer;
         options.extent = util::EXTENT;
         options.tolerance = baseTolerance;
         shapeTiler = std::make_unique<mapbox::geojsonvt::GeoJSONVT>(features, options);
@@ -57,4 +59,13 @@ void ShapeAnnotationImpl::updateTileData(const CanonicalTileID& tileID, Annotati
     }
 }
 
+LatLngBounds ShapeAnnotationImpl::bounds() const {
+    const auto box = ShapeAnnotationGeometry::visit(geometry(), [] (const auto& geom) {
+        return mapbox::geometry::envelope(geom);
+    });
+    return LatLngBounds::hull(
+        { util::clamp(box.min.y, -util::LATITUDE_MAX, util::LATITUDE_MAX), box.min.x },
+        { util::clamp(box.max.y, -util::LATITUDE_MAX, util::LATITUDE_MAX), box.max.x });
+}
+
 } // namespace mbgl
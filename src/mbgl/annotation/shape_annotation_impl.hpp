@@ -3,6 +3,7 @@
 #include <mapbox/geojsonvt.hpp>
 
 #include <mbgl/annotation/annotation.hpp>
+#include <mbgl/util/geo.hpp>
 #include <mbgl/util/geometry.hpp>
 #include <mbgl/style/style.hpp>
 
@@ -24,6 +25,13 @@ public:
 
     void updateTileData(const CanonicalTileID&, AnnotationTileData&);
 
+    // Returns the geographic extent of the annotation geometry.
+    LatLngBounds bounds() const;
+
+    // Size of the buffer around each tile, in tile units, within which shape
+    // geometry is included in the tile.
+    static constexpr uint16_t tileBuffer = 255;
+
     const AnnotationID id;
     const uint8_t maxZoom;
     const std::string layerID;
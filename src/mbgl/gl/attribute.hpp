@@ -83,9 +83,9 @@ public:
                            std::size_t attributeSize = N) {
         static_assert(std::is_standard_layout<Vertex>::value, "vertex type must use standard layout");
         return AttributeBinding<T, N> {
-            buffer.buffer,
+            buffer.buffer.getID(),
             sizeof(Vertex),
-            Vertex::attributeOffsets[attributeIndex],
+            buffer.buffer.getOffset() + Vertex::attributeOffsets[attributeIndex],
             attributeSize
         };
     }
@@ -0,0 +1,189 @@
+#include <mbgl/gl/buffer_arena.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/gl.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace mbgl {
+namespace gl {
+
+BufferRange::BufferRange(BufferArena& arena_, BufferID buffer_, std::size_t offset_, std::size_t size_)
+    : arena(&arena_), buffer(buffer_), offset(offset_), size(size_) {
+}
+
+BufferRange::BufferRange(BufferRange&& other)
+    : arena(other.arena), buffer(other.buffer), offset(other.offset), size(other.size) {
+    other.arena = nullptr;
+}
+
+BufferRange& BufferRange::operator=(BufferRange&& other) {
+    if (this != &other) {
+        release();
+        arena = other.arena;
+        buffer = other.buffer;
+        offset = other.offset;
+        size = other.size;
+        other.arena = nullptr;
+    }
+    return *this;
+}
+
+BufferRange::~BufferRange() {
+    release();
+}
+
+void BufferRange::release() {
+    if (arena) {
+        arena->release(buffer, offset, size);
+        arena = nullptr;
+    }
+}
+
+constexpr std::size_t BufferArena::alignment;
+
+BufferArena::BufferArena(Context& context_, BufferType type_, std::size_t blockSize_)
+    : context(context_), type(type_), blockSize(blockSize_) {
+}
+
+BufferRange BufferArena::allocate(const void* data, std::size_t size, bool dedicated) {
+    // Empty buffers still get a range, so that every range has a unique offset.
+    const std::size_t alignedSize = std::max((size + alignment - 1) / alignment * alignment, alignment);
+
+    Block* block = nullptr;
+    std::size_t offset = 0;
+
+    if (!dedicated && alignedSize <= blockSize) {
+        for (auto& pair : blocks) {
+            Block& candidate = pair.second;
+            if (candidate.dedicated) {
+                continue;
+            }
+
+            auto it = std::find_if(candidate.free.begin(), candidate.free.end(), [&] (const auto& range) {
+                return range.second >= alignedSize;
+            });
+            if (it != candidate.free.end()) {
+                offset = it->first;
+                const std::size_t remaining = it->second - alignedSize;
+                candidate.free.erase(it);
+                if (remaining) {
+                    candidate.free.emplace(offset + alignedSize, remaining);
+                }
+                block = &candidate;
+                break;
+            }
+        }
+    }
+
+    if (!block) {
+        dedicated = dedicated || alignedSize > blockSize;
+        block = &createBlock(dedicated ? alignedSize : blockSize, dedicated);
+        if (block->size > alignedSize) {
+            block->free.emplace(alignedSize, block->size - alignedSize);
+        }
+    }
+
+    block->used += alignedSize;
+    ranges++;
+
+    bind(block->buffer.get());
+    MBGL_CHECK_ERROR(glBufferSubData(static_cast<GLenum>(type), offset, size, data));
+    context.statistics.bufferBytesUploaded += size;
+
+    return { *this, block->buffer.get(), offset, alignedSize };
+}
+
+BufferArena::Block& BufferArena::createBlock(std::size_t size, bool dedicated) {
+    BufferID id = 0;
+    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+    UniqueBuffer buffer { std::move(id), { &context } };
+    const BufferID key = buffer.get();
+
+    bind(key);
+    MBGL_CHECK_ERROR(glBufferData(static_cast<GLenum>(type), size, nullptr, GL_STATIC_DRAW));
+    context.statistics.buffers++;
+    context.statistics.bufferBytes += size;
+
+    return blocks.emplace(key, Block(std::move(buffer), size, dedicated)).first->second;
+}
+
+void BufferArena::bind(BufferID id) {
+    if (type == BufferType::Vertex) {
+        context.vertexBuffer = id;
+    } else {
+        // Binding an element buffer changes the vertex array object that is bound.
+        context.vertexArrayObject = 0;
+        context.elementBuffer = id;
+    }
+}
+
+void BufferArena::release(BufferID id, std::size_t offset, std::size_t size) {
+    auto blockIt = blocks.find(id);
+    assert(blockIt != blocks.end());
+    Block& block = blockIt->second;
+
+    assert(block.used >= size);
+    block.used -= size;
+    ranges--;
+
+    if (block.used == 0) {
+        // Keep one empty block for the next tiles that are loaded, and delete the others.
+        const bool keep = !block.dedicated &&
+            std::none_of(blocks.begin(), blocks.end(), [&] (const auto& pair) {
+                return pair.first != id && !pair.second.dedicated && pair.second.used == 0;
+            });
+        if (!keep) {
+            context.statistics.bufferBytes -= block.size;
+            blocks.erase(blockIt);
+            return;
+        }
+
+        block.free.clear();
+        block.free.emplace(0, block.size);
+        return;
+    }
+
+    // Merge the range with adjacent free ranges.
+    auto it = block.free.emplace(offset, size).first;
+
+    auto next = std::next(it);
+    if (next != block.free.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        block.free.erase(next);
+    }
+
+    if (it != block.free.begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == it->first) {
+            prev->second += it->second;
+            block.free.erase(it);
+        }
+    }
+}
+
+void BufferArena::releaseEmptyBlocks() {
+    for (auto it = blocks.begin(); it != blocks.end();) {
+        if (it->second.used == 0) {
+            context.statistics.bufferBytes -= it->second.size;
+            it = blocks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+BufferArena::Stats BufferArena::getStats() const {
+    Stats stats;
+    stats.blocks = blocks.size();
+    stats.ranges = ranges;
+    for (const auto& pair : blocks) {
+        stats.capacity += pair.second.size;
+        stats.used += pair.second.used;
+    }
+    return stats;
+}
+
+} // namespace gl
+} // namespace mbgl
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <mbgl/gl/object.hpp>
+#include <mbgl/gl/types.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstddef>
+#include <map>
+#include <utility>
+
+namespace mbgl {
+namespace gl {
+
+class Context;
+class BufferArena;
+
+// A range of a GL buffer that holds the data of one vertex or index buffer. The range is returned
+// to its arena when it is destroyed.
+class BufferRange {
+public:
+    BufferRange() = default;
+    BufferRange(BufferArena&, BufferID, std::size_t offset, std::size_t size);
+    BufferRange(BufferRange&&);
+    BufferRange& operator=(BufferRange&&);
+    ~BufferRange();
+
+    BufferID getID() const { return buffer; }
+    std::size_t getOffset() const { return offset; }
+    std::size_t getSize() const { return size; }
+
+private:
+    void release();
+
+    BufferArena* arena = nullptr;
+    BufferID buffer = 0;
+    std::size_t offset = 0;
+    std::size_t size = 0;
+};
+
+// Sub-allocates vertex or index data from large GL buffers, so that buckets don't need a buffer
+// object of their own. Ranges that are released are reused by later allocations. Data that
+// doesn't fit into a block gets a buffer of its own.
+class BufferArena : private util::noncopyable {
+public:
+    class Stats {
+    public:
+        std::size_t blocks = 0;
+        std::size_t ranges = 0;
+        std::size_t capacity = 0;
+        std::size_t used = 0;
+    };
+
+    static constexpr std::size_t alignment = 16;
+
+    BufferArena(Context&, BufferType, std::size_t blockSize = 1024 * 1024);
+
+    // Uploads the data into a free range of one of the buffers. When `dedicated` is true, the data
+    // always gets a buffer of its own.
+    BufferRange allocate(const void* data, std::size_t size, bool dedicated = false);
+
+    // Deletes the buffers that hold no data.
+    void releaseEmptyBlocks();
+
+    Stats getStats() const;
+
+private:
+    friend class BufferRange;
+
+    class Block {
+    public:
+        Block(UniqueBuffer buffer_, std::size_t size_, bool dedicated_)
+            : buffer(std::move(buffer_)), size(size_), dedicated(dedicated_) {}
+
+        UniqueBuffer buffer;
+        std::size_t size;
+        bool dedicated;
+
+        // Maps the offsets of free ranges to their sizes.
+        std::map<std::size_t, std::size_t> free;
+        std::size_t used = 0;
+    };
+
+    Block& createBlock(std::size_t size, bool dedicated);
+    void bind(BufferID);
+    void release(BufferID, std::size_t offset, std::size_t size);
+
+    Context& context;
+    const BufferType type;
+    const std::size_t blockSize;
+
+    std::map<BufferID, Block> blocks;
+    std::size_t ranges = 0;
+};
+
+} // namespace gl
+} // namespace mbgl
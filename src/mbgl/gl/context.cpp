@@ -4,11 +4,13 @@
 #include <mbgl/gl/debugging_extension.hpp>
 #include <mbgl/gl/vertex_array_extension.hpp>
 #include <mbgl/gl/program_binary_extension.hpp>
+#include <mbgl/gl/pixel_buffer_extension.hpp>
 #include <mbgl/util/traits.hpp>
 #include <mbgl/util/std.hpp>
 #include <mbgl/util/logging.hpp>
 
 #include <cstring>
+#include <limits>
 
 namespace mbgl {
 namespace gl {
@@ -67,11 +69,22 @@ void Context::initializeExtensions(const std::function<gl::ProcAddress(const cha
 #if MBGL_HAS_BINARY_PROGRAMS
         programBinary = std::make_unique<extension::ProgramBinary>(fn);
 #endif
+#if not MBGL_USE_GLES2
+        pixelBuffer = std::make_unique<extension::PixelBuffer>(fn);
+#endif
 
         if (!supportsVertexArrays()) {
             Log::Warning(Event::OpenGL, "Not using Vertex Array Objects");
         }
     }
+
+    GLint units = 0;
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, &units));
+    maxVertexTextureImageUnits = units;
+
+    GLint size = 0;
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_MAX_TEXTURE_SIZE, &size));
+    maxTextureSize = size;
 }
 
 void Context::enableDebugging() {
@@ -92,6 +105,7 @@ void Context::enableDebugging() {
 
 UniqueShader Context::createShader(ShaderType type, const std::string& source) {
     UniqueShader result { MBGL_CHECK_ERROR(glCreateShader(static_cast<GLenum>(type))), { this } };
+    statistics.shaders++;
 
     const GLchar* sources = source.data();
     const auto lengths = static_cast<GLsizei>(source.length());
@@ -117,6 +131,7 @@ UniqueShader Context::createShader(ShaderType type, const std::string& source) {
 
 UniqueProgram Context::createProgram(ShaderID vertexShader, ShaderID fragmentShader) {
     UniqueProgram result { MBGL_CHECK_ERROR(glCreateProgram()), { this } };
+    statistics.programs++;
 
     MBGL_CHECK_ERROR(glAttachShader(result, vertexShader));
     MBGL_CHECK_ERROR(glAttachShader(result, fragmentShader));
@@ -129,6 +144,7 @@ UniqueProgram Context::createProgram(BinaryProgramFormat binaryFormat,
                                      const std::string& binaryProgram) {
     assert(supportsProgramBinaries());
     UniqueProgram result{ MBGL_CHECK_ERROR(glCreateProgram()), { this } };
+    statistics.programs++;
     MBGL_CHECK_ERROR(programBinary->programBinary(result, static_cast<GLenum>(binaryFormat),
                                                   binaryProgram.data(),
                                                   static_cast<GLint>(binaryProgram.size())));
@@ -164,29 +180,11 @@ void Context::verifyProgramLinkage(ProgramID program_) {
     throw std::runtime_error("program failed to link");
 }
 
-UniqueBuffer Context::createVertexBuffer(const void* data, std::size_t size) {
-    BufferID id = 0;
-    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
-    UniqueBuffer result { std::move(id), { this } };
-    vertexBuffer = result;
-    MBGL_CHECK_ERROR(glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
-    return result;
-}
-
-UniqueBuffer Context::createIndexBuffer(const void* data, std::size_t size) {
-    BufferID id = 0;
-    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
-    UniqueBuffer result { std::move(id), { this } };
-    vertexArrayObject = 0;
-    elementBuffer = result;
-    MBGL_CHECK_ERROR(glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
-    return result;
-}
-
 UniqueTexture Context::createTexture() {
     if (pooledTextures.empty()) {
         pooledTextures.resize(TextureMax);
         MBGL_CHECK_ERROR(glGenTextures(TextureMax, pooledTextures.data()));
+        statistics.textures += TextureMax;
     }
 
     TextureID id = pooledTextures.back();
@@ -201,6 +199,10 @@ bool Context::supportsVertexArrays() const {
            vertexArray->deleteVertexArrays;
 }
 
+bool Context::supportsVertexTextures() const {
+    return !disableVertexTextures && maxVertexTextureImageUnits > 0;
+}
+
 #if MBGL_HAS_BINARY_PROGRAMS
 bool Context::supportsProgramBinaries() const {
     return programBinary && programBinary->programBinary && programBinary->getProgramBinary;
@@ -233,18 +235,21 @@ UniqueVertexArray Context::createVertexArray() {
     assert(supportsVertexArrays());
     VertexArrayID id = 0;
     MBGL_CHECK_ERROR(vertexArray->genVertexArrays(1, &id));
+    statistics.vertexArrays++;
     return UniqueVertexArray(std::move(id), { this });
 }
 
 UniqueFramebuffer Context::createFramebuffer() {
     FramebufferID id = 0;
     MBGL_CHECK_ERROR(glGenFramebuffers(1, &id));
+    statistics.framebuffers++;
     return UniqueFramebuffer{ std::move(id), { this } };
 }
 
 UniqueRenderbuffer Context::createRenderbuffer(const RenderbufferType type, const Size size) {
     RenderbufferID id = 0;
     MBGL_CHECK_ERROR(glGenRenderbuffers(1, &id));
+    statistics.renderbuffers++;
     UniqueRenderbuffer renderbuffer{ std::move(id), { this } };
 
     bindRenderbuffer = renderbuffer;
@@ -279,6 +284,78 @@ std::unique_ptr<uint8_t[]> Context::readFramebuffer(const Size size, const Textu
 }
 
 #if not MBGL_USE_GLES2
+bool Context::supportsPixelBuffers() const {
+    return pixelBuffer &&
+           pixelBuffer->mapBuffer &&
+           pixelBuffer->unmapBuffer;
+}
+
+PixelBuffer Context::createPixelBuffer(const Size size) {
+    assert(supportsPixelBuffers());
+    BufferID id = 0;
+    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+    UniqueBuffer result { std::move(id), { this } };
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, result));
+    MBGL_CHECK_ERROR(glBufferData(GL_PIXEL_PACK_BUFFER, size.width * size.height * 4, nullptr, GL_STREAM_READ));
+    statistics.buffers++;
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+    return { size, std::move(result), {} };
+}
+
+void Context::readFramebuffer(PixelBuffer& target) {
+    assert(supportsPixelBuffers());
+    pixelStorePack = { 1 };
+
+    // With a pixel pack buffer bound, glReadPixels writes to an offset into the buffer instead
+    // of client memory, and returns without waiting for the transfer.
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, target.buffer));
+    MBGL_CHECK_ERROR(glReadPixels(0, 0, target.size.width, target.size.height, GL_RGBA,
+                                  GL_UNSIGNED_BYTE, nullptr));
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    target.fence = {};
+    if (pixelBuffer->fenceSync && pixelBuffer->clientWaitSync && pixelBuffer->deleteSync) {
+        target.fence = UniqueSync {
+            MBGL_CHECK_ERROR(pixelBuffer->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)), { this }
+        };
+    }
+}
+
+std::unique_ptr<uint8_t[]> Context::readPixelBuffer(PixelBuffer& source, const bool flip) {
+    assert(supportsPixelBuffers());
+    const size_t stride = source.size.width * 4;
+    auto data = std::make_unique<uint8_t[]>(stride * source.size.height);
+
+    // Without fences, mapping the buffer blocks until the transfer is complete.
+    if (source.fence) {
+        const GLenum result = MBGL_CHECK_ERROR(pixelBuffer->clientWaitSync(
+            *source.fence, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<uint64_t>::max()));
+        if (result == GL_WAIT_FAILED) {
+            throw std::runtime_error("failed to wait for pixel buffer transfer");
+        }
+        source.fence = {};
+    }
+
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, source.buffer));
+    const auto* pixels = reinterpret_cast<const uint8_t*>(
+        MBGL_CHECK_ERROR(pixelBuffer->mapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY)));
+    if (pixels) {
+        // Flip while copying out of the buffer, rather than in a separate pass.
+        for (size_t row = 0; row < source.size.height; row++) {
+            const size_t sourceRow = flip ? source.size.height - 1 - row : row;
+            std::memcpy(data.get() + row * stride, pixels + sourceRow * stride, stride);
+        }
+        MBGL_CHECK_ERROR(pixelBuffer->unmapBuffer(GL_PIXEL_PACK_BUFFER));
+    }
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    if (!pixels) {
+        throw std::runtime_error("failed to map pixel buffer");
+    }
+
+    return data;
+}
+
 void Context::drawPixels(const Size size, const void* data, TextureFormat format) {
     pixelStoreUnpack = { 1 };
     if (format != TextureFormat::RGBA) {
@@ -415,6 +492,19 @@ void Context::updateTexture(
     MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLenum>(format), size.width,
                                   size.height, 0, static_cast<GLenum>(format), GL_UNSIGNED_BYTE,
                                   data));
+    statistics.textureBytesUploaded +=
+        size.width * size.height * (format == TextureFormat::RGBA ? 4 : 1);
+}
+
+void Context::updateTextureRows(
+    TextureID id, const uint32_t y, const Size size, const void* data, TextureFormat format, TextureUnit unit) {
+    activeTexture = unit;
+    texture[unit] = id;
+    pixelStoreUnpack = { 1 };
+    MBGL_CHECK_ERROR(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, size.width, size.height,
+                                     static_cast<GLenum>(format), GL_UNSIGNED_BYTE, data));
+    statistics.textureBytesUploaded +=
+        size.width * size.height * (format == TextureFormat::RGBA ? 4 : 1);
 }
 
 void Context::bindTexture(Texture& obj,
@@ -463,6 +553,8 @@ void Context::bindTexture(Texture& obj,
 void Context::reset() {
     std::copy(pooledTextures.begin(), pooledTextures.end(), std::back_inserter(abandonedTextures));
     pooledTextures.resize(0);
+    vertexBufferArena.releaseEmptyBlocks();
+    indexBufferArena.releaseEmptyBlocks();
     performCleanup();
 }
 
@@ -533,7 +625,7 @@ void Context::clear(optional<mbgl::Color> color,
 
 #if not MBGL_USE_GLES2
 void Context::setDrawMode(const Points& points) {
-    pointSize = points.pointSize;
+    change(pointSize, points.pointSize);
 }
 #else
 void Context::setDrawMode(const Points&) {
@@ -541,11 +633,11 @@ void Context::setDrawMode(const Points&) {
 #endif // MBGL_USE_GLES2
 
 void Context::setDrawMode(const Lines& lines) {
-    lineWidth = lines.lineWidth;
+    change(lineWidth, lines.lineWidth);
 }
 
 void Context::setDrawMode(const LineStrip& lineStrip) {
-    lineWidth = lineStrip.lineWidth;
+    change(lineWidth, lineStrip.lineWidth);
 }
 
 void Context::setDrawMode(const Triangles&) {
@@ -556,41 +648,41 @@ void Context::setDrawMode(const TriangleStrip&) {
 
 void Context::setDepthMode(const DepthMode& depth) {
     if (depth.func == DepthMode::Always && !depth.mask) {
-        depthTest = false;
+        change(depthTest, false);
     } else {
-        depthTest = true;
-        depthFunc = depth.func;
-        depthMask = depth.mask;
-        depthRange = depth.range;
+        change(depthTest, true);
+        change(depthFunc, depth.func);
+        change(depthMask, depth.mask);
+        change(depthRange, depth.range);
     }
 }
 
 void Context::setStencilMode(const StencilMode& stencil) {
     if (stencil.test.is<StencilMode::Always>() && !stencil.mask) {
-        stencilTest = false;
+        change(stencilTest, false);
     } else {
-        stencilTest = true;
-        stencilMask = stencil.mask;
-        stencilOp = { stencil.fail, stencil.depthFail, stencil.pass };
+        change(stencilTest, true);
+        change(stencilMask, stencil.mask);
+        change(stencilOp, value::StencilOp::Type { stencil.fail, stencil.depthFail, stencil.pass });
         apply_visitor([&] (const auto& test) {
-            stencilFunc = { test.func, stencil.ref, test.mask };
+            change(stencilFunc, value::StencilFunc::Type { test.func, stencil.ref, test.mask });
         }, stencil.test);
     }
 }
 
 void Context::setColorMode(const ColorMode& color) {
     if (color.blendFunction.is<ColorMode::Replace>()) {
-        blend = false;
+        change(blend, false);
     } else {
-        blend = true;
-        blendColor = color.blendColor;
+        change(blend, true);
+        change(blendColor, color.blendColor);
         apply_visitor([&] (const auto& blendFunction) {
-            blendEquation = ColorMode::BlendEquation(blendFunction.equation);
-            blendFunc = { blendFunction.srcFactor, blendFunction.dstFactor };
+            change(blendEquation, ColorMode::BlendEquation(blendFunction.equation));
+            change(blendFunc, value::BlendFunc::Type { blendFunction.srcFactor, blendFunction.dstFactor });
         }, color.blendFunction);
     }
 
-    colorMask = color.mask;
+    change(colorMask, color.mask);
 }
 
 void Context::draw(PrimitiveType primitiveType,
@@ -610,11 +702,13 @@ void Context::performCleanup() {
         }
         MBGL_CHECK_ERROR(glDeleteProgram(id));
     }
+    statistics.programs -= abandonedPrograms.size();
     abandonedPrograms.clear();
 
     for (auto id : abandonedShaders) {
         MBGL_CHECK_ERROR(glDeleteShader(id));
     }
+    statistics.shaders -= abandonedShaders.size();
     abandonedShaders.clear();
 
     if (!abandonedBuffers.empty()) {
@@ -626,6 +720,7 @@ void Context::performCleanup() {
             }
         }
         MBGL_CHECK_ERROR(glDeleteBuffers(int(abandonedBuffers.size()), abandonedBuffers.data()));
+        statistics.buffers -= abandonedBuffers.size();
         abandonedBuffers.clear();
     }
 
@@ -636,6 +731,7 @@ void Context::performCleanup() {
             }
         }
         MBGL_CHECK_ERROR(glDeleteTextures(int(abandonedTextures.size()), abandonedTextures.data()));
+        statistics.textures -= abandonedTextures.size();
         abandonedTextures.clear();
     }
 
@@ -648,6 +744,7 @@ void Context::performCleanup() {
         }
         MBGL_CHECK_ERROR(vertexArray->deleteVertexArrays(int(abandonedVertexArrays.size()),
                                                          abandonedVertexArrays.data()));
+        statistics.vertexArrays -= abandonedVertexArrays.size();
         abandonedVertexArrays.clear();
     }
 
@@ -659,14 +756,26 @@ void Context::performCleanup() {
         }
         MBGL_CHECK_ERROR(
             glDeleteFramebuffers(int(abandonedFramebuffers.size()), abandonedFramebuffers.data()));
+        statistics.framebuffers -= abandonedFramebuffers.size();
         abandonedFramebuffers.clear();
     }
 
     if (!abandonedRenderbuffers.empty()) {
         MBGL_CHECK_ERROR(glDeleteRenderbuffers(int(abandonedRenderbuffers.size()),
                                                abandonedRenderbuffers.data()));
+        statistics.renderbuffers -= abandonedRenderbuffers.size();
         abandonedRenderbuffers.clear();
     }
+
+#if not MBGL_USE_GLES2
+    if (!abandonedSyncs.empty()) {
+        assert(pixelBuffer && pixelBuffer->deleteSync);
+        for (const auto id : abandonedSyncs) {
+            MBGL_CHECK_ERROR(pixelBuffer->deleteSync(id));
+        }
+        abandonedSyncs.clear();
+    }
+#endif // MBGL_USE_GLES2
 }
 
 } // namespace gl
@@ -7,6 +7,7 @@
 #include <mbgl/gl/texture.hpp>
 #include <mbgl/gl/renderbuffer.hpp>
 #include <mbgl/gl/framebuffer.hpp>
+#include <mbgl/gl/pixel_buffer.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/gl/types.hpp>
@@ -17,6 +18,7 @@
 #include <mbgl/util/noncopyable.hpp>
 
 
+#include <cassert>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -30,14 +32,21 @@ class View;
 namespace gl {
 
 constexpr size_t TextureMax = 64;
+
+// The texture unit that textures read by vertex shaders are bound to, after the units used by the
+// fragment shaders.
+constexpr TextureUnit VertexTextureUnit = 2;
 using ProcAddress = void (*)();
 
 namespace extension {
 class VertexArray;
 class Debugging;
 class ProgramBinary;
+class PixelBuffer;
 } // namespace extension
 
+class DrawQueue;
+
 class Context : private util::noncopyable {
 public:
     Context();
@@ -57,6 +66,13 @@ public:
     bool supportsVertexArrays() const;
     UniqueVertexArray createVertexArray();
 
+    // Whether vertex shaders can read textures. Textures may be at most maxTextureSize pixels wide
+    // and high.
+    bool supportsVertexTextures() const;
+    uint32_t getMaxTextureSize() const {
+        return maxTextureSize;
+    }
+
 #if MBGL_HAS_BINARY_PROGRAMS
     bool supportsProgramBinaries() const;
 #else
@@ -68,14 +84,14 @@ public:
     VertexBuffer<Vertex, DrawMode> createVertexBuffer(VertexVector<Vertex, DrawMode>&& v) {
         return VertexBuffer<Vertex, DrawMode> {
             v.vertexSize(),
-            createVertexBuffer(v.data(), v.byteSize())
+            vertexBufferArena.allocate(v.data(), v.byteSize(), disableBufferArena)
         };
     }
 
     template <class DrawMode>
     IndexBuffer<DrawMode> createIndexBuffer(IndexVector<DrawMode>&& v) {
         return IndexBuffer<DrawMode> {
-            createIndexBuffer(v.data(), v.byteSize())
+            indexBufferArena.allocate(v.data(), v.byteSize(), disableBufferArena)
         };
     }
 
@@ -106,6 +122,25 @@ public:
         return { size, readFramebuffer(size, format, flip) };
     }
 
+#if not MBGL_USE_GLES2
+    bool supportsPixelBuffers() const;
+    PixelBuffer createPixelBuffer(Size);
+
+    // Starts reading the framebuffer into the pixel buffer. This returns without waiting for
+    // rendering to finish, so that further rendering can be issued while the pixels are
+    // transferred.
+    void readFramebuffer(PixelBuffer&);
+
+    // Waits for the read to complete and returns the pixels.
+    template <typename Image>
+    Image readPixelBuffer(PixelBuffer& source, bool flip = true) {
+        static_assert(Image::channels == 4, "image format mismatch");
+        return { source.size, readPixelBuffer(source, flip) };
+    }
+#else
+    constexpr bool supportsPixelBuffers() const { return false; }
+#endif // MBGL_USE_GLES2
+
 #if not MBGL_USE_GLES2
     template <typename Image>
     void drawPixels(const Image& image) {
@@ -128,6 +163,16 @@ public:
         obj.size = image.size;
     }
 
+    // Uploads only the rows [y, y + height) of an image to a texture of the same size.
+    template <typename Image>
+    void updateTextureRows(Texture& obj, const Image& image, uint32_t y, uint32_t height, TextureUnit unit = 0) {
+        assert(obj.size == image.size);
+        assert(y + height <= image.size.height);
+        auto format = image.channels == 4 ? TextureFormat::RGBA : TextureFormat::Alpha;
+        updateTextureRows(obj.texture.get(), y, { image.size.width, height },
+                          image.data.get() + y * image.stride(), format, unit);
+    }
+
     // Creates an empty texture with the specified dimensions.
     Texture createTexture(const Size size,
                           TextureFormat format = TextureFormat::RGBA,
@@ -160,6 +205,35 @@ public:
               std::size_t indexOffset,
               std::size_t indexLength);
 
+    // Counts the draw calls, and the changes of program, vertex array, draw, depth, stencil and
+    // color state they required, the bytes uploaded to buffers and textures, and the GL objects
+    // that currently exist. Draw calls are counted when they are submitted, even if they are
+    // queued and issued later.
+    class Statistics {
+    public:
+        std::size_t drawCalls = 0;
+        std::size_t stateChanges = 0;
+
+        std::size_t bufferBytesUploaded = 0;
+        std::size_t textureBytesUploaded = 0;
+
+        // Storage of the buffers that hold vertex and index data.
+        std::size_t bufferBytes = 0;
+
+        std::size_t programs = 0;
+        std::size_t shaders = 0;
+        std::size_t buffers = 0;
+        std::size_t textures = 0;
+        std::size_t vertexArrays = 0;
+        std::size_t framebuffers = 0;
+        std::size_t renderbuffers = 0;
+    };
+
+    Statistics statistics;
+
+    // While set, programs record their draws in this queue instead of issuing them.
+    DrawQueue* drawQueue = nullptr;
+
     // Actually remove the objects we marked as abandoned with the above methods.
     // Only call this while the OpenGL context is exclusive to this thread.
     void performCleanup();
@@ -175,7 +249,8 @@ public:
             && abandonedBuffers.empty()
             && abandonedTextures.empty()
             && abandonedVertexArrays.empty()
-            && abandonedFramebuffers.empty();
+            && abandonedFramebuffers.empty()
+            && abandonedSyncs.empty();
     }
 
     void setDirtyState();
@@ -194,13 +269,18 @@ private:
 #if MBGL_HAS_BINARY_PROGRAMS
     std::unique_ptr<extension::ProgramBinary> programBinary;
 #endif
+#if not MBGL_USE_GLES2
+    std::unique_ptr<extension::PixelBuffer> pixelBuffer;
+#endif
+    uint32_t maxVertexTextureImageUnits = 0;
+    uint32_t maxTextureSize = 0;
 
 public:
     State<value::ActiveTexture> activeTexture;
     State<value::BindFramebuffer> bindFramebuffer;
     State<value::Viewport> viewport;
     State<value::ScissorTest> scissorTest;
-    std::array<State<value::BindTexture>, 2> texture;
+    std::array<State<value::BindTexture>, 3> texture;
     State<value::BindVertexArray, const Context&> vertexArrayObject { *this };
     State<value::Program> program;
     State<value::BindVertexBuffer> vertexBuffer;
@@ -239,13 +319,23 @@ private:
     State<value::PointSize> pointSize;
 #endif // MBGL_USE_GLES2
 
-    UniqueBuffer createVertexBuffer(const void* data, std::size_t size);
-    UniqueBuffer createIndexBuffer(const void* data, std::size_t size);
+    template <class S, class Value>
+    void change(S& state, const Value& value) {
+        if (state != value) {
+            statistics.stateChanges++;
+            state = value;
+        }
+    }
+
     UniqueTexture createTexture(Size size, const void* data, TextureFormat, TextureUnit);
     void updateTexture(TextureID, Size size, const void* data, TextureFormat, TextureUnit);
+    void updateTextureRows(TextureID, uint32_t y, Size size, const void* data, TextureFormat, TextureUnit);
     UniqueFramebuffer createFramebuffer();
     UniqueRenderbuffer createRenderbuffer(RenderbufferType, Size size);
     std::unique_ptr<uint8_t[]> readFramebuffer(Size, TextureFormat, bool flip);
+#if not MBGL_USE_GLES2
+    std::unique_ptr<uint8_t[]> readPixelBuffer(PixelBuffer&, bool flip);
+#endif // MBGL_USE_GLES2
 #if not MBGL_USE_GLES2
     void drawPixels(Size size, const void* data, TextureFormat);
 #endif // MBGL_USE_GLES2
@@ -257,6 +347,7 @@ private:
     friend detail::VertexArrayDeleter;
     friend detail::FramebufferDeleter;
     friend detail::RenderbufferDeleter;
+    friend detail::SyncDeleter;
 
     std::vector<TextureID> pooledTextures;
 
@@ -267,10 +358,19 @@ private:
     std::vector<VertexArrayID> abandonedVertexArrays;
     std::vector<FramebufferID> abandonedFramebuffers;
     std::vector<RenderbufferID> abandonedRenderbuffers;
+    std::vector<SyncID> abandonedSyncs;
 
 public:
+    // Vertex and index data are sub-allocated from a few large buffers. These must be declared
+    // after the lists of abandoned objects, which their buffers are added to when they are deleted.
+    BufferArena vertexBufferArena { *this, BufferType::Vertex };
+    BufferArena indexBufferArena { *this, BufferType::Element };
+
     // For testing
     bool disableVAOExtension = false;
+    bool disableBufferArena = false;
+    bool disableDrawSorting = false;
+    bool disableVertexTextures = false;
 };
 
 } // namespace gl
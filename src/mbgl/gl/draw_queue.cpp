@@ -0,0 +1,27 @@
+#include <mbgl/gl/draw_queue.hpp>
+
+#include <algorithm>
+#include <tuple>
+
+namespace mbgl {
+namespace gl {
+
+void DrawQueue::push(Key key, std::function<void()> issue) {
+    draws.push_back({ key, std::move(issue) });
+}
+
+void DrawQueue::flush() {
+    std::stable_sort(draws.begin(), draws.end(), [] (const Draw& a, const Draw& b) {
+        return std::tie(a.key.program, a.key.stencilRef, a.key.segments) <
+               std::tie(b.key.program, b.key.stencilRef, b.key.segments);
+    });
+
+    for (auto& draw : draws) {
+        draw.issue();
+    }
+
+    draws.clear();
+}
+
+} // namespace gl
+} // namespace mbgl
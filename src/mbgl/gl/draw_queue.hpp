@@ -0,0 +1,47 @@
+#pragma once
+
+#include <mbgl/gl/types.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace mbgl {
+namespace gl {
+
+// Records draw calls so that they can be issued in an order that requires fewer state changes.
+// Only draws whose result doesn't depend on the order they are issued in may be queued, e.g. the
+// depth tested draws of the opaque pass, where every layer has its own depth range. Draws that
+// bind textures or other state outside of Program::draw must not be queued.
+class DrawQueue : private util::noncopyable {
+public:
+    class Key {
+    public:
+        ProgramID program;
+        int32_t stencilRef;
+        const void* segments;
+    };
+
+    void push(Key, std::function<void()>);
+
+    // Issues the queued draws grouped by program, clipping mask and vertex data, and empties the
+    // queue. Draws with equal keys are issued in the order they were queued.
+    void flush();
+
+    bool empty() const {
+        return draws.empty();
+    }
+
+private:
+    class Draw {
+    public:
+        Key key;
+        std::function<void()> issue;
+    };
+
+    std::vector<Draw> draws;
+};
+
+} // namespace gl
+} // namespace mbgl
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <mbgl/gl/object.hpp>
+#include <mbgl/gl/buffer_arena.hpp>
 #include <mbgl/gl/draw_mode.hpp>
 #include <mbgl/util/ignore.hpp>
 
@@ -34,7 +34,7 @@ private:
 template <class DrawMode>
 class IndexBuffer {
 public:
-    UniqueBuffer buffer;
+    BufferRange buffer;
 };
 
 } // namespace gl
@@ -46,6 +46,11 @@ void RenderbufferDeleter::operator()(RenderbufferID id) const {
     context->abandonedRenderbuffers.push_back(id);
 }
 
+void SyncDeleter::operator()(SyncID id) const {
+    assert(context);
+    context->abandonedSyncs.push_back(id);
+}
+
 } // namespace detail
 } // namespace gl
 } // namespace mbgl
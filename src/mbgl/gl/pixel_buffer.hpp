@@ -0,0 +1,20 @@
+#pragma once
+
+#include <mbgl/gl/object.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
+
+namespace mbgl {
+namespace gl {
+
+// A buffer that framebuffer contents are read into asynchronously. While a read is in progress,
+// the fence (where supported) signals when the pixels have been transferred.
+class PixelBuffer {
+public:
+    Size size;
+    UniqueBuffer buffer;
+    optional<UniqueSync> fence;
+};
+
+} // namespace gl
+} // namespace mbgl
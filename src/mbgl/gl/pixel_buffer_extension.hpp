@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mbgl/gl/extension.hpp>
+#include <mbgl/gl/gl.hpp>
+#include <mbgl/gl/types.hpp>
+
+#if not MBGL_USE_GLES2
+
+#define GL_PIXEL_PACK_BUFFER                       0x88EB
+#define GL_STREAM_READ                             0x88E1
+#define GL_READ_ONLY                               0x88B8
+#define GL_SYNC_GPU_COMMANDS_COMPLETE              0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT                 0x00000001
+#define GL_WAIT_FAILED                             0x911D
+
+namespace mbgl {
+namespace gl {
+namespace extension {
+
+class PixelBuffer {
+public:
+    template <typename Fn>
+    PixelBuffer(const Fn& loadExtension)
+        : mapBuffer(loadExtension({
+              { "GL_ARB_pixel_buffer_object", "glMapBuffer" },
+              { "GL_EXT_pixel_buffer_object", "glMapBuffer" },
+          })),
+          unmapBuffer(loadExtension({
+              { "GL_ARB_pixel_buffer_object", "glUnmapBuffer" },
+              { "GL_EXT_pixel_buffer_object", "glUnmapBuffer" },
+          })),
+          fenceSync(loadExtension({
+              { "GL_ARB_sync", "glFenceSync" },
+          })),
+          clientWaitSync(loadExtension({
+              { "GL_ARB_sync", "glClientWaitSync" },
+          })),
+          deleteSync(loadExtension({
+              { "GL_ARB_sync", "glDeleteSync" },
+          })) {
+    }
+
+    const ExtensionFunction<GLvoid*(GLenum target, GLenum access)> mapBuffer;
+
+    const ExtensionFunction<GLboolean(GLenum target)> unmapBuffer;
+
+    const ExtensionFunction<SyncID(GLenum condition, GLbitfield flags)> fenceSync;
+
+    const ExtensionFunction<GLenum(SyncID sync, GLbitfield flags, uint64_t timeout)> clientWaitSync;
+
+    const ExtensionFunction<void(SyncID sync)> deleteSync;
+};
+
+} // namespace extension
+} // namespace gl
+} // namespace mbgl
+
+#endif
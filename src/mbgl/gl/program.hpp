@@ -3,6 +3,7 @@
 #include <mbgl/gl/types.hpp>
 #include <mbgl/gl/object.hpp>
 #include <mbgl/gl/context.hpp>
+#include <mbgl/gl/draw_queue.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/gl/attribute.hpp>
@@ -119,31 +120,73 @@ public:
               UniformValues&& uniformValues,
               AttributeBindings&& attributeBindings,
               const IndexBuffer<DrawMode>& indexBuffer,
-              const SegmentVector<Attributes>& segments) {
+              const SegmentVector<Attributes>& segments,
+              optional<TextureID> vertexTexture = {}) {
         static_assert(std::is_same<Primitive, typename DrawMode::Primitive>::value, "incompatible draw mode");
 
+        context.statistics.drawCalls += segments.size();
+
+        if (context.drawQueue) {
+            context.drawQueue->push({ program, stencilMode.ref, &segments },
+                [this, &context, drawMode, depthMode, stencilMode, colorMode,
+                 uniformValues_ = std::move(uniformValues),
+                 attributeBindings_ = std::move(attributeBindings),
+                 &indexBuffer, &segments, vertexTexture] () mutable {
+                    this->issue(context, drawMode, depthMode, stencilMode, colorMode,
+                          std::move(uniformValues_), std::move(attributeBindings_),
+                          indexBuffer, segments, vertexTexture);
+                });
+            return;
+        }
+
+        issue(context, drawMode, depthMode, stencilMode, colorMode,
+              std::move(uniformValues), std::move(attributeBindings),
+              indexBuffer, segments, vertexTexture);
+    }
+
+private:
+    template <class DrawMode>
+    void issue(Context& context,
+               DrawMode drawMode,
+               DepthMode depthMode,
+               StencilMode stencilMode,
+               ColorMode colorMode,
+               UniformValues&& uniformValues,
+               AttributeBindings&& attributeBindings,
+               const IndexBuffer<DrawMode>& indexBuffer,
+               const SegmentVector<Attributes>& segments,
+               optional<TextureID> vertexTexture) {
         context.setDrawMode(drawMode);
         context.setDepthMode(depthMode);
         context.setStencilMode(stencilMode);
         context.setColorMode(colorMode);
 
-        context.program = program;
+        if (context.program != program) {
+            context.statistics.stateChanges++;
+            context.program = program;
+        }
+
+        // The texture is bound here rather than by the caller, so that queued draws can be issued
+        // in any order.
+        if (vertexTexture && context.texture[VertexTextureUnit] != *vertexTexture) {
+            context.activeTexture = VertexTextureUnit;
+            context.texture[VertexTextureUnit] = *vertexTexture;
+        }
 
         Uniforms::bind(uniformsState, std::move(uniformValues));
 
         for (const auto& segment : segments) {
             segment.bind(context,
-                         indexBuffer.buffer,
+                         indexBuffer.buffer.getID(),
                          attributeLocations,
                          attributeBindings);
 
             context.draw(drawMode.primitiveType,
-                         segment.indexOffset,
+                         indexBuffer.buffer.getOffset() / sizeof(uint16_t) + segment.indexOffset,
                          segment.indexLength);
         }
     }
 
-private:
     UniqueProgram program;
 
     typename Uniforms::State uniformsState;
@@ -38,7 +38,10 @@ public:
                 vao = context.createVertexArray();
                 context.vertexBuffer.setDirty();
             }
-            context.vertexArrayObject = *vao;
+            if (context.vertexArrayObject != *vao) {
+                context.statistics.stateChanges++;
+                context.vertexArrayObject = *vao;
+            }
             if (indexBuffer != indexBuffer_) {
                 indexBuffer = indexBuffer_;
                 context.elementBuffer.setDirty();
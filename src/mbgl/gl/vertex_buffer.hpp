@@ -1,6 +1,6 @@
 #pragma once
 
-#include <mbgl/gl/object.hpp>
+#include <mbgl/gl/buffer_arena.hpp>
 #include <mbgl/gl/primitives.hpp>
 #include <mbgl/gl/draw_mode.hpp>
 #include <mbgl/util/ignore.hpp>
@@ -40,7 +40,7 @@ public:
     static constexpr std::size_t vertexSize = sizeof(Vertex);
 
     std::size_t vertexCount;
-    UniqueBuffer buffer;
+    BufferRange buffer;
 };
 
 } // namespace gl
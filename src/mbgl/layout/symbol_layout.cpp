@@ -38,26 +38,8 @@ static bool has(const style::SymbolLayoutProperties::PossiblyEvaluated& layout)
     );
 }
 
-SymbolLayout::SymbolLayout(const BucketParameters& parameters,
-                           const std::vector<const RenderLayer*>& layers,
-                           std::unique_ptr<GeometryTileLayer> sourceLayer_,
-                           ImageDependencies& imageDependencies,
-                           GlyphDependencies& glyphDependencies)
-    : sourceLayer(std::move(sourceLayer_)),
-      bucketName(layers.at(0)->getID()),
-      overscaling(parameters.tileID.overscaleFactor()),
-      zoom(parameters.tileID.overscaledZ),
-      mode(parameters.mode),
-      pixelRatio(parameters.pixelRatio),
-      tileSize(util::tileSize * overscaling),
-      tilePixelRatio(float(util::EXTENT) / tileSize),
-      textSize(layers.at(0)->as<RenderSymbolLayer>()->impl().layout.get<TextSize>()),
-      iconSize(layers.at(0)->as<RenderSymbolLayer>()->impl().layout.get<IconSize>())
-    {
-
-    const SymbolLayer::Impl& leader = layers.at(0)->as<RenderSymbolLayer>()->impl();
-
-    layout = leader.layout.evaluate(PropertyEvaluationParameters(zoom));
+static SymbolLayoutProperties::PossiblyEvaluated evaluateLayout(const SymbolLayer::Impl& impl, const float zoom) {
+    SymbolLayoutProperties::PossiblyEvaluated layout = impl.layout.evaluate(PropertyEvaluationParameters(zoom));
 
     if (layout.get<IconRotationAlignment>() == AlignmentType::Auto) {
         if (layout.get<SymbolPlacement>() == SymbolPlacementType::Line) {
@@ -80,6 +62,103 @@ SymbolLayout::SymbolLayout(const BucketParameters& parameters,
         layout.get<TextPitchAlignment>() = layout.get<TextRotationAlignment>();
     }
 
+    return layout;
+}
+
+static std::string getTokenValue(const GeometryTileFeature& feature, const std::string& key) {
+    auto value = feature.getValue(key);
+    if (!value)
+        return std::string();
+    if (value->is<std::string>())
+        return value->get<std::string>();
+    if (value->is<bool>())
+        return value->get<bool>() ? "true" : "false";
+    if (value->is<int64_t>())
+        return util::toString(value->get<int64_t>());
+    if (value->is<uint64_t>())
+        return util::toString(value->get<uint64_t>());
+    if (value->is<double>())
+        return util::toString(value->get<double>());
+    return "null";
+}
+
+static std::u16string getText(const SymbolLayoutProperties::PossiblyEvaluated& layout,
+                              const float zoom,
+                              const GeometryTileFeature& feature) {
+    std::string u8string = layout.evaluate<TextField>(zoom, feature);
+    if (layout.get<TextField>().isConstant()) {
+        u8string = util::replaceTokens(u8string, [&] (const std::string& key) {
+            return getTokenValue(feature, key);
+        });
+    }
+
+    auto textTransform = layout.evaluate<TextTransform>(zoom, feature);
+
+    if (textTransform == TextTransformType::Uppercase) {
+        u8string = platform::uppercase(u8string);
+    } else if (textTransform == TextTransformType::Lowercase) {
+        u8string = platform::lowercase(u8string);
+    }
+
+    return applyArabicShaping(util::utf8_to_utf16::convert(u8string));
+}
+
+static std::string getIcon(const SymbolLayoutProperties::PossiblyEvaluated& layout,
+                           const float zoom,
+                           const GeometryTileFeature& feature) {
+    std::string icon = layout.evaluate<IconImage>(zoom, feature);
+    if (layout.get<IconImage>().isConstant()) {
+        icon = util::replaceTokens(icon, [&] (const std::string& key) {
+            return getTokenValue(feature, key);
+        });
+    }
+    return icon;
+}
+
+static void addGlyphDependencies(const SymbolLayoutProperties::PossiblyEvaluated& layout,
+                                 const std::u16string& text,
+                                 GlyphDependencies& glyphDependencies) {
+    if (text.empty()) {
+        return;
+    }
+
+    const bool canVerticalizeText = layout.get<TextRotationAlignment>() == AlignmentType::Map
+                                 && layout.get<SymbolPlacement>() == SymbolPlacementType::Line
+                                 && util::i18n::allowsVerticalWritingMode(text);
+
+    // Loop through all characters of this text and collect unique codepoints.
+    GlyphIDs& glyphIDs = glyphDependencies[layout.get<TextFont>()];
+    for (char16_t chr : text) {
+        glyphIDs.insert(chr);
+        if (canVerticalizeText) {
+            if (char16_t verticalChr = util::i18n::verticalizePunctuation(chr)) {
+                glyphIDs.insert(verticalChr);
+            }
+        }
+    }
+}
+
+SymbolLayout::SymbolLayout(const BucketParameters& parameters,
+                           const std::vector<const RenderLayer*>& layers,
+                           std::unique_ptr<GeometryTileLayer> sourceLayer_,
+                           ImageDependencies& imageDependencies,
+                           GlyphDependencies& glyphDependencies)
+    : sourceLayer(std::move(sourceLayer_)),
+      bucketName(layers.at(0)->getID()),
+      overscaling(parameters.tileID.overscaleFactor()),
+      zoom(parameters.tileID.overscaledZ),
+      mode(parameters.mode),
+      pixelRatio(parameters.pixelRatio),
+      tileSize(util::tileSize * overscaling),
+      tilePixelRatio(float(util::EXTENT) / tileSize),
+      textSize(layers.at(0)->as<RenderSymbolLayer>()->impl().layout.get<TextSize>()),
+      iconSize(layers.at(0)->as<RenderSymbolLayer>()->impl().layout.get<IconSize>())
+    {
+
+    const SymbolLayer::Impl& leader = layers.at(0)->as<RenderSymbolLayer>()->impl();
+
+    layout = evaluateLayout(leader, zoom);
+
     const bool hasText = has<TextField>(layout) && !layout.get<TextFont>().empty();
     const bool hasIcon = has<IconImage>(layout);
 
@@ -105,59 +184,13 @@ SymbolLayout::SymbolLayout(const BucketParameters& parameters,
 
         ft.index = i;
 
-        auto getValue = [&ft](const std::string& key) -> std::string {
-            auto value = ft.getValue(key);
-            if (!value)
-                return std::string();
-            if (value->is<std::string>())
-                return value->get<std::string>();
-            if (value->is<bool>())
-                return value->get<bool>() ? "true" : "false";
-            if (value->is<int64_t>())
-                return util::toString(value->get<int64_t>());
-            if (value->is<uint64_t>())
-                return util::toString(value->get<uint64_t>());
-            if (value->is<double>())
-                return util::toString(value->get<double>());
-            return "null";
-        };
-        
         if (hasText) {
-            std::string u8string = layout.evaluate<TextField>(zoom, ft);
-            if (layout.get<TextField>().isConstant()) {
-                u8string = util::replaceTokens(u8string, getValue);
-            }
-            
-            auto textTransform = layout.evaluate<TextTransform>(zoom, ft);
-
-            if (textTransform == TextTransformType::Uppercase) {
-                u8string = platform::uppercase(u8string);
-            } else if (textTransform == TextTransformType::Lowercase) {
-                u8string = platform::lowercase(u8string);
-            }
-
-            ft.text = applyArabicShaping(util::utf8_to_utf16::convert(u8string));
-            const bool canVerticalizeText = layout.get<TextRotationAlignment>() == AlignmentType::Map
-                                         && layout.get<SymbolPlacement>() == SymbolPlacementType::Line
-                                         && util::i18n::allowsVerticalWritingMode(*ft.text);
-
-            // Loop through all characters of this text and collect unique codepoints.
-            for (char16_t chr : *ft.text) {
-                glyphDependencies[layout.get<TextFont>()].insert(chr);
-                if (canVerticalizeText) {
-                    if (char16_t verticalChr = util::i18n::verticalizePunctuation(chr)) {
-                        glyphDependencies[layout.get<TextFont>()].insert(verticalChr);
-                    }
-                }
-            }
+            ft.text = getText(layout, zoom, ft);
+            addGlyphDependencies(layout, *ft.text, glyphDependencies);
         }
 
         if (hasIcon) {
-            std::string icon = layout.evaluate<IconImage>(zoom, ft);
-            if (layout.get<IconImage>().isConstant()) {
-                icon = util::replaceTokens(icon, getValue);
-            }
-            ft.icon = icon;
+            ft.icon = getIcon(layout, zoom, ft);
             imageDependencies.insert(*ft.icon);
         }
 
@@ -171,6 +204,36 @@ SymbolLayout::SymbolLayout(const BucketParameters& parameters,
     }
 }
 
+void SymbolLayout::getDependencies(const SymbolLayer::Impl& impl,
+                                   const GeometryTileLayer& tileLayer,
+                                   const float tileZoom,
+                                   ImageDependencies& imageDependencies,
+                                   GlyphDependencies& glyphDependencies) {
+    const SymbolLayoutProperties::PossiblyEvaluated properties = evaluateLayout(impl, tileZoom);
+
+    const bool hasText = has<TextField>(properties) && !properties.get<TextFont>().empty();
+    const bool hasIcon = has<IconImage>(properties);
+
+    if (!hasText && !hasIcon) {
+        return;
+    }
+
+    const size_t featureCount = tileLayer.featureCount();
+    for (size_t i = 0; i < featureCount; ++i) {
+        auto feature = tileLayer.getFeature(i);
+        if (!impl.filter(feature->getType(), feature->getID(), [&] (const auto& key) { return feature->getValue(key); }))
+            continue;
+
+        if (hasText) {
+            addGlyphDependencies(properties, getText(properties, tileZoom, *feature), glyphDependencies);
+        }
+
+        if (hasIcon) {
+            imageDependencies.insert(getIcon(properties, tileZoom, *feature));
+        }
+    }
+}
+
 bool SymbolLayout::hasSymbolInstances() const {
     return !symbolInstances.empty();
 }
@@ -40,6 +40,14 @@ public:
 
     bool hasSymbolInstances() const;
 
+    // Collects the images and glyphs that the layer uses to label the features of the source
+    // layer at the given zoom, without laying out any symbols.
+    static void getDependencies(const style::SymbolLayer::Impl&,
+                                const GeometryTileLayer&,
+                                float zoom,
+                                ImageDependencies&,
+                                GlyphDependencies&);
+
     std::map<std::string,
         std::pair<style::IconPaintProperties::PossiblyEvaluated, style::TextPaintProperties::PossiblyEvaluated>> layerPaintProperties;
 
@@ -17,6 +17,7 @@
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/exception.hpp>
 #include <mbgl/util/async_task.hpp>
+#include <mbgl/util/constants.hpp>
 #include <mbgl/util/mapbox.hpp>
 #include <mbgl/util/tile_coordinate.hpp>
 #include <mbgl/actor/scheduler.hpp>
@@ -43,6 +44,18 @@ struct StillImageRequest {
     Map::StillImageCallback callback;
 };
 
+struct StillImageBatch {
+    StillImageBatch(View& view_, std::vector<CameraOptions>&& cameras_, Map::StillImageBatchCallback&& callback_)
+        : view(view_), cameras(std::move(cameras_)), callback(std::move(callback_)) {
+    }
+
+    View& view;
+    const std::vector<CameraOptions> cameras;
+    Map::StillImageBatchCallback callback;
+    std::size_t index = 0;
+    TimePoint start;
+};
+
 class Map::Impl : public style::Observer,
                   public RenderStyleObserver {
 public:
@@ -67,6 +80,8 @@ public:
 
     void render(View&);
     void renderStill();
+    void renderNextStill(std::shared_ptr<StillImageBatch>);
+    void updateRenderStyle(TimePoint);
 
     Map& map;
     MapObserver& observer;
@@ -84,6 +99,9 @@ public:
 
     MapDebugOptions debugOptions { MapDebugOptions::NoDebug };
 
+    uint8_t prefetchZoomDelta = util::DEFAULT_PREFETCH_ZOOM_DELTA;
+    uint32_t prefetchTileBudget = util::DEFAULT_PREFETCH_TILE_BUDGET;
+
     Update updateFlags = Update::Nothing;
 
     AnnotationManager annotationManager;
@@ -188,6 +206,44 @@ void Map::renderStill(View& view, StillImageCallback callback) {
     impl->onUpdate(Update::Repaint);
 }
 
+void Map::renderStills(View& view, std::vector<CameraOptions> cameras, StillImageBatchCallback callback) {
+    if (!callback) {
+        Log::Error(Event::General, "StillImageBatchCallback not set");
+        return;
+    }
+
+    if (cameras.empty()) {
+        return;
+    }
+
+    impl->renderNextStill(std::make_shared<StillImageBatch>(view, std::move(cameras), std::move(callback)));
+}
+
+void Map::Impl::renderNextStill(std::shared_ptr<StillImageBatch> batch) {
+    // The camera is usually already set by the previous image of the batch.
+    map.jumpTo(batch->cameras[batch->index]);
+    batch->start = Clock::now();
+
+    map.renderStill(batch->view, [this, batch] (std::exception_ptr error) {
+        const std::size_t index = batch->index++;
+        const Duration elapsed = Clock::now() - batch->start;
+        const bool next = !error && batch->index < batch->cameras.size();
+
+        if (next) {
+            // Request the tiles for the next camera, so that they load while the callback
+            // processes the current image.
+            map.jumpTo(batch->cameras[batch->index]);
+            updateRenderStyle(Clock::time_point::max());
+        }
+
+        batch->callback(index, error, elapsed);
+
+        if (next) {
+            renderNextStill(batch);
+        }
+    });
+}
+
 void Map::Impl::renderStill() {
     if (!stillImageRequest) {
         return;
@@ -230,23 +286,7 @@ void Map::Impl::render(View& view) {
         painter = std::make_unique<Painter>(context, transform.getState(), pixelRatio, programCacheDir);
     }
 
-    renderStyle->update({
-        mode,
-        pixelRatio,
-        debugOptions,
-        timePoint,
-        transform.getState(),
-        style->impl->getGlyphURL(),
-        style->impl->spriteLoaded,
-        style->impl->getTransitionOptions(),
-        style->impl->getLight()->impl,
-        style->impl->getImageImpls(),
-        style->impl->getSourceImpls(),
-        style->impl->getLayerImpls(),
-        scheduler,
-        fileSource,
-        annotationManager
-    });
+    updateRenderStyle(timePoint);
 
     bool loaded = style->impl->isLoaded() && renderStyle->isLoaded();
 
@@ -274,6 +314,7 @@ void Map::Impl::render(View& view) {
         observer.onDidFinishRenderingFrame(loaded
             ? MapObserver::RenderMode::Full
             : MapObserver::RenderMode::Partial);
+        observer.onDidFinishRenderingFrameStats(painter->stats);
 
         if (!loaded) {
             renderState = RenderState::Partial;
@@ -304,6 +345,8 @@ void Map::Impl::render(View& view) {
                         frameData,
                         view);
 
+        observer.onDidFinishRenderingFrameStats(painter->stats);
+
         auto request = std::move(stillImageRequest);
         request->callback(nullptr);
 
@@ -311,6 +354,29 @@ void Map::Impl::render(View& view) {
     }
 }
 
+void Map::Impl::updateRenderStyle(TimePoint timePoint) {
+    renderStyle->update({
+        mode,
+        pixelRatio,
+        debugOptions,
+        timePoint,
+        transform.getState(),
+        transform.getTransitionDestination(),
+        prefetchZoomDelta,
+        prefetchTileBudget,
+        style->impl->getGlyphURL(),
+        style->impl->spriteLoaded,
+        style->impl->getTransitionOptions(),
+        style->impl->getLight()->impl,
+        style->impl->getImageImpls(),
+        style->impl->getSourceImpls(),
+        style->impl->getLayerImpls(),
+        scheduler,
+        fileSource,
+        annotationManager
+    });
+}
+
 #pragma mark - Style
 
 style::Style& Map::getStyle() {
@@ -834,6 +900,26 @@ void Map::onLowMemory() {
     }
 }
 
+#pragma mark - Tile prefetching
+
+void Map::setPrefetchZoomDelta(uint8_t delta) {
+    impl->prefetchZoomDelta = delta;
+    impl->onUpdate(Update::Repaint);
+}
+
+uint8_t Map::getPrefetchZoomDelta() const {
+    return impl->prefetchZoomDelta;
+}
+
+void Map::setPrefetchTileBudget(uint32_t budget) {
+    impl->prefetchTileBudget = budget;
+    impl->onUpdate(Update::Repaint);
+}
+
+uint32_t Map::getPrefetchTileBudget() const {
+    return impl->prefetchTileBudget;
+}
+
 void Map::Impl::onSourceChanged(style::Source& source) {
     observer.onSourceChanged(source);
 }
@@ -0,0 +1,77 @@
+#include <mbgl/map/metatile.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/projection.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace mbgl {
+
+Metatile::Metatile(uint8_t z_, uint32_t x_, uint32_t y_, uint32_t size_, uint32_t buffer_, uint32_t tileSize_)
+    : z(z_), x(x_), y(y_), size(size_), buffer(buffer_), tileSize(tileSize_) {
+    if (size == 0 || tileSize == 0) {
+        throw std::invalid_argument("metatiles must contain at least one non-empty tile");
+    }
+
+    // Tiles beyond the right edge of the world are wrapped around, so a wider block would
+    // contain some tiles more than once.
+    const uint64_t tiles = uint64_t(1) << std::min<uint8_t>(z, 32);
+    if (size > tiles) {
+        throw std::invalid_argument("metatiles can't be larger than the world");
+    }
+    if (x >= tiles || y >= tiles) {
+        throw std::invalid_argument("metatiles must start within the world");
+    }
+}
+
+Size Metatile::getSize() const {
+    return { size * tileSize + 2 * buffer, size * tileSize + 2 * buffer };
+}
+
+CameraOptions Metatile::getCamera() const {
+    // Tiles of the map at zoom level z have util::tileSize pixels, so we need to offset the zoom
+    // level for other tile sizes.
+    const double scale = std::pow(2.0, z) * tileSize / util::tileSize;
+    const Point<double> center {
+        (x + size / 2.0) * tileSize,
+        (y + size / 2.0) * tileSize
+    };
+
+    CameraOptions camera;
+    camera.center = Projection::unproject(center, scale);
+    camera.zoom = std::log2(scale);
+    camera.angle = 0.0;
+    camera.pitch = 0.0;
+    return camera;
+}
+
+std::vector<Metatile::Tile> Metatile::slice(const PremultipliedImage& image, float pixelRatio) const {
+    const auto pixels = static_cast<uint32_t>(tileSize * pixelRatio);
+    const auto offset = static_cast<uint32_t>(buffer * pixelRatio);
+    const uint64_t tiles = uint64_t(1) << std::min<uint8_t>(z, 32);
+
+    const auto expected = static_cast<uint32_t>(getSize().width * pixelRatio);
+    if (image.size != Size { expected, expected }) {
+        throw std::invalid_argument("image size doesn't match the metatile size");
+    }
+
+    std::vector<Tile> result;
+    result.reserve(size * size);
+
+    for (uint32_t row = 0; row < size; row++) {
+        if (y + row >= tiles) {
+            break;
+        }
+        for (uint32_t column = 0; column < size; column++) {
+            PremultipliedImage tile({ pixels, pixels });
+            PremultipliedImage::copy(image, tile, { offset + column * pixels, offset + row * pixels },
+                                     { 0, 0 }, tile.size);
+            result.push_back({ z, static_cast<uint32_t>((uint64_t(x) + column) % tiles), y + row, std::move(tile) });
+        }
+    }
+
+    return result;
+}
+
+} // namespace mbgl
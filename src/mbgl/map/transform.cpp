@@ -552,6 +552,17 @@ void Transform::startTransition(const CameraOptions& camera,
     transitionStart = Clock::now();
     transitionDuration = duration;
 
+    // Apply the last frame to a copy of the state, so that the tiles at the destination can be
+    // requested before the animation reaches it.
+    transitionDestination = {};
+    if (isAnimated) {
+        const TransformState current = state;
+        frame(1.0);
+        if (anchor) state.moveLatLng(anchorLatLng, *anchor);
+        transitionDestination = state;
+        state = current;
+    }
+
     transitionFrameFn = [isAnimated, animation, frame, anchor, anchorLatLng, this](const TimePoint now) {
         float t = isAnimated ? (std::chrono::duration<float>(now - transitionStart) / transitionDuration) : 1.0;
         if (t >= 1.0) {
@@ -572,6 +583,7 @@ void Transform::startTransition(const CameraOptions& camera,
         } else {
             transitionFinishFn();
             transitionFinishFn = nullptr;
+            transitionDestination = {};
 
             // This callback gets destroyed here,
             // we can only return after this point.
@@ -611,6 +623,7 @@ void Transform::cancelTransitions() {
 
     transitionFrameFn = nullptr;
     transitionFinishFn = nullptr;
+    transitionDestination = {};
 }
 
 void Transform::setGestureInProgress(bool inProgress) {
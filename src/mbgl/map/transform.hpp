@@ -130,6 +130,8 @@ public:
     void updateTransitions(const TimePoint& now);
     TimePoint getTransitionStart() const { return transitionStart; }
     Duration getTransitionDuration() const { return transitionDuration; }
+    /** Returns the state at the end of the current animation, if any. */
+    const optional<TransformState>& getTransitionDestination() const { return transitionDestination; }
     void cancelTransitions();
 
     // Gesture
@@ -157,6 +159,7 @@ private:
 
     TimePoint transitionStart;
     Duration transitionDuration;
+    optional<TransformState> transitionDestination;
     std::function<void(const TimePoint)> transitionFrameFn;
     std::function<void()> transitionFinishFn;
 };
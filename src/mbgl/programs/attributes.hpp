@@ -46,6 +46,9 @@ struct a_offset {
 
 // Paint attributes
 
+// The position of the values of a feature within the blocks of a FeatureTexture.
+MBGL_DEFINE_ATTRIBUTE(uint16_t, 2, a_feature);
+
 struct a_color {
     static auto name() { return "a_color"; }
     using Type = gl::Attribute<float, 2>;
@@ -69,7 +69,8 @@ public:
             LayoutAttributes::bindings(layoutVertexBuffer)
                 .concat(paintPropertyBinders.attributeBindings(currentProperties)),
             indexBuffer,
-            segments
+            segments,
+            paintPropertyBinders.featureTextureID()
         );
     }
 };
@@ -86,8 +87,9 @@ public:
           parameters(std::move(parameters_)) {
     }
 
-    Program& get(const typename PaintProperties::PossiblyEvaluated& currentProperties) {
-        Bitset bits = PaintPropertyBinders::constants(currentProperties);
+    Program& get(const typename PaintProperties::PossiblyEvaluated& currentProperties,
+                 const PaintPropertyBinders& paintPropertyBinders) {
+        Bitset bits = paintPropertyBinders.programKey(currentProperties);
         auto it = programs.find(bits);
         if (it != programs.end()) {
             return it->second;
@@ -95,7 +97,7 @@ public:
         return programs.emplace(std::piecewise_construct,
                                 std::forward_as_tuple(bits),
                                 std::forward_as_tuple(context,
-                                    parameters.withAdditionalDefines(PaintPropertyBinders::defines(currentProperties)))).first->second;
+                                    parameters.withAdditionalDefines(paintPropertyBinders.defines(currentProperties)))).first->second;
     }
 
 private:
@@ -372,7 +372,8 @@ public:
                 .concat(symbolSizeBinder.attributeBindings())
                 .concat(paintPropertyBinders.attributeBindings(currentProperties)),
             indexBuffer,
-            segments
+            segments,
+            paintPropertyBinders.featureTextureID()
         );
     }
 };
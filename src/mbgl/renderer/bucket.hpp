@@ -34,6 +34,18 @@ public:
     virtual void addFeature(const GeometryTileFeature&,
                             const GeometryCollection&) {};
 
+    // The number of vertices of the features added so far.
+    virtual std::size_t vertexCount() const {
+        return 0;
+    }
+
+    // Data-driven paint properties can be evaluated again without laying out the features again:
+    // a bucket created for the new properties gets only the paint values of the features, whose
+    // vertices end at `vertexEnd`, and then replaces the paint property binders of the bucket that
+    // was laid out. The layout buffers of that bucket are kept, and only the binders are uploaded.
+    virtual void addPaintFeature(const GeometryTileFeature&, std::size_t /* vertexEnd */) {}
+    virtual void setPaintPropertyBinders(Bucket&) {}
+
     // As long as this bucket has a Prepare render pass, this function is getting called. Typically,
     // this only happens once when the bucket is being rendered for the first time.
     virtual void upload(gl::Context&) = 0;
@@ -7,6 +7,8 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/math.hpp>
 
+#include <cassert>
+
 namespace mbgl {
 
 using namespace style;
@@ -23,9 +25,27 @@ CircleBucket::CircleBucket(const BucketParameters& parameters, const std::vector
     }
 }
 
+std::size_t CircleBucket::vertexCount() const {
+    return vertices.vertexSize();
+}
+
+void CircleBucket::addPaintFeature(const GeometryTileFeature& feature, std::size_t vertexEnd) {
+    for (auto& pair : paintPropertyBinders) {
+        pair.second.populateVertexVectors(feature, vertexEnd);
+    }
+}
+
+void CircleBucket::setPaintPropertyBinders(Bucket& bucket) {
+    assert(dynamic_cast<CircleBucket*>(&bucket));
+    paintPropertyBinders = std::move(static_cast<CircleBucket&>(bucket).paintPropertyBinders);
+    uploaded = false;
+}
+
 void CircleBucket::upload(gl::Context& context) {
-    vertexBuffer = context.createVertexBuffer(std::move(vertices));
-    indexBuffer = context.createIndexBuffer(std::move(triangles));
+    if (!vertexBuffer) {
+        vertexBuffer = context.createVertexBuffer(std::move(vertices));
+        indexBuffer = context.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(context);
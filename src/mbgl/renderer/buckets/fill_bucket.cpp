@@ -109,10 +109,28 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
     }
 }
 
+std::size_t FillBucket::vertexCount() const {
+    return vertices.vertexSize();
+}
+
+void FillBucket::addPaintFeature(const GeometryTileFeature& feature, std::size_t vertexEnd) {
+    for (auto& pair : paintPropertyBinders) {
+        pair.second.populateVertexVectors(feature, vertexEnd);
+    }
+}
+
+void FillBucket::setPaintPropertyBinders(Bucket& bucket) {
+    assert(dynamic_cast<FillBucket*>(&bucket));
+    paintPropertyBinders = std::move(static_cast<FillBucket&>(bucket).paintPropertyBinders);
+    uploaded = false;
+}
+
 void FillBucket::upload(gl::Context& context) {
-    vertexBuffer = context.createVertexBuffer(std::move(vertices));
-    lineIndexBuffer = context.createIndexBuffer(std::move(lines));
-    triangleIndexBuffer = context.createIndexBuffer(std::move(triangles));
+    if (!vertexBuffer) {
+        vertexBuffer = context.createVertexBuffer(std::move(vertices));
+        lineIndexBuffer = context.createIndexBuffer(std::move(lines));
+        triangleIndexBuffer = context.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(context);
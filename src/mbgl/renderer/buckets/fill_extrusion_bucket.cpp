@@ -143,9 +143,27 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
     }
 }
 
+std::size_t FillExtrusionBucket::vertexCount() const {
+    return vertices.vertexSize();
+}
+
+void FillExtrusionBucket::addPaintFeature(const GeometryTileFeature& feature, std::size_t vertexEnd) {
+    for (auto& pair : paintPropertyBinders) {
+        pair.second.populateVertexVectors(feature, vertexEnd);
+    }
+}
+
+void FillExtrusionBucket::setPaintPropertyBinders(Bucket& bucket) {
+    assert(dynamic_cast<FillExtrusionBucket*>(&bucket));
+    paintPropertyBinders = std::move(static_cast<FillExtrusionBucket&>(bucket).paintPropertyBinders);
+    uploaded = false;
+}
+
 void FillExtrusionBucket::upload(gl::Context& context) {
-    vertexBuffer = context.createVertexBuffer(std::move(vertices));
-    indexBuffer = context.createIndexBuffer(std::move(triangles));
+    if (!vertexBuffer) {
+        vertexBuffer = context.createVertexBuffer(std::move(vertices));
+        indexBuffer = context.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(context);
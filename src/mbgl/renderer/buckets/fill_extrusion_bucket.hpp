@@ -18,6 +18,9 @@ public:
 
     void addFeature(const GeometryTileFeature&,
                     const GeometryCollection&) override;
+    std::size_t vertexCount() const override;
+    void addPaintFeature(const GeometryTileFeature&, std::size_t vertexEnd) override;
+    void setPaintPropertyBinders(Bucket&) override;
     bool hasData() const override;
 
     void upload(gl::Context&) override;
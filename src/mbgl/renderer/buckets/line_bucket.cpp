@@ -447,9 +447,27 @@ void LineBucket::addPieSliceVertex(const GeometryCoordinate& currentVertex,
     }
 }
 
+std::size_t LineBucket::vertexCount() const {
+    return vertices.vertexSize();
+}
+
+void LineBucket::addPaintFeature(const GeometryTileFeature& feature, std::size_t vertexEnd) {
+    for (auto& pair : paintPropertyBinders) {
+        pair.second.populateVertexVectors(feature, vertexEnd);
+    }
+}
+
+void LineBucket::setPaintPropertyBinders(Bucket& bucket) {
+    assert(dynamic_cast<LineBucket*>(&bucket));
+    paintPropertyBinders = std::move(static_cast<LineBucket&>(bucket).paintPropertyBinders);
+    uploaded = false;
+}
+
 void LineBucket::upload(gl::Context& context) {
-    vertexBuffer = context.createVertexBuffer(std::move(vertices));
-    indexBuffer = context.createIndexBuffer(std::move(triangles));
+    if (!vertexBuffer) {
+        vertexBuffer = context.createVertexBuffer(std::move(vertices));
+        indexBuffer = context.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(context);
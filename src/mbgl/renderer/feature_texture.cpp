@@ -0,0 +1,57 @@
+#include <mbgl/renderer/feature_texture.hpp>
+#include <mbgl/math/clamp.hpp>
+
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+
+namespace mbgl {
+
+optional<FeatureTexture> FeatureTexture::create(std::size_t features, std::size_t blocks, uint32_t maxSize) {
+    if (features == 0 || blocks == 0 || maxSize == 0) {
+        return {};
+    }
+
+    const std::size_t width = std::min<std::size_t>(features, maxSize);
+    const std::size_t blockHeight = (features + width - 1) / width;
+    if (blockHeight * blocks > maxSize) {
+        return {};
+    }
+
+    return FeatureTexture { Size { uint32_t(width), uint32_t(blockHeight * blocks) }, uint32_t(blockHeight) };
+}
+
+FeatureTexture::FeatureTexture(Size size, uint32_t blockHeight_)
+    : image(size),
+      blockHeight(blockHeight_) {
+}
+
+uint8_t* FeatureTexture::texel(std::size_t block, std::size_t feature) {
+    const std::size_t x = feature % image.size.width;
+    const std::size_t y = block * blockHeight + feature / image.size.width;
+    assert(y < image.size.height);
+    return image.data.get() + y * image.stride() + x * image.channels;
+}
+
+void FeatureTexture::set(std::size_t block, std::size_t feature, const Color& color) {
+    // Truncated like the color attributes in attributeValue().
+    uint8_t* t = texel(block, feature);
+    t[0] = static_cast<uint8_t>(255 * color.r);
+    t[1] = static_cast<uint8_t>(255 * color.g);
+    t[2] = static_cast<uint8_t>(255 * color.b);
+    t[3] = static_cast<uint8_t>(255 * color.a);
+}
+
+void FeatureTexture::set(std::size_t block, std::size_t feature, float value, const Range<float>& range) {
+    const float extent = range.max - range.min;
+    const float normalized = extent > 0 ? util::clamp((value - range.min) / extent, 0.0f, 1.0f) : 0.0f;
+    const auto fixed = static_cast<uint32_t>(std::lround(normalized * 0xFFFFFF));
+
+    uint8_t* t = texel(block, feature);
+    t[0] = (fixed >> 16) & 0xFF;
+    t[1] = (fixed >> 8) & 0xFF;
+    t[2] = fixed & 0xFF;
+    t[3] = 0;
+}
+
+} // namespace mbgl
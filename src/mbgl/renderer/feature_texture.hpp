@@ -0,0 +1,57 @@
+#pragma once
+
+#include <mbgl/util/color.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/range.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace mbgl {
+
+/*
+    FeatureTexture holds the values of the data-driven paint properties of a bucket once per
+    feature, rather than once per vertex in attribute buffers.
+
+    The texture is divided into blocks of rows, one for each value that a property has per
+    feature: one for source functions, and two -- the values at the minimum and maximum zoom
+    level -- for composite functions. All blocks have the same layout, and the vertices of a
+    feature refer to the texel of the feature within a block with the a_feature attribute.
+
+    Colors are stored as they are, with the same 8 bit precision that the attributes have. Other
+    values are stored as 24 bit fixed point numbers relative to the range of values of the
+    property, which the shader gets in a uniform.
+*/
+class FeatureTexture {
+public:
+    // Returns nothing if the texture would be larger than maxSize in either dimension.
+    static optional<FeatureTexture> create(std::size_t features, std::size_t blocks, uint32_t maxSize);
+
+    // The position of the texel of the feature within each block.
+    std::array<uint16_t, 2> position(std::size_t feature) const {
+        return {{
+            static_cast<uint16_t>(feature % image.size.width),
+            static_cast<uint16_t>(feature / image.size.width)
+        }};
+    }
+
+    // The first row of the block.
+    float row(std::size_t block) const {
+        return block * blockHeight;
+    }
+
+    void set(std::size_t block, std::size_t feature, const Color&);
+    void set(std::size_t block, std::size_t feature, float value, const Range<float>& range);
+
+    PremultipliedImage image;
+
+private:
+    FeatureTexture(Size, uint32_t blockHeight);
+
+    uint8_t* texel(std::size_t block, std::size_t feature);
+
+    uint32_t blockHeight;
+};
+
+} // namespace mbgl
@@ -6,6 +6,8 @@
 #include <mapbox/shelf-pack.hpp>
 
 #include <array>
+#include <map>
+#include <string>
 
 namespace mbgl {
 
@@ -40,12 +42,4 @@ public:
 
 using ImagePositions = std::map<std::string, ImagePosition>;
 
-class ImageAtlas {
-public:
-    PremultipliedImage image;
-    ImagePositions positions;
-};
-
-ImageAtlas makeImageAtlas(const ImageMap&);
-
 } // namespace mbgl
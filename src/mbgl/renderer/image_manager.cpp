@@ -2,6 +2,8 @@
 #include <mbgl/util/logging.hpp>
 #include <mbgl/gl/context.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
 void ImageManager::onSpriteLoaded() {
@@ -26,6 +28,10 @@ void ImageManager::removeImage(const std::string& id) {
     assert(images.find(id) != images.end());
     images.erase(id);
 
+    // Tiles that use the icon keep referencing its bin until they release it, but the next
+    // requestors get the new image.
+    icons.erase(id);
+
     auto it = patterns.find(id);
     if (it != patterns.end()) {
         shelfPack.unref(*it->second.bin);
@@ -63,19 +69,62 @@ void ImageManager::getImages(ImageRequestor& requestor, ImageDependencies depend
 
 void ImageManager::removeRequestor(ImageRequestor& requestor) {
     requestors.erase(&requestor);
+
+    auto it = iconReferences.find(&requestor);
+    if (it != iconReferences.end()) {
+        for (const auto& notification : it->second) {
+            releaseIcons(notification.second);
+        }
+        iconReferences.erase(it);
+    }
+}
+
+void ImageManager::releaseIcons(ImageRequestor& requestor, uint64_t correlationID) {
+    auto it = iconReferences.find(&requestor);
+    if (it == iconReferences.end()) {
+        return;
+    }
+
+    auto& notifications = it->second;
+    const auto end = notifications.lower_bound(correlationID);
+    for (auto notification = notifications.begin(); notification != end; ++notification) {
+        releaseIcons(notification->second);
+    }
+    notifications.erase(notifications.begin(), end);
 }
 
-void ImageManager::notify(ImageRequestor& requestor, const ImageDependencies& dependencies) const {
+void ImageManager::releaseIcons(const std::vector<mapbox::Bin*>& bins) {
+    for (mapbox::Bin* bin : bins) {
+        if (iconShelfPack.unref(*bin) == 0) {
+            auto it = std::find_if(icons.begin(), icons.end(), [&] (const auto& entry) {
+                return entry.second.bin == bin;
+            });
+            if (it != icons.end()) {
+                icons.erase(it);
+            }
+        }
+    }
+}
+
+void ImageManager::notify(ImageRequestor& requestor, const ImageDependencies& dependencies) {
     ImageMap response;
+    ImagePositions positions;
+    std::vector<mapbox::Bin*> references;
 
     for (const auto& dependency : dependencies) {
         auto it = images.find(dependency);
         if (it != images.end()) {
-            response.emplace(*it);
+            if (optional<ImagePosition> position = addIcon(*it->second, references)) {
+                response.emplace(*it);
+                positions.emplace(dependency, *position);
+            }
         }
     }
 
-    requestor.onImagesAvailable(response);
+    const uint64_t correlationID = ++imageCorrelationID;
+    iconReferences[&requestor].emplace(correlationID, std::move(references));
+
+    requestor.onImagesAvailable(std::move(response), std::move(positions), correlationID);
 }
 
 void ImageManager::dumpDebugLogs() const {
@@ -95,7 +144,8 @@ static mapbox::ShelfPack::ShelfPackOptions shelfPackOptions() {
 }
 
 ImageManager::ImageManager()
-    : shelfPack(64, 64, shelfPackOptions()) {
+    : shelfPack(64, 64, shelfPackOptions()),
+      iconShelfPack(64, 64, shelfPackOptions()) {
 }
 
 ImageManager::~ImageManager() = default;
@@ -111,8 +161,8 @@ optional<ImagePosition> ImageManager::getPattern(const std::string& id) {
         return {};
     }
 
-    const uint16_t width = image->image.size.width + padding * 2;
-    const uint16_t height = image->image.size.height + padding * 2;
+    const uint16_t width = image->size.width + padding * 2;
+    const uint16_t height = image->size.height + padding * 2;
 
     mapbox::Bin* bin = shelfPack.packOne(-1, width, height);
     if (!bin) {
@@ -121,20 +171,18 @@ optional<ImagePosition> ImageManager::getPattern(const std::string& id) {
 
     atlasImage.resize(getPixelSize());
 
-    const PremultipliedImage& src = image->image;
-
     const uint32_t x = bin->x + padding;
     const uint32_t y = bin->y + padding;
-    const uint32_t w = src.size.width;
-    const uint32_t h = src.size.height;
+    const uint32_t w = image->size.width;
+    const uint32_t h = image->size.height;
 
-    PremultipliedImage::copy(src, atlasImage, { 0, 0 }, { x, y }, { w, h });
+    image->copy({ 0, 0 }, atlasImage, { x, y }, { w, h });
 
     // Add 1 pixel wrapped padding on each side of the image.
-    PremultipliedImage::copy(src, atlasImage, { 0, h - 1 }, { x, y - 1 }, { w, 1 }); // T
-    PremultipliedImage::copy(src, atlasImage, { 0,     0 }, { x, y + h }, { w, 1 }); // B
-    PremultipliedImage::copy(src, atlasImage, { w - 1, 0 }, { x - 1, y }, { 1, h }); // L
-    PremultipliedImage::copy(src, atlasImage, { 0,     0 }, { x + w, y }, { 1, h }); // R
+    image->copy({ 0, h - 1 }, atlasImage, { x, y - 1 }, { w, 1 }); // T
+    image->copy({ 0,     0 }, atlasImage, { x, y + h }, { w, 1 }); // B
+    image->copy({ w - 1, 0 }, atlasImage, { x - 1, y }, { 1, h }); // L
+    image->copy({ 0,     0 }, atlasImage, { x + w, y }, { 1, h }); // R
 
     dirty = true;
 
@@ -156,6 +204,8 @@ void ImageManager::upload(gl::Context& context, gl::TextureUnit unit) {
     }
 
     dirty = false;
+
+    uploadIcons(context, unit);
 }
 
 void ImageManager::bind(gl::Context& context, gl::TextureUnit unit) {
@@ -163,4 +213,71 @@ void ImageManager::bind(gl::Context& context, gl::TextureUnit unit) {
     context.bindTexture(*atlasTexture, unit, gl::TextureFilter::Linear);
 }
 
+optional<ImagePosition> ImageManager::addIcon(const style::Image::Impl& image,
+                                              std::vector<mapbox::Bin*>& references) {
+    auto it = icons.find(image.id);
+    if (it != icons.end()) {
+        iconShelfPack.ref(*it->second.bin);
+        references.push_back(it->second.bin);
+        return it->second.position;
+    }
+
+    const uint16_t width = image.size.width + padding * 2;
+    const uint16_t height = image.size.height + padding * 2;
+
+    mapbox::Bin* bin = iconShelfPack.packOne(-1, width, height);
+    if (!bin) {
+        return {};
+    }
+
+    iconAtlasImage.resize(getIconPixelSize());
+
+    // Bins of icons that are no longer used are reused, so the transparent padding has to be
+    // cleared of the previous icon.
+    const uint32_t x = bin->x;
+    const uint32_t y = bin->y;
+    for (uint32_t row = y; row < y + height; row++) {
+        uint8_t* data = iconAtlasImage.data.get() + row * iconAtlasImage.stride() + x * 4;
+        std::fill(data, data + width * 4, 0);
+    }
+
+    image.copy({ 0, 0 }, iconAtlasImage, { x + padding, y + padding }, image.size);
+
+    if (iconDirtyTop == iconDirtyBottom) {
+        iconDirtyTop = y;
+        iconDirtyBottom = y + height;
+    } else {
+        iconDirtyTop = std::min(iconDirtyTop, y);
+        iconDirtyBottom = std::max(iconDirtyBottom, y + height);
+    }
+
+    references.push_back(bin);
+    return icons.emplace(image.id, Icon { bin, { *bin, image } }).first->second.position;
+}
+
+Size ImageManager::getIconPixelSize() const {
+    return Size {
+        static_cast<uint32_t>(iconShelfPack.width()),
+        static_cast<uint32_t>(iconShelfPack.height())
+    };
+}
+
+void ImageManager::uploadIcons(gl::Context& context, gl::TextureUnit unit) {
+    if (!iconAtlasTexture) {
+        iconAtlasTexture = context.createTexture(iconAtlasImage, unit);
+    } else if (iconAtlasTexture->size != iconAtlasImage.size) {
+        context.updateTexture(*iconAtlasTexture, iconAtlasImage, unit);
+    } else if (iconDirtyTop != iconDirtyBottom) {
+        // Only upload the rows with icons that were added since the last upload.
+        context.updateTextureRows(*iconAtlasTexture, iconAtlasImage, iconDirtyTop, iconDirtyBottom - iconDirtyTop, unit);
+    }
+
+    iconDirtyTop = iconDirtyBottom = 0;
+}
+
+void ImageManager::bindIcons(gl::Context& context, gl::TextureUnit unit, gl::TextureFilter filter) {
+    uploadIcons(context, unit);
+    context.bindTexture(*iconAtlasTexture, unit, filter);
+}
+
 } // namespace mbgl
@@ -9,8 +9,10 @@
 
 #include <mapbox/shelf-pack.hpp>
 
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace mbgl {
 
@@ -21,18 +23,27 @@ class Context;
 class ImageRequestor {
 public:
     virtual ~ImageRequestor() = default;
-    virtual void onImagesAvailable(ImageMap) = 0;
+
+    // The positions of the images in the icon atlas stay valid until the requestor releases
+    // them with ImageManager::releaseIcons, or is removed.
+    virtual void onImagesAvailable(ImageMap, ImagePositions, uint64_t imageCorrelationID) = 0;
 };
 
 /*
-    ImageManager does two things:
+    ImageManager does three things:
 
         1. Tracks requests for icon images from tile workers and sends responses when the requests are fulfilled.
-        2. Builds a texture atlas for pattern images.
+        2. Builds a texture atlas for the icon images of all tiles.
+        3. Builds a texture atlas for pattern images.
 
     These are disparate responsibilities and should eventually be handled by different classes. When we implement
     data-driven support for `*-pattern`, we'll likely use per-bucket pattern atlases, and that would be a good time
     to refactor this.
+
+    Icons are packed into the icon atlas when a requestor is notified, and stay there as long as a requestor
+    references them. Each notification references the icons it contains. A tile releases the references of its
+    older notifications once it shows symbols that were placed with a newer one, so that the symbols it shows
+    never point to space in the atlas that was reused.
 */
 class ImageManager : public util::noncopyable {
 public:
@@ -56,14 +67,52 @@ public:
     void getImages(ImageRequestor&, ImageDependencies);
     void removeRequestor(ImageRequestor&);
 
+    // Releases the icons of the notifications of the requestor before the given one.
+    void releaseIcons(ImageRequestor&, uint64_t imageCorrelationID);
+
 private:
-    void notify(ImageRequestor&, const ImageDependencies&) const;
+    void notify(ImageRequestor&, const ImageDependencies&);
+    void releaseIcons(const std::vector<mapbox::Bin*>&);
 
     bool loaded = false;
 
     std::unordered_map<ImageRequestor*, ImageDependencies> requestors;
     ImageMap images;
 
+// Icon stuff
+public:
+    void bindIcons(gl::Context&, gl::TextureUnit, gl::TextureFilter);
+
+    Size getIconPixelSize() const;
+
+    // Only for use in tests.
+    const PremultipliedImage& getIconAtlasImage() const {
+        return iconAtlasImage;
+    }
+
+private:
+    optional<ImagePosition> addIcon(const style::Image::Impl&, std::vector<mapbox::Bin*>& references);
+    void uploadIcons(gl::Context&, gl::TextureUnit);
+
+    struct Icon {
+        mapbox::Bin* bin;
+        ImagePosition position;
+    };
+
+    mapbox::ShelfPack iconShelfPack;
+    std::unordered_map<std::string, Icon> icons;
+
+    // For each requestor, the icons referenced by each of its notifications.
+    std::unordered_map<ImageRequestor*, std::map<uint64_t, std::vector<mapbox::Bin*>>> iconReferences;
+    uint64_t imageCorrelationID = 0;
+
+    PremultipliedImage iconAtlasImage;
+    mbgl::optional<gl::Texture> iconAtlasTexture;
+
+    // The rows of the icon atlas that changed since it was uploaded.
+    uint32_t iconDirtyTop = 0;
+    uint32_t iconDirtyBottom = 0;
+
 // Pattern stuff
 public:
     optional<ImagePosition> getPattern(const std::string& name);
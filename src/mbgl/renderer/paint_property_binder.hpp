@@ -1,13 +1,21 @@
 #pragma once
 
 #include <mbgl/programs/attributes.hpp>
+#include <mbgl/programs/uniforms.hpp>
 #include <mbgl/gl/attribute.hpp>
+#include <mbgl/gl/context.hpp>
 #include <mbgl/gl/uniform.hpp>
 #include <mbgl/util/type_list.hpp>
+#include <mbgl/renderer/feature_texture.hpp>
 #include <mbgl/renderer/possibly_evaluated_property_value.hpp>
 #include <mbgl/renderer/paint_property_statistics.hpp>
+#include <mbgl/style/function/evaluation_cache.hpp>
 
+#include <algorithm>
 #include <bitset>
+#include <cassert>
+#include <limits>
+#include <vector>
 
 namespace mbgl {
 
@@ -38,6 +46,40 @@ inline std::array<float, 2> attributeValue(const Color& color) {
     }};
 }
 
+/*
+    The range of the values of a property that a FeatureTexture stores, which the shader needs to
+    decode them. Colors are stored as they are, and don't extend the range.
+*/
+inline void extendFeatureValueRange(Range<float>& range, float v) {
+    range.min = std::min(range.min, v);
+    range.max = std::max(range.max, v);
+}
+
+inline void extendFeatureValueRange(Range<float>&, const Color&) {}
+
+template <class T>
+void extendFeatureValueRange(Range<float>& range, const Range<T>& v) {
+    extendFeatureValueRange(range, v.min);
+    extendFeatureValueRange(range, v.max);
+}
+
+template <class T>
+Range<float> featureValueRange(const std::vector<T>& values) {
+    Range<float> range { std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() };
+    for (const auto& value : values) {
+        extendFeatureValueRange(range, value);
+    }
+    return range.min <= range.max ? range : Range<float> { 0, 0 };
+}
+
+inline void setFeatureValue(FeatureTexture& texture, std::size_t block, std::size_t feature, float v, const Range<float>& range) {
+    texture.set(block, feature, v, range);
+}
+
+inline void setFeatureValue(FeatureTexture& texture, std::size_t block, std::size_t feature, const Color& v, const Range<float>&) {
+    texture.set(block, feature, v);
+}
+
 template <size_t N>
 std::array<float, N*2> zoomInterpolatedAttributeValue(const std::array<float, N>& min, const std::array<float, N>& max) {
     std::array<float, N*2> result;
@@ -70,6 +112,11 @@ std::array<float, N*2> zoomInterpolatedAttributeValue(const std::array<float, N>
 
    Note that the shader source varies depending on whether we're using a uniform or
    attribute. Like GL JS, we dynamically compile shaders at runtime to accomodate this.
+
+   Function binders evaluate their function once per feature. When the bucket is uploaded,
+   the values are either copied into every vertex of the feature, or, when the vertex shaders
+   can read textures and it needs less memory, stored once per feature in a FeatureTexture.
+   In that case, the shader reads the values from the texture instead of the attributes.
 */
 template <class T, class A>
 class PaintPropertyBinder {
@@ -79,12 +126,26 @@ public:
 
     virtual ~PaintPropertyBinder() = default;
 
-    virtual void populateVertexVector(const GeometryTileFeature& feature, std::size_t length) = 0;
-    virtual void upload(gl::Context& context) = 0;
+    virtual void populateFeatureValue(const GeometryTileFeature& feature) = 0;
+
+    // The bytes of attribute data per vertex, and the number of feature texture blocks needed
+    // instead.
+    virtual std::size_t vertexSize() const = 0;
+    virtual std::size_t featureTextureBlocks() const = 0;
+
+    // Stores the feature values either in the texture, starting at the given block, or in
+    // vertex attributes. `featureVertexEnds` holds the end of the vertices of every feature.
+    virtual void populateFeatureTexture(FeatureTexture&, std::size_t block) = 0;
+    virtual void upload(gl::Context& context, const std::vector<std::size_t>& featureVertexEnds) = 0;
+
     virtual AttributeBinding attributeBinding(const PossiblyEvaluatedPropertyValue<T>& currentValue) const = 0;
     virtual float interpolationFactor(float currentZoom) const = 0;
     virtual T uniformValue(const PossiblyEvaluatedPropertyValue<T>& currentValue) const = 0;
 
+    // The rows of the blocks of the property in the feature texture, followed by the minimum and
+    // the extent of the range of the values.
+    virtual std::array<float, 4> featureUniformValue() const = 0;
+
     static std::unique_ptr<PaintPropertyBinder> create(const PossiblyEvaluatedPropertyValue<T>& value, float zoom, T defaultValue);
 
     PaintPropertyStatistics<T> statistics;
@@ -100,8 +161,18 @@ public:
         : constant(std::move(constant_)) {
     }
 
-    void populateVertexVector(const GeometryTileFeature&, std::size_t) override {}
-    void upload(gl::Context&) override {}
+    void populateFeatureValue(const GeometryTileFeature&) override {}
+
+    std::size_t vertexSize() const override {
+        return 0;
+    }
+
+    std::size_t featureTextureBlocks() const override {
+        return 0;
+    }
+
+    void populateFeatureTexture(FeatureTexture&, std::size_t) override {}
+    void upload(gl::Context&, const std::vector<std::size_t>&) override {}
 
     AttributeBinding attributeBinding(const PossiblyEvaluatedPropertyValue<T>&) const override {
         return gl::DisabledAttribute();
@@ -115,6 +186,10 @@ public:
         return currentValue.constantOr(constant);
     }
 
+    std::array<float, 4> featureUniformValue() const override {
+        return {{ 0, 0, 0, 0 }};
+    }
+
 private:
     T constant;
 };
@@ -134,21 +209,47 @@ public:
           defaultValue(std::move(defaultValue_)) {
     }
 
-    void populateVertexVector(const GeometryTileFeature& feature, std::size_t length) override {
-        auto evaluated = function.evaluate(feature, defaultValue);
+    void populateFeatureValue(const GeometryTileFeature& feature) override {
+        const optional<Value> property = feature.getValue(function.property);
+        const T evaluated = cache.get(property, [&] {
+            return function.evaluate(property, defaultValue);
+        });
         this->statistics.add(evaluated);
-        auto value = attributeValue(evaluated);
-        for (std::size_t i = vertexVector.vertexSize(); i < length; ++i) {
-            vertexVector.emplace_back(BaseVertex { value });
+        featureValues.push_back(evaluated);
+    }
+
+    std::size_t vertexSize() const override {
+        return sizeof(BaseVertex);
+    }
+
+    std::size_t featureTextureBlocks() const override {
+        return 1;
+    }
+
+    void populateFeatureTexture(FeatureTexture& texture, std::size_t block) override {
+        const Range<float> range = featureValueRange(featureValues);
+        for (std::size_t i = 0; i < featureValues.size(); ++i) {
+            setFeatureValue(texture, block, i, featureValues[i], range);
         }
+        featureUniform = {{ texture.row(block), texture.row(block), range.min, range.max - range.min }};
+        featureValues = std::vector<T>();
     }
 
-    void upload(gl::Context& context) override {
+    void upload(gl::Context& context, const std::vector<std::size_t>& featureVertexEnds) override {
+        assert(featureValues.size() == featureVertexEnds.size());
+        gl::VertexVector<BaseVertex> vertexVector;
+        for (std::size_t i = 0; i < featureValues.size(); ++i) {
+            auto value = attributeValue(featureValues[i]);
+            for (std::size_t v = vertexVector.vertexSize(); v < featureVertexEnds[i]; ++v) {
+                vertexVector.emplace_back(BaseVertex { value });
+            }
+        }
         vertexBuffer = context.createVertexBuffer(std::move(vertexVector));
+        featureValues = std::vector<T>();
     }
 
     AttributeBinding attributeBinding(const PossiblyEvaluatedPropertyValue<T>& currentValue) const override {
-        if (currentValue.isConstant()) {
+        if (currentValue.isConstant() || !vertexBuffer) {
             return gl::DisabledAttribute();
         } else {
             return Attribute::binding(*vertexBuffer, 0, BaseAttribute::Dimensions);
@@ -168,11 +269,17 @@ public:
         }
     }
 
+    std::array<float, 4> featureUniformValue() const override {
+        return featureUniform;
+    }
+
 private:
     style::SourceFunction<T> function;
     T defaultValue;
-    gl::VertexVector<BaseVertex> vertexVector;
+    style::EvaluationCache<T> cache;
+    std::vector<T> featureValues;
     optional<gl::VertexBuffer<BaseVertex>> vertexBuffer;
+    std::array<float, 4> featureUniform {{ 0, 0, 0, 0 }};
 };
 
 template <class T, class A>
@@ -192,24 +299,51 @@ public:
           rangeOfCoveringRanges(function.rangeOfCoveringRanges({zoom, zoom + 1})) {
     }
 
-    void populateVertexVector(const GeometryTileFeature& feature, std::size_t length) override {
-        Range<T> range = function.evaluate(rangeOfCoveringRanges, feature, defaultValue);
+    void populateFeatureValue(const GeometryTileFeature& feature) override {
+        const optional<Value> property = feature.getValue(function.property);
+        const Range<T> range = cache.get(property, [&] {
+            return function.evaluate(rangeOfCoveringRanges, property, defaultValue);
+        });
         this->statistics.add(range.min);
         this->statistics.add(range.max);
-        AttributeValue value = zoomInterpolatedAttributeValue(
-            attributeValue(range.min),
-            attributeValue(range.max));
-        for (std::size_t i = vertexVector.vertexSize(); i < length; ++i) {
-            vertexVector.emplace_back(Vertex { value });
+        featureValues.push_back(range);
+    }
+
+    std::size_t vertexSize() const override {
+        return sizeof(Vertex);
+    }
+
+    std::size_t featureTextureBlocks() const override {
+        return 2;
+    }
+
+    void populateFeatureTexture(FeatureTexture& texture, std::size_t block) override {
+        const Range<float> range = featureValueRange(featureValues);
+        for (std::size_t i = 0; i < featureValues.size(); ++i) {
+            setFeatureValue(texture, block, i, featureValues[i].min, range);
+            setFeatureValue(texture, block + 1, i, featureValues[i].max, range);
         }
+        featureUniform = {{ texture.row(block), texture.row(block + 1), range.min, range.max - range.min }};
+        featureValues = std::vector<Range<T>>();
     }
 
-    void upload(gl::Context& context) override {
+    void upload(gl::Context& context, const std::vector<std::size_t>& featureVertexEnds) override {
+        assert(featureValues.size() == featureVertexEnds.size());
+        gl::VertexVector<Vertex> vertexVector;
+        for (std::size_t i = 0; i < featureValues.size(); ++i) {
+            AttributeValue value = zoomInterpolatedAttributeValue(
+                attributeValue(featureValues[i].min),
+                attributeValue(featureValues[i].max));
+            for (std::size_t v = vertexVector.vertexSize(); v < featureVertexEnds[i]; ++v) {
+                vertexVector.emplace_back(Vertex { value });
+            }
+        }
         vertexBuffer = context.createVertexBuffer(std::move(vertexVector));
+        featureValues = std::vector<Range<T>>();
     }
 
     AttributeBinding attributeBinding(const PossiblyEvaluatedPropertyValue<T>& currentValue) const override {
-        if (currentValue.isConstant()) {
+        if (currentValue.isConstant() || !vertexBuffer) {
             return gl::DisabledAttribute();
         } else {
             return Attribute::binding(*vertexBuffer, 0);
@@ -233,13 +367,19 @@ public:
         }
     }
 
+    std::array<float, 4> featureUniformValue() const override {
+        return featureUniform;
+    }
+
 private:
     style::CompositeFunction<T> function;
     T defaultValue;
     using CoveringRanges = typename style::CompositeFunction<T>::CoveringRanges;
     Range<CoveringRanges> rangeOfCoveringRanges;
-    gl::VertexVector<Vertex> vertexVector;
+    style::EvaluationCache<Range<T>> cache;
+    std::vector<Range<T>> featureValues;
     optional<gl::VertexBuffer<Vertex>> vertexBuffer;
+    std::array<float, 4> featureUniform {{ 0, 0, 0, 0 }};
 };
 
 template <class T, class A>
@@ -272,6 +412,14 @@ struct InterpolationUniform : gl::UniformScalar<InterpolationUniform<Attr>, floa
     }
 };
 
+template <class Attr>
+struct FeatureUniform : gl::UniformVector<FeatureUniform<Attr>, float, 4> {
+    static auto name() {
+        static const std::string name = Attr::name() + std::string("_feature");
+        return name.c_str();
+    }
+};
+
 template <class Ps>
 class PaintPropertyBinders;
 
@@ -294,32 +442,88 @@ public:
     PaintPropertyBinders(PaintPropertyBinders&&) = default;
     PaintPropertyBinders(const PaintPropertyBinders&) = delete;
 
+    // Evaluates the properties for the feature, whose vertices end at `length`.
     void populateVertexVectors(const GeometryTileFeature& feature, std::size_t length) {
+        if (length == (featureVertexEnds.empty() ? 0 : featureVertexEnds.back())) {
+            // The feature has no vertices, so its values aren't needed.
+            return;
+        }
+        featureVertexEnds.push_back(length);
         util::ignore({
-            (binders.template get<Ps>()->populateVertexVector(feature, length), 0)...
+            (binders.template get<Ps>()->populateFeatureValue(feature), 0)...
         });
     }
 
     void upload(gl::Context& context) {
+        std::size_t blocks = 0;
+        std::size_t vertexSize = 0;
         util::ignore({
-            (binders.template get<Ps>()->upload(context), 0)...
+            (blocks += binders.template get<Ps>()->featureTextureBlocks(),
+             vertexSize += binders.template get<Ps>()->vertexSize(), 0)...
         });
+
+        optional<FeatureTexture> texture;
+        if (blocks > 0 && context.supportsVertexTextures()) {
+            texture = FeatureTexture::create(featureVertexEnds.size(), blocks, context.getMaxTextureSize());
+        }
+
+        // The feature texture replaces the attributes of all properties with a single one, but is
+        // only worth it if that saves memory.
+        const std::size_t vertices = featureVertexEnds.empty() ? 0 : featureVertexEnds.back();
+        if (texture && texture->image.bytes() + vertices * sizeof(FeatureVertex) < vertices * vertexSize) {
+            std::size_t block = 0;
+            util::ignore({
+                (binders.template get<Ps>()->populateFeatureTexture(*texture, block),
+                 block += binders.template get<Ps>()->featureTextureBlocks(), 0)...
+            });
+
+            gl::VertexVector<FeatureVertex> vertexVector;
+            for (std::size_t i = 0; i < featureVertexEnds.size(); ++i) {
+                const auto position = texture->position(i);
+                for (std::size_t v = vertexVector.vertexSize(); v < featureVertexEnds[i]; ++v) {
+                    vertexVector.emplace_back(FeatureVertex { position });
+                }
+            }
+            featureVertexBuffer = context.createVertexBuffer(std::move(vertexVector));
+            featureTexture = context.createTexture(texture->image, gl::VertexTextureUnit);
+        } else {
+            util::ignore({
+                (binders.template get<Ps>()->upload(context, featureVertexEnds), 0)...
+            });
+        }
+
+        featureVertexEnds = std::vector<std::size_t>();
+    }
+
+    optional<gl::TextureID> featureTextureID() const {
+        if (featureTexture) {
+            return featureTexture->texture.get();
+        }
+        return {};
     }
 
     template <class P>
     using Attribute = ZoomInterpolatedAttribute<typename P::Attribute>;
 
-    using Attributes = gl::Attributes<Attribute<Ps>...>;
+    using Attributes = gl::Attributes<Attribute<Ps>..., attributes::a_feature>;
     using AttributeBindings = typename Attributes::Bindings;
 
     template <class EvaluatedProperties>
     AttributeBindings attributeBindings(const EvaluatedProperties& currentProperties) const {
         return AttributeBindings {
-            binders.template get<Ps>()->attributeBinding(currentProperties.template get<Ps>())...
+            binders.template get<Ps>()->attributeBinding(currentProperties.template get<Ps>())...,
+            featureVertexBuffer
+                ? attributes::a_feature::Type::binding(*featureVertexBuffer, 0)
+                : attributes::a_feature::Type::Binding(gl::DisabledAttribute())
         };
     }
 
-    using Uniforms = gl::Uniforms<InterpolationUniform<typename Ps::Attribute>..., typename Ps::Uniform...>;
+    using Uniforms = gl::Uniforms<
+        InterpolationUniform<typename Ps::Attribute>...,
+        FeatureUniform<typename Ps::Attribute>...,
+        typename Ps::Uniform...,
+        uniforms::u_feature_texture,
+        uniforms::u_feature_texture_size>;
     using UniformValues = typename Uniforms::Values;
 
     template <class EvaluatedProperties>
@@ -329,9 +533,14 @@ public:
             typename InterpolationUniform<typename Ps::Attribute>::Value {
                 binders.template get<Ps>()->interpolationFactor(currentZoom)
             }...,
+            typename FeatureUniform<typename Ps::Attribute>::Value {
+                binders.template get<Ps>()->featureUniformValue()
+            }...,
             typename Ps::Uniform::Value {
                 binders.template get<Ps>()->uniformValue(currentProperties.template get<Ps>())
-            }...
+            }...,
+            uniforms::u_feature_texture::Value{ gl::VertexTextureUnit },
+            uniforms::u_feature_texture_size::Value{ featureTexture ? featureTexture->size : Size() }
         };
     }
 
@@ -341,31 +550,45 @@ public:
     }
 
 
-    using Bitset = std::bitset<sizeof...(Ps)>;
+    // One bit for every property that is constant, and one for whether the others are read from
+    // the feature texture. Each combination needs different shaders.
+    using Bitset = std::bitset<sizeof...(Ps) + 1>;
 
     template <class EvaluatedProperties>
-    static Bitset constants(const EvaluatedProperties& currentProperties) {
+    Bitset programKey(const EvaluatedProperties& currentProperties) const {
         Bitset result;
         util::ignore({
             result.set(TypeIndex<Ps, Ps...>::value,
                        currentProperties.template get<Ps>().isConstant())...
         });
+        result.set(sizeof...(Ps), bool(featureTexture));
         return result;
     }
 
     template <class EvaluatedProperties>
-    static std::vector<std::string> defines(const EvaluatedProperties& currentProperties) {
+    std::vector<std::string> defines(const EvaluatedProperties& currentProperties) const {
         std::vector<std::string> result;
         util::ignore({
             (result.push_back(currentProperties.template get<Ps>().isConstant()
                 ? std::string("#define HAS_UNIFORM_") + Ps::Uniform::name()
                 : std::string()), 0)...
         });
+        if (featureTexture) {
+            result.push_back("#define HAS_FEATURE_TEXTURE");
+        }
         return result;
     }
 
 private:
+    using FeatureVertex = gl::detail::Vertex<attributes::a_feature::Type>;
+
     Binders binders;
+
+    // The end of the vertices of each feature with vertices, until the bucket is uploaded.
+    std::vector<std::size_t> featureVertexEnds;
+
+    optional<gl::Texture> featureTexture;
+    optional<gl::VertexBuffer<FeatureVertex>> featureVertexBuffer;
 };
 
 } // namespace mbgl
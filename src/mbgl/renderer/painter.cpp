@@ -123,6 +123,9 @@ void Painter::cleanup() {
 }
 
 void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
+    const TimePoint renderStart = Clock::now();
+    const gl::Context::Statistics initialStatistics = context.statistics;
+
     frame = frame_;
     if (frame.contextMode == GLContextMode::Shared) {
         context.setDirtyState();
@@ -146,6 +149,12 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
     const std::vector<RenderItem>& order = renderData.order;
     const std::unordered_set<RenderSource*>& sources = renderData.sources;
 
+    stats.timings = {};
+    stats.layers.clear();
+    for (const auto& item : order) {
+        stats.layers.push_back({ item.layer.getID(), 0 });
+    }
+
     // Update the default matrices to the current viewport dimensions.
     state.getProjMatrix(projMatrix);
     // Calculate a second projection matrix with the near plane clipped to 100 so as
@@ -164,6 +173,7 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
 
     // - UPLOAD PASS -------------------------------------------------------------------------------
     // Uploads all required buffers and images before we do any actual rendering.
+    TimePoint passStart = Clock::now();
     {
         MBGL_DEBUG_GROUP(context, "upload");
 
@@ -171,6 +181,7 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
         lineAtlas->upload(context, 0);
         frameHistory.upload(context, 0);
     }
+    stats.timings.upload = Clock::now() - passStart;
 
     // - CLEAR -------------------------------------------------------------------------------------
     // Renders the backdrop of the OpenGL view. This also paints in areas where we don't have any
@@ -187,6 +198,7 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
 
     // - CLIPPING MASKS ----------------------------------------------------------------------------
     // Draws the clipping masks to the stencil buffer.
+    passStart = Clock::now();
     {
         MBGL_DEBUG_GROUP(context, "clip");
 
@@ -203,6 +215,7 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
             renderClippingMask(clipID.first, clipID.second);
         }
     }
+    stats.timings.clip = Clock::now() - passStart;
 
 #if not MBGL_USE_GLES2 and not defined(NDEBUG)
     if (frame.debugOptions & MapDebugOptions::StencilClip) {
@@ -218,17 +231,21 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
 
     // - OPAQUE PASS -------------------------------------------------------------------------------
     // Render everything top-to-bottom by using reverse iterators. Render opaque objects first.
+    passStart = Clock::now();
     renderPass(parameters,
                RenderPass::Opaque,
                order.rbegin(), order.rend(),
                0, 1);
+    stats.timings.opaque = Clock::now() - passStart;
 
     // - TRANSLUCENT PASS --------------------------------------------------------------------------
     // Make a second pass, rendering translucent objects. This time, we render bottom-to-top.
+    passStart = Clock::now();
     renderPass(parameters,
                RenderPass::Translucent,
                order.begin(), order.end(),
                static_cast<uint32_t>(order.size()) - 1, -1);
+    stats.timings.translucent = Clock::now() - passStart;
 
     if (debug::renderTree) { Log::Info(Event::Render, "}"); indent--; }
 
@@ -257,6 +274,8 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
     {
         MBGL_DEBUG_GROUP(context, "cleanup");
 
+        context.activeTexture = 2;
+        context.texture[2] = 0;
         context.activeTexture = 1;
         context.texture[1] = 0;
         context.activeTexture = 0;
@@ -264,6 +283,30 @@ void Painter::render(RenderStyle& style, const FrameData& frame_, View& view) {
 
         context.vertexArrayObject = 0;
     }
+
+    // - STATISTICS --------------------------------------------------------------------------------
+    const gl::Context::Statistics& statistics = context.statistics;
+
+    stats.drawCalls = statistics.drawCalls - initialStatistics.drawCalls;
+    stats.stateChanges = statistics.stateChanges - initialStatistics.stateChanges;
+    stats.uploads.bufferBytes = statistics.bufferBytesUploaded - initialStatistics.bufferBytesUploaded;
+    stats.uploads.textureBytes = statistics.textureBytesUploaded - initialStatistics.textureBytesUploaded;
+
+    stats.objects.bufferBytes = statistics.bufferBytes;
+    stats.objects.programs = statistics.programs;
+    stats.objects.shaders = statistics.shaders;
+    stats.objects.buffers = statistics.buffers;
+    stats.objects.textures = statistics.textures;
+    stats.objects.vertexArrays = statistics.vertexArrays;
+    stats.objects.framebuffers = statistics.framebuffers;
+    stats.objects.renderbuffers = statistics.renderbuffers;
+
+    stats.tiles = {};
+    for (const auto& source : sources) {
+        source->countTiles(stats.tiles);
+    }
+
+    stats.timings.total = Clock::now() - renderStart;
 }
 
 template <class Iterator>
@@ -280,6 +323,13 @@ void Painter::renderPass(PaintParameters& parameters,
                   pass == RenderPass::Opaque ? "opaque" : "translucent");
     }
 
+    // Opaque draws are depth tested, and each layer has its own depth range, so they give the same
+    // result in any order. Only the fill-extrusion layer, which has its own framebuffer, is
+    // rendered differently, and it has no opaque draws.
+    if (pass == RenderPass::Opaque && !context.disableDrawSorting) {
+        context.drawQueue = &opaqueDraws;
+    }
+
     for (; it != end; ++it, i += increment) {
         currentLayer = i;
 
@@ -289,6 +339,8 @@ void Painter::renderPass(PaintParameters& parameters,
         if (!layer.hasRenderPass(pass))
             continue;
 
+        const std::size_t drawCalls = context.statistics.drawCalls;
+
         if (layer.is<RenderBackgroundLayer>()) {
             MBGL_DEBUG_GROUP(context, "background");
             renderBackground(parameters, *layer.as<RenderBackgroundLayer>());
@@ -329,6 +381,14 @@ void Painter::renderPass(PaintParameters& parameters,
         } else {
             renderItem(parameters, item);
         }
+
+        // Layers are numbered from the top.
+        stats.layers[stats.layers.size() - 1 - i].drawCalls += context.statistics.drawCalls - drawCalls;
+    }
+
+    if (context.drawQueue) {
+        context.drawQueue = nullptr;
+        opaqueDraws.flush();
     }
 
     if (debug::renderTree) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/map/transform_state.hpp>
+#include <mbgl/map/rendering_stats.hpp>
 
 #include <mbgl/tile/tile_id.hpp>
 
@@ -10,6 +11,7 @@
 #include <mbgl/renderer/render_light.hpp>
 
 #include <mbgl/gl/context.hpp>
+#include <mbgl/gl/draw_queue.hpp>
 #include <mbgl/programs/debug_program.hpp>
 #include <mbgl/programs/program_parameters.hpp>
 #include <mbgl/programs/fill_program.hpp>
@@ -142,6 +144,9 @@ public:
 
     FrameData frame;
 
+    // Statistics of the last rendered frame.
+    RenderingStats stats;
+
     int indent = 0;
 
     RenderPass pass = RenderPass::Opaque;
@@ -156,6 +161,9 @@ public:
 
     optional<OffscreenTexture> extrusionTexture;
 
+    // Draws of the opaque pass, which are sorted to reduce state changes.
+    gl::DrawQueue opaqueDraws;
+
     EvaluatedLight evaluatedLight;
 
     FrameHistory frameHistory;
@@ -23,8 +23,9 @@ void Painter::renderCircle(PaintParameters& parameters,
     const CirclePaintProperties::PossiblyEvaluated& properties = layer.evaluated;
     const bool scaleWithMap = properties.get<CirclePitchScale>() == CirclePitchScaleType::Map;
     const bool pitchWithMap = properties.get<CirclePitchAlignment>() == AlignmentType::Map;
+    const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(layer.getID());
 
-    parameters.programs.circle.get(properties).draw(
+    parameters.programs.circle.get(properties, paintPropertyBinders).draw(
         context,
         gl::Triangles(),
         depthModeForSublayer(0, gl::DepthMode::ReadOnly),
@@ -50,7 +51,7 @@ void Painter::renderCircle(PaintParameters& parameters,
         *bucket.vertexBuffer,
         *bucket.indexBuffer,
         bucket.segments,
-        bucket.paintPropertyBinders.at(layer.getID()),
+        paintPropertyBinders,
         properties,
         state.getZoom()
     );
@@ -8,7 +8,7 @@ namespace mbgl {
 void Painter::renderClippingMask(const UnwrappedTileID& tileID, const ClipID& clip) {
     static const style::FillPaintProperties::PossiblyEvaluated properties {};
     static const FillProgram::PaintPropertyBinders paintAttibuteData(properties, 0);
-    programs->fill.get(properties).draw(
+    programs->fill.get(properties, paintAttibuteData).draw(
         context,
         gl::Triangles(),
         gl::DepthMode::disabled(),
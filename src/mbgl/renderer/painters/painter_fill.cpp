@@ -18,6 +18,7 @@ void Painter::renderFill(PaintParameters& parameters,
                          const RenderFillLayer& layer,
                          const RenderTile& tile) {
     const FillPaintProperties::PossiblyEvaluated& properties = layer.evaluated;
+    const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(layer.getID());
 
     if (!properties.get<FillPattern>().from.empty()) {
         if (pass != RenderPass::Translucent) {
@@ -38,7 +39,7 @@ void Painter::renderFill(PaintParameters& parameters,
                          const auto& drawMode,
                          const auto& indexBuffer,
                          const auto& segments) {
-            program.get(properties).draw(
+            program.get(properties, paintPropertyBinders).draw(
                 context,
                 drawMode,
                 depthModeForSublayer(sublayer, gl::DepthMode::ReadWrite),
@@ -59,7 +60,7 @@ void Painter::renderFill(PaintParameters& parameters,
                 *bucket.vertexBuffer,
                 indexBuffer,
                 segments,
-                bucket.paintPropertyBinders.at(layer.getID()),
+                paintPropertyBinders,
                 properties,
                 state.getZoom()
             );
@@ -86,7 +87,7 @@ void Painter::renderFill(PaintParameters& parameters,
                          const auto& drawMode,
                          const auto& indexBuffer,
                          const auto& segments) {
-            program.get(properties).draw(
+            program.get(properties, paintPropertyBinders).draw(
                 context,
                 drawMode,
                 depthModeForSublayer(sublayer, gl::DepthMode::ReadWrite),
@@ -103,7 +104,7 @@ void Painter::renderFill(PaintParameters& parameters,
                 *bucket.vertexBuffer,
                 indexBuffer,
                 segments,
-                bucket.paintPropertyBinders.at(layer.getID()),
+                paintPropertyBinders,
                 properties,
                 state.getZoom()
             );
@@ -19,6 +19,7 @@ void Painter::renderFillExtrusion(PaintParameters& parameters,
                                   const RenderFillExtrusionLayer& layer,
                                   const RenderTile& tile) {
     const FillExtrusionPaintProperties::PossiblyEvaluated& properties = layer.evaluated;
+    const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(layer.getID());
 
     if (pass == RenderPass::Opaque) {
         return;
@@ -34,7 +35,7 @@ void Painter::renderFillExtrusion(PaintParameters& parameters,
 
         imageManager->bind(context, 0);
 
-        parameters.programs.fillExtrusionPattern.get(properties).draw(
+        parameters.programs.fillExtrusionPattern.get(properties, paintPropertyBinders).draw(
             context,
             gl::Triangles(),
             depthModeForSublayer(0, gl::DepthMode::ReadWrite),
@@ -56,12 +57,12 @@ void Painter::renderFillExtrusion(PaintParameters& parameters,
             *bucket.vertexBuffer,
             *bucket.indexBuffer,
             bucket.triangleSegments,
-            bucket.paintPropertyBinders.at(layer.getID()),
+            paintPropertyBinders,
             properties,
             state.getZoom());
 
     } else {
-        parameters.programs.fillExtrusion.get(properties).draw(
+        parameters.programs.fillExtrusion.get(properties, paintPropertyBinders).draw(
             context,
             gl::Triangles(),
             depthModeForSublayer(0, gl::DepthMode::ReadWrite),
@@ -77,7 +78,7 @@ void Painter::renderFillExtrusion(PaintParameters& parameters,
             *bucket.vertexBuffer,
             *bucket.indexBuffer,
             bucket.triangleSegments,
-            bucket.paintPropertyBinders.at(layer.getID()),
+            paintPropertyBinders,
             properties,
             state.getZoom());
     };
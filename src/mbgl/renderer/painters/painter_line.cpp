@@ -22,9 +22,10 @@ void Painter::renderLine(PaintParameters& parameters,
     }
 
     const RenderLinePaintProperties::PossiblyEvaluated& properties = layer.evaluated;
+    const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(layer.getID());
 
     auto draw = [&] (auto& program, auto&& uniformValues) {
-        program.get(properties).draw(
+        program.get(properties, paintPropertyBinders).draw(
             context,
             gl::Triangles(),
             depthModeForSublayer(0, gl::DepthMode::ReadOnly),
@@ -34,7 +35,7 @@ void Painter::renderLine(PaintParameters& parameters,
             *bucket.vertexBuffer,
             *bucket.indexBuffer,
             bucket.segments,
-            bucket.paintPropertyBinders.at(layer.getID()),
+            paintPropertyBinders,
             properties,
             state.getZoom()
         );
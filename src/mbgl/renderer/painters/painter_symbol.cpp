@@ -2,6 +2,7 @@
 #include <mbgl/renderer/paint_parameters.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/renderer/render_tile.hpp>
+#include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/renderer/layers/render_symbol_layer.hpp>
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/text/glyph_atlas.hpp>
@@ -40,7 +41,7 @@ void Painter::renderSymbol(PaintParameters& parameters,
         // We clip symbols to their tile extent in still mode.
         const bool needsClipping = frame.mapMode == MapMode::Still;
 
-        program.get(paintProperties).draw(
+        program.get(paintProperties, binders).draw(
             context,
             gl::Triangles(),
             values_.pitchAlignment == AlignmentType::Map
@@ -71,11 +72,11 @@ void Painter::renderSymbol(PaintParameters& parameters,
         const bool iconScaled = layout.get<IconSize>().constantOr(1.0) != 1.0 || bucket.iconsNeedLinear;
         const bool iconTransformed = values.rotationAlignment == AlignmentType::Map || state.getPitch() != 0;
 
-        context.bindTexture(*geometryTile.iconAtlasTexture, 0,
+        imageManager->bindIcons(context, 0,
             bucket.sdfIcons || state.isChanging() || iconScaled || iconTransformed
                 ? gl::TextureFilter::Linear : gl::TextureFilter::Nearest);
 
-        const Size texsize = geometryTile.iconAtlasTexture->size;
+        const Size texsize = imageManager->getIconPixelSize();
 
         if (bucket.sdfIcons) {
             if (values.hasHalo) {
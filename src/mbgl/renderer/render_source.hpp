@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/map/rendering_stats.hpp>
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/tile/tile_observer.hpp>
 #include <mbgl/util/mat4.hpp>
@@ -73,6 +74,9 @@ public:
 
     virtual void dumpDebugLogs() const = 0;
 
+    // Adds the tiles of this source to the given statistics.
+    virtual void countTiles(RenderingStats::Tiles&) const = 0;
+
     void setObserver(RenderSourceObserver*);
 
     Immutable<style::Source::Impl> baseImpl;
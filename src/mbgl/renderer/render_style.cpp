@@ -26,6 +26,7 @@
 #include <mbgl/map/backend_scope.hpp>
 #include <mbgl/map/query.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/string.hpp>
 
@@ -41,6 +42,7 @@ RenderStyle::RenderStyle(Scheduler& scheduler_, FileSource& fileSource_)
       glyphManager(std::make_unique<GlyphManager>(fileSource)),
       imageManager(std::make_unique<ImageManager>()),
       lineAtlas(std::make_unique<LineAtlas>(Size{ 256, 512 })),
+      tileDataCache(TileDataCache::get(scheduler)),
       imageImpls(makeMutable<std::vector<Immutable<style::Image::Impl>>>()),
       sourceImpls(makeMutable<std::vector<Immutable<style::Source::Impl>>>()),
       layerImpls(makeMutable<std::vector<Immutable<style::Layer::Impl>>>()),
@@ -105,7 +107,11 @@ void RenderStyle::update(const UpdateParameters& parameters) {
         parameters.mode,
         parameters.annotationManager,
         *imageManager,
-        *glyphManager
+        *glyphManager,
+        *tileDataCache,
+        parameters.transitionDestination,
+        parameters.prefetchZoomDelta,
+        parameters.prefetchTileBudget
     };
 
     glyphManager->setURL(parameters.glyphURL);
@@ -212,8 +218,11 @@ void RenderStyle::update(const UpdateParameters& parameters) {
                 needsRendering = true;
             }
 
+            // Tiles lay out their buckets again only for layout differences, and otherwise just
+            // evaluate the data-driven paint properties again.
             if (!needsRelayout && (
                 hasLayoutDifference(layerDiff, layer->id) ||
+                hasDataDrivenPaintDifference(layerDiff, layer->id) ||
                 !imageDiff.added.empty() ||
                 !imageDiff.removed.empty() ||
                 !imageDiff.changed.empty())) {
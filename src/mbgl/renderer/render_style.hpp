@@ -23,6 +23,7 @@ class RenderData;
 class TransformState;
 class RenderedQueryOptions;
 class Scheduler;
+class TileDataCache;
 class UpdateParameters;
 class RenderStyleObserver;
 
@@ -68,6 +69,7 @@ public:
     std::unique_ptr<GlyphManager> glyphManager;
     std::unique_ptr<ImageManager> imageManager;
     std::unique_ptr<LineAtlas> lineAtlas;
+    std::shared_ptr<TileDataCache> tileDataCache;
 
 private:
     Immutable<std::vector<Immutable<style::Image::Impl>>> imageImpls;
@@ -32,19 +32,26 @@ void RenderGeoJSONSource::update(Immutable<style::Source::Impl> baseImpl_,
 
     enabled = needsRendering;
 
-    GeoJSONData* data_ = impl().getData();
+    std::shared_ptr<GeoJSONData> data_ = impl().getData();
 
     if (!data_) {
         return;
     }
 
     if (data_ != data) {
-        data = data_;
-        tilePyramid.cache.clear();
-
+        // Incremental updates only invalidate the tiles that intersect the changed features.
+        // Cached tiles that they don't invalidate are kept as well.
         for (auto const& item : tilePyramid.tiles) {
-            static_cast<GeoJSONTile*>(item.second.get())->updateData(data->getTile(item.first.canonical));
+            if (!data || impl().invalidates(data, item.first.canonical)) {
+                static_cast<GeoJSONTile*>(item.second.get())->updateData(data_);
+            }
         }
+
+        tilePyramid.cache.removeIf([&] (const OverscaledTileID& tileID) {
+            return !data || impl().invalidates(data, tileID.canonical);
+        });
+
+        data = data_;
     }
 
     tilePyramid.update(layers,
@@ -55,7 +62,7 @@ void RenderGeoJSONSource::update(Immutable<style::Source::Impl> baseImpl_,
                        util::tileSize,
                        impl().getZoomRange(),
                        [&] (const OverscaledTileID& tileID) {
-                           return std::make_unique<GeoJSONTile>(tileID, impl().id, parameters, data->getTile(tileID.canonical));
+                           return std::make_unique<GeoJSONTile>(tileID, impl().id, parameters, data);
                        });
 }
 
@@ -92,4 +99,8 @@ void RenderGeoJSONSource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
 
+void RenderGeoJSONSource::countTiles(RenderingStats::Tiles& stats) const {
+    tilePyramid.countTiles(stats);
+}
+
 } // namespace mbgl
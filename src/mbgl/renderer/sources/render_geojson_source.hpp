@@ -38,12 +38,13 @@ public:
 
     void onLowMemory() final;
     void dumpDebugLogs() const final;
+    void countTiles(RenderingStats::Tiles&) const final;
 
 private:
     const style::GeoJSONSource::Impl& impl() const;
 
     TilePyramid tilePyramid;
-    style::GeoJSONData* data;
+    std::shared_ptr<style::GeoJSONData> data;
 };
 
 template <>
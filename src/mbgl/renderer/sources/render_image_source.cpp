@@ -177,4 +177,8 @@ void RenderImageSource::dumpDebugLogs() const {
     Log::Info(Event::General, "RenderImageSource::loaded: %s", isLoaded() ? "yes" : "no");
 }
 
+void RenderImageSource::countTiles(RenderingStats::Tiles&) const {
+    // Image sources aren't tiled.
+}
+
 } // namespace mbgl
@@ -45,6 +45,7 @@ public:
     void onLowMemory() final {
     }
     void dumpDebugLogs() const final;
+    void countTiles(RenderingStats::Tiles&) const final;
 
 private:
     const style::ImageSource::Impl& impl() const;
@@ -88,4 +88,8 @@ void RenderRasterSource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
 
+void RenderRasterSource::countTiles(RenderingStats::Tiles& stats) const {
+    tilePyramid.countTiles(stats);
+}
+
 } // namespace mbgl
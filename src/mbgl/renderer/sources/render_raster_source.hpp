@@ -34,6 +34,7 @@ public:
 
     void onLowMemory() final;
     void dumpDebugLogs() const final;
+    void countTiles(RenderingStats::Tiles&) const final;
 
 private:
     const style::RasterSource::Impl& impl() const;
@@ -93,4 +93,8 @@ void RenderVectorSource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
 
+void RenderVectorSource::countTiles(RenderingStats::Tiles& stats) const {
+    tilePyramid.countTiles(stats);
+}
+
 } // namespace mbgl
@@ -76,4 +76,11 @@ bool hasLayoutDifference(const LayerDifference& layerDiff, const std::string& la
     return it->second.before->hasLayoutDifference(*it->second.after);
 }
 
+bool hasDataDrivenPaintDifference(const LayerDifference& layerDiff, const std::string& layerID) {
+    const auto it = layerDiff.changed.find(layerID);
+    if (it == layerDiff.changed.end())
+        return false;
+    return it->second.before->hasDataDrivenPaintDifference(*it->second.after);
+}
+
 } // namespace mbgl
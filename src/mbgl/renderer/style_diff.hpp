@@ -44,5 +44,6 @@ LayerDifference diffLayers(const Immutable<std::vector<ImmutableLayer>>&,
                            const Immutable<std::vector<ImmutableLayer>>&);
 
 bool hasLayoutDifference(const LayerDifference&, const std::string& layerID);
+bool hasDataDrivenPaintDifference(const LayerDifference&, const std::string& layerID);
 
 } // namespace mbgl
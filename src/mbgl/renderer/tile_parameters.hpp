@@ -1,15 +1,19 @@
 #pragma once
 
 #include <mbgl/map/mode.hpp>
+#include <mbgl/map/transform_state.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <cstdint>
 
 namespace mbgl {
 
-class TransformState;
 class Scheduler;
 class FileSource;
 class AnnotationManager;
 class ImageManager;
 class GlyphManager;
+class TileDataCache;
 
 class TileParameters {
 public:
@@ -22,6 +26,12 @@ public:
     AnnotationManager& annotationManager;
     ImageManager& imageManager;
     GlyphManager& glyphManager;
+    TileDataCache& tileDataCache;
+
+    // Tiles that are requested in advance, in continuous mode.
+    optional<TransformState> transitionDestination;
+    uint8_t prefetchZoomDelta;
+    uint32_t prefetchTileBudget;
 };
 
 } // namespace mbgl
@@ -23,6 +23,18 @@ using namespace style;
 
 static TileObserver nullObserver;
 
+// Pitched views show the tiles in the distance at lower zoom levels.
+static std::vector<UnwrappedTileID> idealTileCover(const TransformState& state,
+                                                   int32_t idealZoom,
+                                                   int32_t minZoom,
+                                                   int32_t overscaledZoom) {
+    if (state.getPitch() > 0) {
+        return util::tileCoverWithLOD(state, idealZoom, minZoom, overscaledZoom);
+    } else {
+        return util::tileCover(state, idealZoom);
+    }
+}
+
 TilePyramid::TilePyramid()
     : observer(&nullObserver) {
 }
@@ -31,7 +43,8 @@ TilePyramid::~TilePyramid() = default;
 
 bool TilePyramid::isLoaded() const {
     for (const auto& pair : tiles) {
-        if (!pair.second->isComplete()) {
+        // Prefetched tiles aren't rendered yet, so they don't hold up loading.
+        if (!pair.second->isComplete() && !prefetchedTiles.count(pair.first)) {
             return false;
         }
     }
@@ -81,6 +94,7 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
 
         tiles.clear();
         renderTiles.clear();
+        prefetchedTiles.clear();
 
         return;
     }
@@ -89,16 +103,16 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
     int32_t overscaledZoom = util::coveringZoomLevel(parameters.transformState.getZoom(), type, tileSize);
     int32_t tileZoom = overscaledZoom;
 
+    int32_t idealZoom = std::min<int32_t>(zoomRange.max, overscaledZoom);
+
     std::vector<UnwrappedTileID> idealTiles;
     if (overscaledZoom >= zoomRange.min) {
-        int32_t idealZoom = std::min<int32_t>(zoomRange.max, overscaledZoom);
-
         // Make sure we're not reparsing overzoomed raster tiles.
         if (type == SourceType::Raster) {
             tileZoom = idealZoom;
         }
 
-        idealTiles = util::tileCover(parameters.transformState, idealZoom);
+        idealTiles = idealTileCover(parameters.transformState, idealZoom, zoomRange.min, overscaledZoom);
     }
 
     // Stores a list of all the tiles that we're definitely going to retain. There are two
@@ -137,9 +151,65 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
     };
 
     renderTiles.clear();
+    prefetchedTiles.clear();
     algorithm::updateRenderables(getTileFn, createTileFn, retainTileFn, renderTileFn,
                                  idealTiles, zoomRange, tileZoom);
 
+    // Request tiles in advance, after the ideal tiles: the parents of the ideal tiles, which load
+    // quickly and stand in for missing tiles while panning or zooming out, and the tiles at the
+    // destination of a camera animation. They're requested like the ideal tiles, but they aren't
+    // rendered until they become ideal tiles, so isLoaded() doesn't wait for them.
+    if (parameters.mode == MapMode::Continuous && parameters.prefetchTileBudget > 0) {
+        std::vector<OverscaledTileID> prefetchIDs;
+
+        const int32_t parentZoom =
+            std::max<int32_t>(idealZoom - parameters.prefetchZoomDelta, zoomRange.min);
+        if (overscaledZoom >= zoomRange.min && parentZoom < idealZoom) {
+            for (const auto& tileID : util::tileCover(parameters.transformState, parentZoom)) {
+                prefetchIDs.emplace_back(parentZoom, tileID.canonical);
+            }
+        }
+
+        if (parameters.transitionDestination) {
+            const TransformState& destination = *parameters.transitionDestination;
+            const int32_t destinationOverscaledZoom =
+                util::coveringZoomLevel(destination.getZoom(), type, tileSize);
+            const int32_t destinationIdealZoom =
+                std::min<int32_t>(zoomRange.max, destinationOverscaledZoom);
+            const int32_t destinationTileZoom =
+                type == SourceType::Raster ? destinationIdealZoom : destinationOverscaledZoom;
+
+            if (destinationOverscaledZoom >= zoomRange.min) {
+                for (const auto& tileID : idealTileCover(destination, destinationIdealZoom,
+                                                         zoomRange.min, destinationOverscaledZoom)) {
+                    const int32_t z = tileID.canonical.z == destinationIdealZoom
+                        ? destinationTileZoom : tileID.canonical.z;
+                    prefetchIDs.emplace_back(z, tileID.canonical);
+                }
+            }
+        }
+
+        uint32_t budget = parameters.prefetchTileBudget;
+        for (const auto& tileID : prefetchIDs) {
+            if (budget == 0) {
+                break;
+            }
+            if (retain.count(tileID)) {
+                continue;
+            }
+
+            Tile* tile = getTileFn(tileID);
+            if (!tile) {
+                tile = createTileFn(tileID);
+            }
+            if (tile) {
+                retainTileFn(*tile, Resource::Necessity::Required);
+                prefetchedTiles.insert(tileID);
+                budget--;
+            }
+        }
+    }
+
     if (type != SourceType::Annotations) {
         size_t conservativeCacheSize =
             std::max((float)parameters.transformState.getSize().width / tileSize, 1.0f) *
@@ -260,4 +330,20 @@ void TilePyramid::dumpDebugLogs() const {
     }
 }
 
+void TilePyramid::countTiles(RenderingStats::Tiles& stats) const {
+    for (const auto& pair : tiles) {
+        const Tile& tile = *pair.second;
+        if (!tile.isLoaded()) {
+            stats.loading++;
+        } else if (!tile.isComplete()) {
+            stats.parsing++;
+        } else {
+            stats.complete++;
+        }
+        if (tile.isRenderable()) {
+            stats.renderable++;
+        }
+    }
+}
+
 } // namespace mbgl
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/map/rendering_stats.hpp>
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/tile/tile_observer.hpp>
 #include <mbgl/tile/tile.hpp>
@@ -15,6 +16,7 @@
 #include <unordered_map>
 #include <vector>
 #include <map>
+#include <set>
 
 namespace mbgl {
 
@@ -60,6 +62,7 @@ public:
 
     void setObserver(TileObserver*);
     void dumpDebugLogs() const;
+    void countTiles(RenderingStats::Tiles&) const;
 
     bool enabled = false;
 
@@ -68,6 +71,9 @@ public:
     std::map<OverscaledTileID, std::unique_ptr<Tile>> tiles;
     TileCache cache;
 
+    // Tiles that are retained in advance of being rendered.
+    std::set<OverscaledTileID> prefetchedTiles;
+
     std::vector<RenderTile> renderTiles;
 
     TileObserver* observer = nullptr;
@@ -3,6 +3,7 @@
 #include <mbgl/map/mode.hpp>
 #include <mbgl/map/transform_state.hpp>
 #include <mbgl/util/chrono.hpp>
+#include <mbgl/util/optional.hpp>
 #include <mbgl/style/light.hpp>
 #include <mbgl/style/image.hpp>
 #include <mbgl/style/source.hpp>
@@ -21,6 +22,9 @@ public:
     const MapDebugOptions debugOptions;
     const TimePoint timePoint;
     const TransformState transformState;
+    const optional<TransformState> transitionDestination;
+    const uint8_t prefetchZoomDelta;
+    const uint32_t prefetchTileBudget;
 
     const std::string glyphURL;
     const bool spriteLoaded;
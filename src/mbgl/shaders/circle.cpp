@@ -18,7 +18,11 @@ attribute vec2 a_pos;
 
 #ifndef HAS_UNIFORM_u_color
 uniform lowp float a_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_color_feature;
+#else
 attribute highp vec4 a_color;
+#endif
 varying highp vec4 color;
 #else
 uniform highp vec4 u_color;
@@ -26,7 +30,11 @@ uniform highp vec4 u_color;
 
 #ifndef HAS_UNIFORM_u_radius
 uniform lowp float a_radius_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_radius_feature;
+#else
 attribute mediump vec2 a_radius;
+#endif
 varying mediump float radius;
 #else
 uniform mediump float u_radius;
@@ -34,7 +42,11 @@ uniform mediump float u_radius;
 
 #ifndef HAS_UNIFORM_u_blur
 uniform lowp float a_blur_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_blur_feature;
+#else
 attribute lowp vec2 a_blur;
+#endif
 varying lowp float blur;
 #else
 uniform lowp float u_blur;
@@ -42,7 +54,11 @@ uniform lowp float u_blur;
 
 #ifndef HAS_UNIFORM_u_opacity
 uniform lowp float a_opacity_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_opacity_feature;
+#else
 attribute lowp vec2 a_opacity;
+#endif
 varying lowp float opacity;
 #else
 uniform lowp float u_opacity;
@@ -50,7 +66,11 @@ uniform lowp float u_opacity;
 
 #ifndef HAS_UNIFORM_u_stroke_color
 uniform lowp float a_stroke_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_stroke_color_feature;
+#else
 attribute highp vec4 a_stroke_color;
+#endif
 varying highp vec4 stroke_color;
 #else
 uniform highp vec4 u_stroke_color;
@@ -58,7 +78,11 @@ uniform highp vec4 u_stroke_color;
 
 #ifndef HAS_UNIFORM_u_stroke_width
 uniform lowp float a_stroke_width_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_stroke_width_feature;
+#else
 attribute mediump vec2 a_stroke_width;
+#endif
 varying mediump float stroke_width;
 #else
 uniform mediump float u_stroke_width;
@@ -66,7 +90,11 @@ uniform mediump float u_stroke_width;
 
 #ifndef HAS_UNIFORM_u_stroke_opacity
 uniform lowp float a_stroke_opacity_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_stroke_opacity_feature;
+#else
 attribute lowp vec2 a_stroke_opacity;
+#endif
 varying lowp float stroke_opacity;
 #else
 uniform lowp float u_stroke_opacity;
@@ -77,43 +105,71 @@ varying vec3 v_data;
 void main(void) {
 
 #ifndef HAS_UNIFORM_u_color
+#ifdef HAS_FEATURE_TEXTURE
+    color = feature_mix_vec4(a_color_feature, a_color_t);
+#else
     color = unpack_mix_vec4(a_color, a_color_t);
+#endif
 #else
     highp vec4 color = u_color;
 #endif
 
 #ifndef HAS_UNIFORM_u_radius
+#ifdef HAS_FEATURE_TEXTURE
+    radius = feature_mix_vec2(a_radius_feature, a_radius_t);
+#else
     radius = unpack_mix_vec2(a_radius, a_radius_t);
+#endif
 #else
     mediump float radius = u_radius;
 #endif
 
 #ifndef HAS_UNIFORM_u_blur
+#ifdef HAS_FEATURE_TEXTURE
+    blur = feature_mix_vec2(a_blur_feature, a_blur_t);
+#else
     blur = unpack_mix_vec2(a_blur, a_blur_t);
+#endif
 #else
     lowp float blur = u_blur;
 #endif
 
 #ifndef HAS_UNIFORM_u_opacity
+#ifdef HAS_FEATURE_TEXTURE
+    opacity = feature_mix_vec2(a_opacity_feature, a_opacity_t);
+#else
     opacity = unpack_mix_vec2(a_opacity, a_opacity_t);
+#endif
 #else
     lowp float opacity = u_opacity;
 #endif
 
 #ifndef HAS_UNIFORM_u_stroke_color
+#ifdef HAS_FEATURE_TEXTURE
+    stroke_color = feature_mix_vec4(a_stroke_color_feature, a_stroke_color_t);
+#else
     stroke_color = unpack_mix_vec4(a_stroke_color, a_stroke_color_t);
+#endif
 #else
     highp vec4 stroke_color = u_stroke_color;
 #endif
 
 #ifndef HAS_UNIFORM_u_stroke_width
+#ifdef HAS_FEATURE_TEXTURE
+    stroke_width = feature_mix_vec2(a_stroke_width_feature, a_stroke_width_t);
+#else
     stroke_width = unpack_mix_vec2(a_stroke_width, a_stroke_width_t);
+#endif
 #else
     mediump float stroke_width = u_stroke_width;
 #endif
 
 #ifndef HAS_UNIFORM_u_stroke_opacity
+#ifdef HAS_FEATURE_TEXTURE
+    stroke_opacity = feature_mix_vec2(a_stroke_opacity_feature, a_stroke_opacity_t);
+#else
     stroke_opacity = unpack_mix_vec2(a_stroke_opacity, a_stroke_opacity_t);
+#endif
 #else
     lowp float stroke_opacity = u_stroke_opacity;
 #endif
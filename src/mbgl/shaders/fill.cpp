@@ -14,7 +14,11 @@ uniform mat4 u_matrix;
 
 #ifndef HAS_UNIFORM_u_color
 uniform lowp float a_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_color_feature;
+#else
 attribute highp vec4 a_color;
+#endif
 varying highp vec4 color;
 #else
 uniform highp vec4 u_color;
@@ -22,7 +26,11 @@ uniform highp vec4 u_color;
 
 #ifndef HAS_UNIFORM_u_opacity
 uniform lowp float a_opacity_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_opacity_feature;
+#else
 attribute lowp vec2 a_opacity;
+#endif
 varying lowp float opacity;
 #else
 uniform lowp float u_opacity;
@@ -31,13 +39,21 @@ uniform lowp float u_opacity;
 void main() {
 
 #ifndef HAS_UNIFORM_u_color
+#ifdef HAS_FEATURE_TEXTURE
+    color = feature_mix_vec4(a_color_feature, a_color_t);
+#else
     color = unpack_mix_vec4(a_color, a_color_t);
+#endif
 #else
     highp vec4 color = u_color;
 #endif
 
 #ifndef HAS_UNIFORM_u_opacity
+#ifdef HAS_FEATURE_TEXTURE
+    opacity = feature_mix_vec2(a_opacity_feature, a_opacity_t);
+#else
     opacity = unpack_mix_vec2(a_opacity, a_opacity_t);
+#endif
 #else
     lowp float opacity = u_opacity;
 #endif
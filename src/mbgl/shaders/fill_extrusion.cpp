@@ -21,7 +21,11 @@ varying vec4 v_color;
 
 #ifndef HAS_UNIFORM_u_base
 uniform lowp float a_base_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_base_feature;
+#else
 attribute lowp vec2 a_base;
+#endif
 varying lowp float base;
 #else
 uniform lowp float u_base;
@@ -29,7 +33,11 @@ uniform lowp float u_base;
 
 #ifndef HAS_UNIFORM_u_height
 uniform lowp float a_height_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_height_feature;
+#else
 attribute lowp vec2 a_height;
+#endif
 varying lowp float height;
 #else
 uniform lowp float u_height;
@@ -38,7 +46,11 @@ uniform lowp float u_height;
 
 #ifndef HAS_UNIFORM_u_color
 uniform lowp float a_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_color_feature;
+#else
 attribute highp vec4 a_color;
+#endif
 varying highp vec4 color;
 #else
 uniform highp vec4 u_color;
@@ -47,19 +59,31 @@ uniform highp vec4 u_color;
 void main() {
 
 #ifndef HAS_UNIFORM_u_base
+#ifdef HAS_FEATURE_TEXTURE
+    base = feature_mix_vec2(a_base_feature, a_base_t);
+#else
     base = unpack_mix_vec2(a_base, a_base_t);
+#endif
 #else
     lowp float base = u_base;
 #endif
 
 #ifndef HAS_UNIFORM_u_height
+#ifdef HAS_FEATURE_TEXTURE
+    height = feature_mix_vec2(a_height_feature, a_height_t);
+#else
     height = unpack_mix_vec2(a_height, a_height_t);
+#endif
 #else
     lowp float height = u_height;
 #endif
 
 #ifndef HAS_UNIFORM_u_color
+#ifdef HAS_FEATURE_TEXTURE
+    color = feature_mix_vec4(a_color_feature, a_color_t);
+#else
     color = unpack_mix_vec4(a_color, a_color_t);
+#endif
 #else
     highp vec4 color = u_color;
 #endif
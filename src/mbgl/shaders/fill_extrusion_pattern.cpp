@@ -33,7 +33,11 @@ varying float v_directional;
 
 #ifndef HAS_UNIFORM_u_base
 uniform lowp float a_base_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_base_feature;
+#else
 attribute lowp vec2 a_base;
+#endif
 varying lowp float base;
 #else
 uniform lowp float u_base;
@@ -41,7 +45,11 @@ uniform lowp float u_base;
 
 #ifndef HAS_UNIFORM_u_height
 uniform lowp float a_height_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_height_feature;
+#else
 attribute lowp vec2 a_height;
+#endif
 varying lowp float height;
 #else
 uniform lowp float u_height;
@@ -50,13 +58,21 @@ uniform lowp float u_height;
 void main() {
 
 #ifndef HAS_UNIFORM_u_base
+#ifdef HAS_FEATURE_TEXTURE
+    base = feature_mix_vec2(a_base_feature, a_base_t);
+#else
     base = unpack_mix_vec2(a_base, a_base_t);
+#endif
 #else
     lowp float base = u_base;
 #endif
 
 #ifndef HAS_UNIFORM_u_height
+#ifdef HAS_FEATURE_TEXTURE
+    height = feature_mix_vec2(a_height_feature, a_height_t);
+#else
     height = unpack_mix_vec2(a_height, a_height_t);
+#endif
 #else
     lowp float height = u_height;
 #endif
@@ -17,7 +17,11 @@ varying vec2 v_pos;
 
 #ifndef HAS_UNIFORM_u_outline_color
 uniform lowp float a_outline_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_outline_color_feature;
+#else
 attribute highp vec4 a_outline_color;
+#endif
 varying highp vec4 outline_color;
 #else
 uniform highp vec4 u_outline_color;
@@ -25,7 +29,11 @@ uniform highp vec4 u_outline_color;
 
 #ifndef HAS_UNIFORM_u_opacity
 uniform lowp float a_opacity_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_opacity_feature;
+#else
 attribute lowp vec2 a_opacity;
+#endif
 varying lowp float opacity;
 #else
 uniform lowp float u_opacity;
@@ -34,13 +42,21 @@ uniform lowp float u_opacity;
 void main() {
 
 #ifndef HAS_UNIFORM_u_outline_color
+#ifdef HAS_FEATURE_TEXTURE
+    outline_color = feature_mix_vec4(a_outline_color_feature, a_outline_color_t);
+#else
     outline_color = unpack_mix_vec4(a_outline_color, a_outline_color_t);
+#endif
 #else
     highp vec4 outline_color = u_outline_color;
 #endif
 
 #ifndef HAS_UNIFORM_u_opacity
+#ifdef HAS_FEATURE_TEXTURE
+    opacity = feature_mix_vec2(a_opacity_feature, a_opacity_t);
+#else
     opacity = unpack_mix_vec2(a_opacity, a_opacity_t);
+#endif
 #else
     lowp float opacity = u_opacity;
 #endif
@@ -24,7 +24,11 @@ varying vec2 v_pos_b;
 
 #ifndef HAS_UNIFORM_u_opacity
 uniform lowp float a_opacity_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_opacity_feature;
+#else
 attribute lowp vec2 a_opacity;
+#endif
 varying lowp float opacity;
 #else
 uniform lowp float u_opacity;
@@ -33,7 +37,11 @@ uniform lowp float u_opacity;
 void main() {
 
 #ifndef HAS_UNIFORM_u_opacity
+#ifdef HAS_FEATURE_TEXTURE
+    opacity = feature_mix_vec2(a_opacity_feature, a_opacity_t);
+#else
     opacity = unpack_mix_vec2(a_opacity, a_opacity_t);
+#endif
 #else
     lowp float opacity = u_opacity;
 #endif
@@ -35,7 +35,11 @@ varying float v_gamma_scale;
 
 #ifndef HAS_UNIFORM_u_color
 uniform lowp float a_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_color_feature;
+#else
 attribute highp vec4 a_color;
+#endif
 varying highp vec4 color;
 #else
 uniform highp vec4 u_color;
@@ -43,7 +47,11 @@ uniform highp vec4 u_color;
 
 #ifndef HAS_UNIFORM_u_blur
 uniform lowp float a_blur_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_blur_feature;
+#else
 attribute lowp vec2 a_blur;
+#endif
 varying lowp float blur;
 #else
 uniform lowp float u_blur;
@@ -51,7 +59,11 @@ uniform lowp float u_blur;
 
 #ifndef HAS_UNIFORM_u_opacity
 uniform lowp float a_opacity_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_opacity_feature;
+#else
 attribute lowp vec2 a_opacity;
+#endif
 varying lowp float opacity;
 #else
 uniform lowp float u_opacity;
@@ -59,21 +71,33 @@ uniform lowp float u_opacity;
 
 #ifndef HAS_UNIFORM_u_gapwidth
 uniform lowp float a_gapwidth_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_gapwidth_feature;
+#else
 attribute mediump vec2 a_gapwidth;
+#endif
 #else
 uniform mediump float u_gapwidth;
 #endif
 
 #ifndef HAS_UNIFORM_u_offset
 uniform lowp float a_offset_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_offset_feature;
+#else
 attribute lowp vec2 a_offset;
+#endif
 #else
 uniform lowp float u_offset;
 #endif
 
 #ifndef HAS_UNIFORM_u_width
 uniform lowp float a_width_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_width_feature;
+#else
 attribute mediump vec2 a_width;
+#endif
 #else
 uniform mediump float u_width;
 #endif
@@ -81,37 +105,61 @@ uniform mediump float u_width;
 void main() {
 
 #ifndef HAS_UNIFORM_u_color
+#ifdef HAS_FEATURE_TEXTURE
+    color = feature_mix_vec4(a_color_feature, a_color_t);
+#else
     color = unpack_mix_vec4(a_color, a_color_t);
+#endif
 #else
     highp vec4 color = u_color;
 #endif
 
 #ifndef HAS_UNIFORM_u_blur
+#ifdef HAS_FEATURE_TEXTURE
+    blur = feature_mix_vec2(a_blur_feature, a_blur_t);
+#else
     blur = unpack_mix_vec2(a_blur, a_blur_t);
+#endif
 #else
     lowp float blur = u_blur;
 #endif
 
 #ifndef HAS_UNIFORM_u_opacity
+#ifdef HAS_FEATURE_TEXTURE
+    opacity = feature_mix_vec2(a_opacity_feature, a_opacity_t);
+#else
     opacity = unpack_mix_vec2(a_opacity, a_opacity_t);
+#endif
 #else
     lowp float opacity = u_opacity;
 #endif
 
 #ifndef HAS_UNIFORM_u_gapwidth
+#ifdef HAS_FEATURE_TEXTURE
+    mediump float gapwidth = feature_mix_vec2(a_gapwidth_feature, a_gapwidth_t);
+#else
     mediump float gapwidth = unpack_mix_vec2(a_gapwidth, a_gapwidth_t);
+#endif
 #else
     mediump float gapwidth = u_gapwidth;
 #endif
 
 #ifndef HAS_UNIFORM_u_offset
+#ifdef HAS_FEATURE_TEXTURE
+    lowp float offset = feature_mix_vec2(a_offset_feature, a_offset_t);
+#else
     lowp float offset = unpack_mix_vec2(a_offset, a_offset_t);
+#endif
 #else
     lowp float offset = u_offset;
 #endif
 
 #ifndef HAS_UNIFORM_u_width
+#ifdef HAS_FEATURE_TEXTURE
+    mediump float width = feature_mix_vec2(a_width_feature, a_width_t);
+#else
     mediump float width = unpack_mix_vec2(a_width, a_width_t);
+#endif
 #else
     mediump float width = u_width;
 #endif
@@ -95,6 +95,34 @@ vec2 get_pattern_pos(const vec2 pixel_coord_upper, const vec2 pixel_coord_lower,
     return (tile_units_to_pixels * pos + offset) / pattern_size;
 }
 
+#ifdef HAS_FEATURE_TEXTURE
+uniform sampler2D u_feature_texture;
+uniform highp vec2 u_feature_texture_size;
+attribute highp vec2 a_feature;
+
+// The texel of the feature in the block that starts at the given row.
+highp vec4 feature_texel(const highp float row) {
+    return texture2D(u_feature_texture, (a_feature + vec2(0.5, row + 0.5)) / u_feature_texture_size);
+}
+
+// Read a pair of colors from the blocks at feature[0] and feature[1] and interpolate between them.
+vec4 feature_mix_vec4(const highp vec4 feature, const float t) {
+    return mix(feature_texel(feature[0]), feature_texel(feature[1]), t);
+}
+
+// Values other than colors are stored as 24 bit fixed point numbers between feature[2] and
+// feature[2] + feature[3].
+highp float feature_float(const highp float row, const highp vec4 feature) {
+    highp vec3 bytes = floor(feature_texel(row).rgb * 255.0 + 0.5);
+    return feature[2] + feature[3] * dot(bytes, vec3(65536.0, 256.0, 1.0)) / 16777215.0;
+}
+
+// Read a pair of values from the blocks at feature[0] and feature[1] and interpolate between them.
+float feature_mix_vec2(const highp vec4 feature, const float t) {
+    return mix(feature_float(feature[0], feature), feature_float(feature[1], feature), t);
+}
+#endif
+
 )MBGL_SHADER";
 const char* fragmentPrelude = R"MBGL_SHADER(
 #ifdef GL_ES
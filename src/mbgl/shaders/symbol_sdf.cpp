@@ -30,7 +30,11 @@ uniform mediump float u_layout_size; // used when size is feature constant
 
 #ifndef HAS_UNIFORM_u_fill_color
 uniform lowp float a_fill_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_fill_color_feature;
+#else
 attribute highp vec4 a_fill_color;
+#endif
 varying highp vec4 fill_color;
 #else
 uniform highp vec4 u_fill_color;
@@ -38,7 +42,11 @@ uniform highp vec4 u_fill_color;
 
 #ifndef HAS_UNIFORM_u_halo_color
 uniform lowp float a_halo_color_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_halo_color_feature;
+#else
 attribute highp vec4 a_halo_color;
+#endif
 varying highp vec4 halo_color;
 #else
 uniform highp vec4 u_halo_color;
@@ -46,7 +54,11 @@ uniform highp vec4 u_halo_color;
 
 #ifndef HAS_UNIFORM_u_opacity
 uniform lowp float a_opacity_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_opacity_feature;
+#else
 attribute lowp vec2 a_opacity;
+#endif
 varying lowp float opacity;
 #else
 uniform lowp float u_opacity;
@@ -54,7 +66,11 @@ uniform lowp float u_opacity;
 
 #ifndef HAS_UNIFORM_u_halo_width
 uniform lowp float a_halo_width_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_halo_width_feature;
+#else
 attribute lowp vec2 a_halo_width;
+#endif
 varying lowp float halo_width;
 #else
 uniform lowp float u_halo_width;
@@ -62,7 +78,11 @@ uniform lowp float u_halo_width;
 
 #ifndef HAS_UNIFORM_u_halo_blur
 uniform lowp float a_halo_blur_t;
+#ifdef HAS_FEATURE_TEXTURE
+uniform highp vec4 a_halo_blur_feature;
+#else
 attribute lowp vec2 a_halo_blur;
+#endif
 varying lowp float halo_blur;
 #else
 uniform lowp float u_halo_blur;
@@ -88,31 +108,51 @@ varying vec2 v_data1;
 void main() {
 
 #ifndef HAS_UNIFORM_u_fill_color
+#ifdef HAS_FEATURE_TEXTURE
+    fill_color = feature_mix_vec4(a_fill_color_feature, a_fill_color_t);
+#else
     fill_color = unpack_mix_vec4(a_fill_color, a_fill_color_t);
+#endif
 #else
     highp vec4 fill_color = u_fill_color;
 #endif
 
 #ifndef HAS_UNIFORM_u_halo_color
+#ifdef HAS_FEATURE_TEXTURE
+    halo_color = feature_mix_vec4(a_halo_color_feature, a_halo_color_t);
+#else
     halo_color = unpack_mix_vec4(a_halo_color, a_halo_color_t);
+#endif
 #else
     highp vec4 halo_color = u_halo_color;
 #endif
 
 #ifndef HAS_UNIFORM_u_opacity
+#ifdef HAS_FEATURE_TEXTURE
+    opacity = feature_mix_vec2(a_opacity_feature, a_opacity_t);
+#else
     opacity = unpack_mix_vec2(a_opacity, a_opacity_t);
+#endif
 #else
     lowp float opacity = u_opacity;
 #endif
 
 #ifndef HAS_UNIFORM_u_halo_width
+#ifdef HAS_FEATURE_TEXTURE
+    halo_width = feature_mix_vec2(a_halo_width_feature, a_halo_width_t);
+#else
     halo_width = unpack_mix_vec2(a_halo_width, a_halo_width_t);
+#endif
 #else
     lowp float halo_width = u_halo_width;
 #endif
 
 #ifndef HAS_UNIFORM_u_halo_blur
+#ifdef HAS_FEATURE_TEXTURE
+    halo_blur = feature_mix_vec2(a_halo_blur_feature, a_halo_blur_t);
+#else
     halo_blur = unpack_mix_vec2(a_halo_blur, a_halo_blur_t);
+#endif
 #else
     lowp float halo_blur = u_halo_blur;
 #endif
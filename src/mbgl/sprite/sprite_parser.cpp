@@ -1,5 +1,6 @@
 #include <mbgl/sprite/sprite_parser.hpp>
 #include <mbgl/style/image.hpp>
+#include <mbgl/style/image_impl.hpp>
 
 #include <mbgl/util/logging.hpp>
 
@@ -14,13 +15,15 @@
 namespace mbgl {
 
 std::unique_ptr<style::Image> createStyleImage(const std::string& id,
-                                               const PremultipliedImage& image,
+                                               const std::shared_ptr<const PremultipliedImage>& sheet,
                                                const uint32_t srcX,
                                                const uint32_t srcY,
                                                const uint32_t width,
                                                const uint32_t height,
                                                const double ratio,
                                                const bool sdf) {
+    const PremultipliedImage& image = *sheet;
+
     // Disallow invalid parameter configurations.
     if (width <= 0 || height <= 0 || width > 1024 || height > 1024 ||
         ratio <= 0 || ratio > 10 ||
@@ -33,12 +36,9 @@ std::unique_ptr<style::Image> createStyleImage(const std::string& id,
         return nullptr;
     }
 
-    PremultipliedImage dstImage({ width, height });
-
-    // Copy from the source image into our individual sprite image
-    PremultipliedImage::copy(image, dstImage, { srcX, srcY }, { 0, 0 }, { width, height });
-
-    return std::make_unique<style::Image>(id, std::move(dstImage), ratio, sdf);
+    // The pixels are copied out of the sheet only when the image is used.
+    return std::make_unique<style::Image>(makeMutable<style::Image::Impl>(
+        id, sheet, Point<uint32_t> { srcX, srcY }, Size { width, height }, ratio, sdf));
 }
 
 namespace {
@@ -86,7 +86,7 @@ bool getBoolean(const JSValue& value, const char* name, const bool def = false)
 } // namespace
 
 std::vector<std::unique_ptr<style::Image>> parseSprite(const std::string& encodedImage, const std::string& json) {
-    const PremultipliedImage raster = decodeImage(encodedImage);
+    const auto raster = std::make_shared<const PremultipliedImage>(decodeImage(encodedImage));
 
     JSDocument doc;
     doc.Parse<0>(json.c_str());
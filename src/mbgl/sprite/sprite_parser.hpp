@@ -12,9 +12,10 @@ namespace style {
 class Image;
 } // namespace style
 
-// Extracts an individual image from a spritesheet from the given location.
+// Creates an image of the region of a spritesheet at the given location. The image shares the
+// pixels of the sheet.
 std::unique_ptr<style::Image> createStyleImage(const std::string& id,
-                                               const PremultipliedImage&,
+                                               const std::shared_ptr<const PremultipliedImage>&,
                                                uint32_t srcX,
                                                uint32_t srcY,
                                                uint32_t srcWidth,
@@ -22,7 +23,8 @@ std::unique_ptr<style::Image> createStyleImage(const std::string& id,
                                                double ratio,
                                                bool sdf);
 
-// Parses an image and an associated JSON file and returns the sprite objects.
+// Parses an image and an associated JSON file and returns the sprite objects. The image is
+// decoded once, and the sprite objects are views of it.
 std::vector<std::unique_ptr<style::Image>> parseSprite(const std::string& image, const std::string& json);
 
 } // namespace mbgl
@@ -5,12 +5,236 @@
 #include <mapbox/geojson.hpp>
 #include <mapbox/geojson/rapidjson.hpp>
 
+#include <cstring>
+#include <sstream>
+#include <utility>
+#include <vector>
+
 namespace mbgl {
 namespace style {
 namespace conversion {
 
+namespace {
+
+// Scans JSON text without building a DOM. This is used to locate the features of a top-level
+// FeatureCollection, so that they can be parsed and converted one at a time instead of
+// materializing the DOM of the entire document at once.
+class FeatureCollectionScanner {
+public:
+    using Span = std::pair<std::size_t, std::size_t>;
+
+    FeatureCollectionScanner(const std::string& json_) : json(json_) {}
+
+    // Returns true if the text is an object with a "type" of "FeatureCollection" and a
+    // "features" array. Any other input, including malformed JSON, is left to the DOM parser.
+    bool scan() {
+        skipWhitespace();
+        if (!consume('{')) {
+            return false;
+        }
+
+        bool isFeatureCollection = false;
+        bool hasFeatures = false;
+
+        skipWhitespace();
+        if (consume('}')) {
+            return false;
+        }
+
+        do {
+            skipWhitespace();
+            Span key;
+            if (!scanString(key)) {
+                return false;
+            }
+
+            skipWhitespace();
+            if (!consume(':')) {
+                return false;
+            }
+            skipWhitespace();
+
+            if (equals(key, "type")) {
+                Span type;
+                if (!scanString(type)) {
+                    return false;
+                }
+                isFeatureCollection = equals(type, "FeatureCollection");
+            } else if (equals(key, "features")) {
+                if (hasFeatures || !scanFeatures()) {
+                    return false;
+                }
+                hasFeatures = true;
+            } else {
+                const std::size_t start = pos;
+                if (!skipValue() || !isValid({ start, pos })) {
+                    return false;
+                }
+            }
+
+            skipWhitespace();
+        } while (consume(','));
+
+        if (!consume('}')) {
+            return false;
+        }
+
+        skipWhitespace();
+        return pos == json.size() && isFeatureCollection && hasFeatures;
+    }
+
+    std::vector<Span> features;
+
+private:
+    bool atEnd() const {
+        return pos >= json.size();
+    }
+
+    void skipWhitespace() {
+        while (!atEnd() && (json[pos] == ' ' || json[pos] == '\t' || json[pos] == '\n' || json[pos] == '\r')) {
+            pos++;
+        }
+    }
+
+    bool consume(char c) {
+        if (!atEnd() && json[pos] == c) {
+            pos++;
+            return true;
+        }
+        return false;
+    }
+
+    bool equals(const Span& span, const char* literal) const {
+        const std::size_t length = std::strlen(literal);
+        return span.second - span.first == length && json.compare(span.first, length, literal) == 0;
+    }
+
+    // Other members of the collection are small, so we validate them with the DOM parser.
+    bool isValid(const Span& span) const {
+        JSDocument document;
+        document.Parse<0>(json.data() + span.first, span.second - span.first);
+        return !document.HasParseError();
+    }
+
+    // Stores the raw contents between the quotes; escape sequences are skipped, not decoded.
+    bool scanString(Span& span) {
+        if (!consume('"')) {
+            return false;
+        }
+        span.first = pos;
+        while (!atEnd()) {
+            const char c = json[pos++];
+            if (c == '\\') {
+                pos++;
+            } else if (c == '"') {
+                span.second = pos - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool skipValue() {
+        if (atEnd()) {
+            return false;
+        }
+
+        if (json[pos] == '"') {
+            Span ignored;
+            return scanString(ignored);
+        }
+
+        if (json[pos] == '{' || json[pos] == '[') {
+            std::size_t depth = 0;
+            while (!atEnd()) {
+                const char c = json[pos];
+                if (c == '"') {
+                    Span ignored;
+                    if (!scanString(ignored)) {
+                        return false;
+                    }
+                    continue;
+                }
+                pos++;
+                if (c == '{' || c == '[') {
+                    depth++;
+                } else if (c == '}' || c == ']') {
+                    if (--depth == 0) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Numbers and literals; their validity is checked when the value is parsed.
+        const std::size_t start = pos;
+        while (!atEnd() && std::strchr(",}] \t\n\r", json[pos]) == nullptr) {
+            pos++;
+        }
+        return pos > start;
+    }
+
+    bool scanFeatures() {
+        if (!consume('[')) {
+            return false;
+        }
+
+        skipWhitespace();
+        if (consume(']')) {
+            return true;
+        }
+
+        do {
+            skipWhitespace();
+            const std::size_t start = pos;
+            if (!skipValue()) {
+                return false;
+            }
+            features.emplace_back(start, pos);
+            skipWhitespace();
+        } while (consume(','));
+
+        return consume(']');
+    }
+
+    const std::string& json;
+    std::size_t pos = 0;
+};
+
+} // namespace
+
 optional<GeoJSON> Converter<GeoJSON>::operator()(const std::string& value, Error& error) const {
-    return convertJSON<GeoJSON>(value, error);
+    FeatureCollectionScanner scanner(value);
+    if (!scanner.scan()) {
+        return convertJSON<GeoJSON>(value, error);
+    }
+
+    // Parse and convert one feature at a time, so that the peak memory usage is the
+    // converted collection plus the DOM of a single feature.
+    mapbox::geojson::feature_collection result;
+    result.reserve(scanner.features.size());
+
+    for (const auto& span : scanner.features) {
+        JSDocument document;
+        document.Parse<0>(value.data() + span.first, span.second - span.first);
+
+        if (document.HasParseError()) {
+            std::stringstream message;
+            message << span.first + document.GetErrorOffset() << " - " << rapidjson::GetParseError_En(document.GetParseError());
+            error = { message.str() };
+            return {};
+        }
+
+        try {
+            result.push_back(mapbox::geojson::convert<mapbox::geojson::feature>(document));
+        } catch (const std::exception& ex) {
+            error = { ex.what() };
+            return {};
+        }
+    }
+
+    return GeoJSON { std::move(result) };
 }
 
 template <>
@@ -2,6 +2,8 @@
 #include <mbgl/style/types.hpp>
 #include <mbgl/util/color.hpp>
 
+#include <boost/functional/hash.hpp>
+
 #include <array>
 
 namespace mbgl {
@@ -18,14 +20,20 @@ optional<CategoricalValue> categoricalValue(const Value& value) {
     );
 }
 
+std::size_t CategoricalValueHash::operator()(const CategoricalValue& value) const {
+    std::size_t seed = value.which();
+    value.match([&] (const auto& v) { boost::hash_combine(seed, v); });
+    return seed;
+}
+
 template <class T>
 optional<T> CategoricalStops<T>::evaluate(const Value& value) const {
     auto v = categoricalValue(value);
     if (!v) {
         return {};
     }
-    auto it = stops.find(*v);
-    return it == stops.end() ? optional<T>() : it->second;
+    auto it = index.find(*v);
+    return it == index.end() ? optional<T>() : it->second;
 }
 
 template class CategoricalStops<float>;
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <mbgl/util/feature.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/variant.hpp>
+
+#include <boost/functional/hash.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+namespace style {
+
+// Remembers the results of evaluating a data-driven function by the value of its property. The
+// features of a tile usually have only a handful of distinct values, so most features skip the stop
+// search. Arrays and objects aren't cached. A cache is meant to be used for the features of a
+// single tile and isn't thread safe.
+template <class R>
+class EvaluationCache {
+public:
+    // The maximum number of distinct values that are cached, for properties that have a different
+    // value for every feature.
+    static constexpr std::size_t maxSize = 256;
+
+    template <class Evaluate>
+    R get(const optional<Value>& value, Evaluate&& evaluate) {
+        if (!value) {
+            if (!missing) {
+                missing = evaluate();
+            }
+            return *missing;
+        }
+
+        optional<Key> key = toKey(*value);
+        if (!key) {
+            return evaluate();
+        }
+
+        auto it = results.find(*key);
+        if (it != results.end()) {
+            return it->second;
+        }
+
+        R result = evaluate();
+        if (results.size() < maxSize) {
+            results.emplace(std::move(*key), result);
+        }
+        return result;
+    }
+
+    std::size_t size() const {
+        return results.size() + (missing ? 1 : 0);
+    }
+
+private:
+    using Key = variant<NullValue, bool, uint64_t, int64_t, double, std::string>;
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const {
+            std::size_t seed = key.which();
+            key.match(
+                [&] (const NullValue&) {},
+                [&] (const auto& v) { boost::hash_combine(seed, v); });
+            return seed;
+        }
+    };
+
+    static optional<Key> toKey(const Value& value) {
+        return value.match(
+            [] (const NullValue& v) { return optional<Key>(v); },
+            [] (bool v) { return optional<Key>(v); },
+            [] (uint64_t v) { return optional<Key>(v); },
+            [] (int64_t v) { return optional<Key>(v); },
+            [] (double v) { return optional<Key>(v); },
+            [] (const std::string& v) { return optional<Key>(v); },
+            [] (const auto&) { return optional<Key>(); });
+    }
+
+    std::unordered_map<Key, R, KeyHash> results;
+    optional<R> missing;
+};
+
+template <class R>
+constexpr std::size_t EvaluationCache<R>::maxSize;
+
+} // namespace style
+} // namespace mbgl
@@ -12,6 +12,10 @@ Image::Image(std::string id,
     : baseImpl(makeMutable<Impl>(std::move(id), std::move(image), pixelRatio, sdf)) {
 }
 
+Image::Image(Immutable<Impl> impl)
+    : baseImpl(std::move(impl)) {
+}
+
 std::string Image::getID() const {
     return baseImpl->id;
 }
@@ -19,7 +23,7 @@ std::string Image::getID() const {
 Image::Image(const Image&) = default;
 
 const PremultipliedImage& Image::getImage() const {
-    return baseImpl->image;
+    return baseImpl->image();
 }
 
 bool Image::isSdf() const {
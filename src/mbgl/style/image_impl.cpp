@@ -4,20 +4,59 @@
 namespace mbgl {
 namespace style {
 
+static void validate(const Size& size, const float pixelRatio) {
+    if (size.isEmpty()) {
+        throw util::SpriteImageException("Sprite image dimensions may not be zero");
+    } else if (pixelRatio <= 0) {
+        throw util::SpriteImageException("Sprite pixelRatio may not be <= 0");
+    }
+}
+
 Image::Impl::Impl(std::string id_,
                   PremultipliedImage&& image_,
                   const float pixelRatio_,
                   bool sdf_)
         : id(std::move(id_)),
-          image(std::move(image_)),
+          size(image_.valid() ? image_.size : Size()),
           pixelRatio(pixelRatio_),
-          sdf(sdf_) {
+          sdf(sdf_),
+          sheet(std::make_shared<const PremultipliedImage>(std::move(image_))),
+          origin(0, 0) {
+    validate(size, pixelRatio);
+}
 
-    if (!image.valid()) {
-        throw util::SpriteImageException("Sprite image dimensions may not be zero");
-    } else if (pixelRatio <= 0) {
-        throw util::SpriteImageException("Sprite pixelRatio may not be <= 0");
+Image::Impl::Impl(std::string id_,
+                  std::shared_ptr<const PremultipliedImage> sheet_,
+                  const Point<uint32_t>& origin_,
+                  const Size& size_,
+                  const float pixelRatio_,
+                  bool sdf_)
+        : id(std::move(id_)),
+          size(size_),
+          pixelRatio(pixelRatio_),
+          sdf(sdf_),
+          sheet(std::move(sheet_)),
+          origin(origin_) {
+    validate(size, pixelRatio);
+}
+
+void Image::Impl::copy(const Point<uint32_t>& srcPt,
+                       PremultipliedImage& dst,
+                       const Point<uint32_t>& dstPt,
+                       const Size& copySize) const {
+    PremultipliedImage::copy(*sheet, dst, { origin.x + srcPt.x, origin.y + srcPt.y }, dstPt, copySize);
+}
+
+const PremultipliedImage& Image::Impl::image() const {
+    if (origin == Point<uint32_t> { 0, 0 } && size == sheet->size) {
+        return *sheet;
     }
+
+    std::call_once(sliced, [&] {
+        slice = PremultipliedImage(size);
+        copy({ 0, 0 }, slice, { 0, 0 }, size);
+    });
+    return slice;
 }
 
 } // namespace style
@@ -5,6 +5,8 @@
 #include <string>
 #include <unordered_map>
 #include <set>
+#include <memory>
+#include <mutex>
 
 namespace mbgl {
 namespace style {
@@ -13,15 +15,39 @@ class Image::Impl {
 public:
     Impl(std::string id, PremultipliedImage&&, float pixelRatio, bool sdf = false);
 
+    // An image that is a region of a sprite sheet. The sheet is shared by all images of the
+    // sprite, and the pixels of the image stay in it until they are copied elsewhere.
+    Impl(std::string id,
+         std::shared_ptr<const PremultipliedImage> sheet,
+         const Point<uint32_t>& origin,
+         const Size&,
+         float pixelRatio,
+         bool sdf = false);
+
     const std::string id;
 
-    PremultipliedImage image;
+    // Size of the image in pixels.
+    const Size size;
 
     // Pixel ratio of the sprite image.
     const float pixelRatio;
 
     // Whether this image should be interpreted as a signed distance field icon.
     const bool sdf;
+
+    // Copies a region of the image into another image, without materializing it.
+    void copy(const Point<uint32_t>& srcPt, PremultipliedImage& dst, const Point<uint32_t>& dstPt, const Size&) const;
+
+    // The pixels of the image. Images of a sprite copy them out of the sheet when they are
+    // first read.
+    const PremultipliedImage& image() const;
+
+private:
+    const std::shared_ptr<const PremultipliedImage> sheet;
+    const Point<uint32_t> origin;
+
+    mutable std::once_flag sliced;
+    mutable PremultipliedImage slice;
 };
 
 } // namespace style
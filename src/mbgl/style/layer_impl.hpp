@@ -35,9 +35,15 @@ public:
     Impl& operator=(const Impl&) = delete;
 
     // Returns true buckets if properties affecting layout have changed: i.e. filter,
-    // visibility, layout properties, or data-driven paint properties.
+    // visibility, layout properties, or, for symbol layers, data-driven paint properties.
     virtual bool hasLayoutDifference(const Layer::Impl&) const = 0;
 
+    // Returns true if data-driven paint properties have changed, which only requires the paint
+    // property binders of the buckets to be populated again.
+    virtual bool hasDataDrivenPaintDifference(const Layer::Impl&) const {
+        return false;
+    }
+
     // Utility function for automatic layer grouping.
     virtual void stringifyLayout(rapidjson::Writer<rapidjson::StringBuffer>&) const = 0;
 
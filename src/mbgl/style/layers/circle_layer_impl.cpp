@@ -7,8 +7,13 @@ bool CircleLayer::Impl::hasLayoutDifference(const Layer::Impl& other) const {
     assert(dynamic_cast<const CircleLayer::Impl*>(&other));
     const auto& impl = static_cast<const style::CircleLayer::Impl&>(other);
     return filter     != impl.filter ||
-           visibility != impl.visibility ||
-           paint.hasDataDrivenPropertyDifference(impl.paint);
+           visibility != impl.visibility;
+}
+
+bool CircleLayer::Impl::hasDataDrivenPaintDifference(const Layer::Impl& other) const {
+    assert(dynamic_cast<const CircleLayer::Impl*>(&other));
+    const auto& impl = static_cast<const style::CircleLayer::Impl&>(other);
+    return paint.hasDataDrivenPropertyDifference(impl.paint);
 }
 
 } // namespace style
@@ -7,8 +7,13 @@ bool FillExtrusionLayer::Impl::hasLayoutDifference(const Layer::Impl& other) con
     assert(dynamic_cast<const FillExtrusionLayer::Impl*>(&other));
     const auto& impl = static_cast<const style::FillExtrusionLayer::Impl&>(other);
     return filter     != impl.filter ||
-           visibility != impl.visibility ||
-           paint.hasDataDrivenPropertyDifference(impl.paint);
+           visibility != impl.visibility;
+}
+
+bool FillExtrusionLayer::Impl::hasDataDrivenPaintDifference(const Layer::Impl& other) const {
+    assert(dynamic_cast<const FillExtrusionLayer::Impl*>(&other));
+    const auto& impl = static_cast<const style::FillExtrusionLayer::Impl&>(other);
+    return paint.hasDataDrivenPropertyDifference(impl.paint);
 }
 
 } // namespace style
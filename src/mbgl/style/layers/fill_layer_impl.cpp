@@ -7,8 +7,13 @@ bool FillLayer::Impl::hasLayoutDifference(const Layer::Impl& other) const {
     assert(dynamic_cast<const FillLayer::Impl*>(&other));
     const auto& impl = static_cast<const style::FillLayer::Impl&>(other);
     return filter     != impl.filter ||
-           visibility != impl.visibility ||
-           paint.hasDataDrivenPropertyDifference(impl.paint);
+           visibility != impl.visibility;
+}
+
+bool FillLayer::Impl::hasDataDrivenPaintDifference(const Layer::Impl& other) const {
+    assert(dynamic_cast<const FillLayer::Impl*>(&other));
+    const auto& impl = static_cast<const style::FillLayer::Impl&>(other);
+    return paint.hasDataDrivenPropertyDifference(impl.paint);
 }
 
 } // namespace style
@@ -12,6 +12,7 @@ public:
     using Layer::Impl::Impl;
 
     bool hasLayoutDifference(const Layer::Impl&) const override;
+    bool hasDataDrivenPaintDifference(const Layer::Impl&) const override;
     void stringifyLayout(rapidjson::Writer<rapidjson::StringBuffer>&) const override;
 
     FillPaintProperties::Transitionable paint;
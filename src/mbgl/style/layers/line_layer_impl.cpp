@@ -8,8 +8,13 @@ bool LineLayer::Impl::hasLayoutDifference(const Layer::Impl& other) const {
     const auto& impl = static_cast<const style::LineLayer::Impl&>(other);
     return filter     != impl.filter ||
            visibility != impl.visibility ||
-           layout     != impl.layout ||
-           paint.hasDataDrivenPropertyDifference(impl.paint);
+           layout     != impl.layout;
+}
+
+bool LineLayer::Impl::hasDataDrivenPaintDifference(const Layer::Impl& other) const {
+    assert(dynamic_cast<const LineLayer::Impl*>(&other));
+    const auto& impl = static_cast<const style::LineLayer::Impl&>(other);
+    return paint.hasDataDrivenPropertyDifference(impl.paint);
 }
 
 } // namespace style
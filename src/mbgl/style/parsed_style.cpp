@@ -0,0 +1,230 @@
+#include <mbgl/style/parsed_style.hpp>
+#include <mbgl/style/layer_impl.hpp>
+#include <mbgl/style/rapidjson_conversion.hpp>
+#include <mbgl/style/conversion.hpp>
+#include <mbgl/style/conversion/source.hpp>
+#include <mbgl/style/sources/vector_source.hpp>
+#include <mbgl/style/sources/raster_source.hpp>
+#include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/style/sources/image_source.hpp>
+#include <mbgl/style/layers/background_layer.hpp>
+#include <mbgl/style/layers/background_layer_impl.hpp>
+#include <mbgl/style/layers/circle_layer.hpp>
+#include <mbgl/style/layers/circle_layer_impl.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/fill_layer_impl.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/style/layers/line_layer_impl.hpp>
+#include <mbgl/style/layers/raster_layer.hpp>
+#include <mbgl/style/layers/raster_layer_impl.hpp>
+#include <mbgl/style/layers/symbol_layer.hpp>
+#include <mbgl/style/layers/symbol_layer_impl.hpp>
+
+#include <cassert>
+#include <functional>
+#include <list>
+#include <mutex>
+
+namespace mbgl {
+namespace style {
+
+namespace {
+
+SourceDescription describe(const Source& source) {
+    SourceDescription description { source.getID(), source.getType(), {}, util::tileSize, {} };
+
+    switch (source.getType()) {
+    case SourceType::Vector:
+        description.urlOrTileset = source.as<VectorSource>()->getURLOrTileset();
+        break;
+    case SourceType::Raster:
+        description.urlOrTileset = source.as<RasterSource>()->getURLOrTileset();
+        description.tileSize = source.as<RasterSource>()->getTileSize();
+        break;
+    case SourceType::GeoJSON:
+        description.url = source.as<GeoJSONSource>()->getURL();
+        break;
+    case SourceType::Image:
+        description.url = source.as<ImageSource>()->getURL();
+        break;
+    case SourceType::Video:
+    case SourceType::Annotations:
+        break;
+    }
+
+    return description;
+}
+
+// The most recently parsed styles, keyed by the hash of their JSON. The same style is usually
+// parsed several times: by every map that loads it, whenever it is loaded again, and whenever
+// the status of an offline region that uses it is checked.
+class ParsedStyleCache {
+public:
+    std::shared_ptr<const ParsedStyle> get(std::size_t hash, const std::string& json) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->hash == hash && it->json == json) {
+                entries.splice(entries.begin(), entries, it);
+                return it->style;
+            }
+        }
+        return nullptr;
+    }
+
+    void add(std::size_t hash, const std::string& json, std::shared_ptr<const ParsedStyle> style) {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.push_front({ hash, json, std::move(style) });
+        if (entries.size() > maxSize) {
+            entries.pop_back();
+        }
+    }
+
+private:
+    struct Entry {
+        std::size_t hash;
+        std::string json;
+        std::shared_ptr<const ParsedStyle> style;
+    };
+
+    static constexpr std::size_t maxSize = 4;
+
+    std::mutex mutex;
+    std::list<Entry> entries;
+};
+
+} // namespace
+
+std::shared_ptr<const ParsedStyle> ParsedStyle::parse(const std::string& json) {
+    return parse(json, nullptr);
+}
+
+std::shared_ptr<const ParsedStyle> ParsedStyle::parse(const std::string& json,
+                                                      std::vector<std::unique_ptr<Source>>& sources) {
+    return parse(json, &sources);
+}
+
+std::shared_ptr<const ParsedStyle> ParsedStyle::parse(const std::string& json,
+                                                      std::vector<std::unique_ptr<Source>>* sources) {
+    static ParsedStyleCache cache;
+
+    const std::size_t hash = std::hash<std::string>()(json);
+    if (auto cached = cache.get(hash, json)) {
+        if (sources) {
+            *sources = cached->createSources();
+        }
+        return cached;
+    }
+
+    std::shared_ptr<ParsedStyle> style(new ParsedStyle());
+
+    Parser parser;
+    style->error = parser.parse(json);
+
+    if (!style->error) {
+        style->spriteURL = std::move(parser.spriteURL);
+        style->glyphURL = std::move(parser.glyphURL);
+        style->light = std::move(parser.light);
+        style->name = std::move(parser.name);
+        style->latLng = parser.latLng;
+        style->zoom = parser.zoom;
+        style->bearing = parser.bearing;
+        style->pitch = parser.pitch;
+        style->fontStacks = parser.fontStacks();
+
+        if (parser.sourcesValue) {
+            style->sources.CopyFrom(*parser.sourcesValue, style->sources.GetAllocator());
+        }
+
+        style->sourceDescriptions.reserve(parser.sources.size());
+        for (const auto& source : parser.sources) {
+            style->sourceDescriptions.push_back(describe(*source));
+        }
+        if (sources) {
+            *sources = std::move(parser.sources);
+        }
+
+        style->layers.reserve(parser.layers.size());
+        for (const auto& layer : parser.layers) {
+            style->layers.push_back(layer->baseImpl);
+        }
+    }
+
+    cache.add(hash, json, style);
+    return style;
+}
+
+ParsedStyle::~ParsedStyle() = default;
+
+std::vector<std::unique_ptr<Source>> ParsedStyle::createSources() const {
+    std::vector<std::unique_ptr<Source>> result;
+    if (!sources.IsObject()) {
+        return result;
+    }
+
+    for (const auto& property : sources.GetObject()) {
+        std::string id = *conversion::toString(property.name);
+
+        // Sources that fail to convert were already reported when the style was parsed.
+        conversion::Error error;
+        optional<std::unique_ptr<Source>> source =
+            conversion::convert<std::unique_ptr<Source>>(property.value, error, id);
+        if (source) {
+            result.push_back(std::move(*source));
+        }
+    }
+
+    return result;
+}
+
+bool ParsedStyle::hasSource(const std::string& id) const {
+    return sources.IsObject() && sources.HasMember(id.c_str());
+}
+
+bool ParsedStyle::hasSameSource(const ParsedStyle& other, const std::string& id) const {
+    if (!hasSource(id) || !other.hasSource(id)) {
+        return false;
+    }
+    return sources[id.c_str()] == other.sources[id.c_str()];
+}
+
+std::vector<std::unique_ptr<Layer>> ParsedStyle::createLayers() const {
+    std::vector<std::unique_ptr<Layer>> result;
+    result.reserve(layers.size());
+
+    for (const auto& impl : layers) {
+        switch (impl->type) {
+        case LayerType::Fill:
+            result.push_back(std::make_unique<FillLayer>(staticImmutableCast<FillLayer::Impl>(impl)));
+            break;
+        case LayerType::Line:
+            result.push_back(std::make_unique<LineLayer>(staticImmutableCast<LineLayer::Impl>(impl)));
+            break;
+        case LayerType::Circle:
+            result.push_back(std::make_unique<CircleLayer>(staticImmutableCast<CircleLayer::Impl>(impl)));
+            break;
+        case LayerType::Symbol:
+            result.push_back(std::make_unique<SymbolLayer>(staticImmutableCast<SymbolLayer::Impl>(impl)));
+            break;
+        case LayerType::Raster:
+            result.push_back(std::make_unique<RasterLayer>(staticImmutableCast<RasterLayer::Impl>(impl)));
+            break;
+        case LayerType::Background:
+            result.push_back(std::make_unique<BackgroundLayer>(staticImmutableCast<BackgroundLayer::Impl>(impl)));
+            break;
+        case LayerType::FillExtrusion:
+            result.push_back(std::make_unique<FillExtrusionLayer>(staticImmutableCast<FillExtrusionLayer::Impl>(impl)));
+            break;
+        case LayerType::Custom:
+            // Custom layers can't be defined in JSON.
+            assert(false);
+            break;
+        }
+    }
+
+    return result;
+}
+
+} // namespace style
+} // namespace mbgl
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <mbgl/style/layer.hpp>
+#include <mbgl/style/source.hpp>
+#include <mbgl/style/light.hpp>
+#include <mbgl/style/parser.hpp>
+
+#include <mbgl/util/rapidjson.hpp>
+#include <mbgl/util/font_stack.hpp>
+#include <mbgl/util/geo.hpp>
+#include <mbgl/util/immutable.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/variant.hpp>
+#include <mbgl/util/tileset.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+namespace style {
+
+/*
+    ParsedStyle is the result of parsing a style document. It is immutable, so that it can be
+    parsed on a worker thread, and shared by every style that loads the same JSON.
+
+    Styles create their own layers and sources from it. Layers share the parsed layer
+    implementations, which are copied when they are changed. Sources hold the state of loading
+    their data, so they aren't part of the parsed style: the sources converted while parsing are
+    handed to the caller that parsed the style, and later styles convert them again from the
+    retained JSON of the sources.
+
+    Offline downloads only need to know where the data of each source comes from, which is
+    described once by the source descriptions.
+*/
+
+// Where the data of a source comes from.
+struct SourceDescription {
+    std::string id;
+    SourceType type;
+
+    // The TileJSON URL or the tileset of vector and raster sources.
+    optional<variant<std::string, Tileset>> urlOrTileset;
+    uint16_t tileSize = util::tileSize;
+
+    // The data URL of GeoJSON and image sources.
+    optional<std::string> url;
+};
+
+class ParsedStyle {
+public:
+    // Parses the style, or returns the result of parsing the same JSON before.
+    static std::shared_ptr<const ParsedStyle> parse(const std::string& json);
+
+    // Also creates the sources of the style, which are the ones converted while parsing unless
+    // the style was parsed before.
+    static std::shared_ptr<const ParsedStyle> parse(const std::string& json,
+                                                    std::vector<std::unique_ptr<Source>>& sources);
+
+    ~ParsedStyle();
+
+    std::vector<std::unique_ptr<Source>> createSources() const;
+    std::vector<std::unique_ptr<Layer>> createLayers() const;
+
+    bool hasSource(const std::string& id) const;
+
+    // Whether the source is defined the same way in both styles.
+    bool hasSameSource(const ParsedStyle&, const std::string& id) const;
+
+    // The error if the JSON isn't a valid style, in which case the style is empty.
+    StyleParseResult error;
+
+    std::string spriteURL;
+    std::string glyphURL;
+
+    Light light;
+
+    std::string name;
+    LatLng latLng;
+    double zoom = 0;
+    double bearing = 0;
+    double pitch = 0;
+
+    std::vector<FontStack> fontStacks;
+
+    std::vector<SourceDescription> sourceDescriptions;
+
+private:
+    ParsedStyle() = default;
+
+    static std::shared_ptr<const ParsedStyle> parse(const std::string& json,
+                                                    std::vector<std::unique_ptr<Source>>* sources);
+
+    JSDocument sources;
+
+    std::vector<Immutable<Layer::Impl>> layers;
+};
+
+} // namespace style
+} // namespace mbgl
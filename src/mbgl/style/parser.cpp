@@ -24,7 +24,6 @@ namespace style {
 Parser::~Parser() = default;
 
 StyleParseResult Parser::parse(const std::string& json) {
-    rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::CrtAllocator> document;
     document.Parse<0>(json.c_str());
 
     if (document.HasParseError()) {
@@ -95,7 +94,8 @@ StyleParseResult Parser::parse(const std::string& json) {
     }
 
     if (document.HasMember("sources")) {
-        parseSources(document["sources"]);
+        sourcesValue = &document["sources"];
+        parseSources(*sourcesValue);
     }
 
     if (document.HasMember("layers")) {
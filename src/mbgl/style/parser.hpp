@@ -44,7 +44,12 @@ public:
     // Statically evaluate layer properties to determine what font stacks are used.
     std::vector<FontStack> fontStacks() const;
 
+    // The JSON of the sources, if the style has any. Valid as long as the parser.
+    const JSValue* sourcesValue = nullptr;
+
 private:
+    JSDocument document;
+
     void parseTransition(const JSValue&);
     void parseLight(const JSValue&);
     void parseSources(const JSValue&);
@@ -0,0 +1,22 @@
+#include <mbgl/style/parser_worker.hpp>
+#include <mbgl/style/parsed_style.hpp>
+#include <mbgl/style/style_impl.hpp>
+
+namespace mbgl {
+namespace style {
+
+ParserWorker::ParserWorker(ActorRef<ParserWorker>, ActorRef<Style::Impl> parent_)
+    : parent(std::move(parent_)) {
+}
+
+void ParserWorker::parse(std::shared_ptr<const std::string> json, uint64_t correlationID) {
+    // Sources are created here as well, since converting them may be as expensive as
+    // parsing the layers.
+    std::vector<std::unique_ptr<Source>> sources;
+    std::shared_ptr<const ParsedStyle> style = ParsedStyle::parse(*json, sources);
+
+    parent.invoke(&Style::Impl::onParsed, std::move(json), std::move(style), std::move(sources), correlationID);
+}
+
+} // namespace style
+} // namespace mbgl
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <mbgl/actor/actor_ref.hpp>
+#include <mbgl/style/style.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace mbgl {
+namespace style {
+
+class ParserWorker {
+public:
+    ParserWorker(ActorRef<ParserWorker>, ActorRef<Style::Impl>);
+
+    void parse(std::shared_ptr<const std::string> json, uint64_t correlationID);
+
+private:
+    ActorRef<Style::Impl> parent;
+};
+
+} // namespace style
+} // namespace mbgl
@@ -1,7 +1,6 @@
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/style/source_observer.hpp>
-#include <mbgl/style/conversion/json.hpp>
 #include <mbgl/style/conversion/geojson.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/util/logging.hpp>
@@ -32,7 +31,27 @@ void GeoJSONSource::setURL(const std::string& url_) {
 
 void GeoJSONSource::setGeoJSON(const mapbox::geojson::geojson& geoJSON) {
     req.reset();
-    baseImpl = makeMutable<Impl>(impl(), geoJSON);
+    baseImpl = makeMutable<Impl>(impl(), [geoJSON_ = geoJSON] () mutable {
+        return std::move(geoJSON_);
+    });
+    observer->onSourceChanged(*this);
+}
+
+void GeoJSONSource::updateFeatures(const FeatureCollection& features) {
+    for (const auto& feature : features) {
+        if (!feature.id) {
+            throw std::runtime_error("updated features must have an identifier");
+        }
+    }
+
+    req.reset();
+    baseImpl = makeMutable<Impl>(impl(), features, std::vector<FeatureIdentifier>());
+    observer->onSourceChanged(*this);
+}
+
+void GeoJSONSource::removeFeatures(const std::vector<FeatureIdentifier>& ids) {
+    req.reset();
+    baseImpl = makeMutable<Impl>(impl(), FeatureCollection(), ids);
     observer->onSourceChanged(*this);
 }
 
@@ -60,17 +79,21 @@ void GeoJSONSource::loadDescription(FileSource& fileSource) {
             observer->onSourceError(
                 *this, std::make_exception_ptr(std::runtime_error("unexpectedly empty GeoJSON")));
         } else {
-            conversion::Error error;
-            optional<GeoJSON> geoJSON = conversion::convertJSON<GeoJSON>(*res.data, error);
-            if (!geoJSON) {
-                Log::Error(Event::ParseStyle, "Failed to parse GeoJSON data: %s",
-                           error.message.c_str());
-                // Create an empty GeoJSON VT object to make sure we're not infinitely waiting for
-                // tiles to load.
-                baseImpl = makeMutable<Impl>(impl(), GeoJSON{ FeatureCollection{} });
-            } else {
-                baseImpl = makeMutable<Impl>(impl(), *geoJSON);
-            }
+            // The data is parsed, and the tile index built from it, on the worker thread that
+            // requests the first tile rather than here on the main thread.
+            std::shared_ptr<const std::string> data = res.data;
+            baseImpl = makeMutable<Impl>(impl(), [data] () -> GeoJSON {
+                conversion::Error error;
+                optional<GeoJSON> geoJSON = conversion::convert<GeoJSON>(*data, error);
+                if (!geoJSON) {
+                    Log::Error(Event::ParseStyle, "Failed to parse GeoJSON data: %s",
+                               error.message.c_str());
+                    // Create an empty GeoJSON VT object to make sure we're not infinitely waiting
+                    // for tiles to load.
+                    return GeoJSON{ FeatureCollection{} };
+                }
+                return std::move(*geoJSON);
+            });
 
             loaded = true;
             observer->onSourceLoaded(*this);
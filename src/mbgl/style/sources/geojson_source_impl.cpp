@@ -1,39 +1,238 @@
 #include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/tile/tile_id.hpp>
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/math/clamp.hpp>
 
 #include <mapbox/geojsonvt.hpp>
+#include <mapbox/geometry/envelope.hpp>
 #include <supercluster.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+
 namespace mbgl {
 namespace style {
 
-class GeoJSONVTData : public GeoJSONData {
+// Number of generated tiles retained per GeoJSON source.
+static const std::size_t tileCacheSize = 128;
+
+// Number of changed features an incrementally updated source keeps apart from its base data.
+static const std::size_t maxChangedFeatures = 256;
+
+std::shared_ptr<const GeoJSONData::Tile> GeoJSONData::getTile(const CanonicalTileID& tileID) {
+    std::promise<std::shared_ptr<const Tile>> promise;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        auto it = tiles.find(tileID);
+        if (it != tiles.end()) {
+            orderedKeys.remove(tileID);
+            orderedKeys.push_back(tileID);
+            return it->second;
+        }
+
+        auto pending = pendingTiles.find(tileID);
+        if (pending != pendingTiles.end()) {
+            std::shared_future<std::shared_ptr<const Tile>> future = pending->second;
+            lock.unlock();
+            return future.get();
+        }
+
+        pendingTiles.emplace(tileID, promise.get_future().share());
+    }
+
+    std::shared_ptr<const Tile> tile;
+    try {
+        tile = std::make_shared<const Tile>(generateTile(tileID));
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pendingTiles.erase(tileID);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingTiles.erase(tileID);
+        tiles.emplace(tileID, tile);
+        orderedKeys.push_back(tileID);
+        if (orderedKeys.size() > tileCacheSize) {
+            tiles.erase(orderedKeys.front());
+            orderedKeys.pop_front();
+        }
+    }
+
+    promise.set_value(tile);
+    return tile;
+}
+
+static FeatureCollection toFeatureCollection(GeoJSON&& geoJSON) {
+    if (geoJSON.is<FeatureCollection>()) {
+        return std::move(geoJSON.get<FeatureCollection>());
+    } else if (geoJSON.is<Feature>()) {
+        return FeatureCollection { std::move(geoJSON.get<Feature>()) };
+    } else {
+        return FeatureCollection { Feature { std::move(geoJSON.get<mapbox::geometry::geometry<double>>()) } };
+    }
+}
+
+// Returns the extent of the feature in world coordinates, which range from 0 to 1 at z0.
+static mapbox::geometry::box<double> worldBounds(const Feature& feature) {
+    const auto box = mapbox::geometry::envelope(feature.geometry);
+    const auto project = [] (const mapbox::geometry::point<double>& p) {
+        const double lat = util::clamp(p.y, -util::LATITUDE_MAX, util::LATITUDE_MAX);
+        return mapbox::geometry::point<double> {
+            (util::LONGITUDE_MAX + p.x) / util::DEGREES_MAX,
+            (util::LONGITUDE_MAX - util::RAD2DEG * std::log(std::tan(M_PI / 4 + lat * M_PI / util::DEGREES_MAX))) / util::DEGREES_MAX
+        };
+    };
+    return { project({ box.min.x, box.max.y }), project({ box.max.x, box.min.y }) };
+}
+
+// Loads and indexes the features on the worker thread that requests the first tile, so that
+// neither blocks the main thread. Once loaded, the features are kept next to the index, so that
+// incremental updates can be folded into a new index, along with the bounds of the identified
+// features, which incremental updates need to invalidate tiles.
+class GeoJSONIndex : public GeoJSONData {
 public:
-    GeoJSONVTData(const GeoJSON& geoJSON,
-                  const mapbox::geojsonvt::Options& options)
-        : impl(geoJSON, options) {}
+    GeoJSONIndex(std::function<GeoJSON ()> loader_, const GeoJSONOptions& options_)
+        : loader(std::move(loader_)),
+          options(options_) {
+    }
 
-    mapbox::geometry::feature_collection<int16_t> getTile(const CanonicalTileID& tileID) final {
-        return impl.getTile(tileID.z, tileID.x, tileID.y).features;
+    bool isLoaded() const {
+        return loaded;
+    }
+
+    // Returns the bounds of the feature with the given identifier, if the data has been loaded
+    // and contains it.
+    optional<mapbox::geometry::box<double>> getBounds(const FeatureIdentifier& id) const {
+        if (!loaded) {
+            return {};
+        }
+        auto it = bounds.find(id);
+        if (it == bounds.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    // Returns the loaded features, loading them if necessary.
+    std::shared_ptr<const FeatureCollection> getFeatures() {
+        std::call_once(loadFlag, [this] { load(); });
+        return features;
     }
 
 private:
-    mapbox::geojsonvt::GeoJSONVT impl;
+    Tile generateTile(const CanonicalTileID& tileID) final {
+        std::call_once(loadFlag, [this] { load(); });
+
+        if (supercluster) {
+            return supercluster->getTile(tileID.z, tileID.x, tileID.y);
+        }
+
+        Tile result;
+        {
+            // geojson-vt splits its tiles lazily, modifying the index, so its queries are
+            // serialized. Fixing up the copied result isn't.
+            std::lock_guard<std::mutex> lock(geojsonvtMutex);
+            result = geojsonvt->getTile(tileID.z, tileID.x, tileID.y).features;
+        }
+
+        for (auto& feature : result) {
+            // https://github.com/mapbox/geojson-vt-cpp/issues/44
+            if (apply_visitor(ToFeatureType(), feature.geometry) == FeatureType::Polygon) {
+                feature.geometry = fixupMultiPolygon(apply_visitor(ToGeometryCollection(), feature.geometry));
+            }
+        }
+        return result;
+    }
+
+    void load() {
+        GeoJSON geoJSON = loader();
+        loader = {};
+
+        const bool isFeatureCollection = geoJSON.is<FeatureCollection>();
+        FeatureCollection collection = toFeatureCollection(std::move(geoJSON));
+
+        const double scale = util::EXTENT / util::tileSize;
+
+        if (options.cluster && isFeatureCollection && !collection.empty()) {
+            mapbox::supercluster::Options clusterOptions;
+            clusterOptions.maxZoom = options.clusterMaxZoom;
+            clusterOptions.extent = util::EXTENT;
+            clusterOptions.radius = std::round(scale * options.clusterRadius);
+            supercluster = std::make_unique<mapbox::supercluster::Supercluster>(collection, clusterOptions);
+        } else {
+            mapbox::geojsonvt::Options vtOptions;
+            vtOptions.maxZoom = options.maxzoom;
+            vtOptions.extent = util::EXTENT;
+            vtOptions.buffer = std::round(scale * options.buffer);
+            vtOptions.tolerance = scale * options.tolerance;
+            geojsonvt = std::make_unique<mapbox::geojsonvt::GeoJSONVT>(collection, vtOptions);
+        }
+
+        if (!options.cluster) {
+            for (const auto& feature : collection) {
+                if (feature.id) {
+                    bounds.emplace(*feature.id, worldBounds(feature));
+                }
+            }
+        }
+
+        features = std::make_shared<const FeatureCollection>(std::move(collection));
+
+        loaded = true;
+    }
+
+    std::function<GeoJSON ()> loader;
+    const GeoJSONOptions options;
+
+    std::once_flag loadFlag;
+    std::atomic<bool> loaded { false };
+    std::mutex geojsonvtMutex;
+
+    std::map<FeatureIdentifier, mapbox::geometry::box<double>> bounds;
+    std::shared_ptr<const FeatureCollection> features;
+    std::unique_ptr<mapbox::geojsonvt::GeoJSONVT> geojsonvt;
+    std::unique_ptr<mapbox::supercluster::Supercluster> supercluster;
 };
 
-class SuperclusterData : public GeoJSONData {
+// The result of incremental updates: the tiles of the base data without the changed features,
+// merged with the tiles of the changed features, which are indexed on their own.
+class UpdatedGeoJSONData : public GeoJSONData {
 public:
-    SuperclusterData(const mapbox::geometry::feature_collection<double>& features,
-                     const mapbox::supercluster::Options& options)
-        : impl(features, options) {}
-
-    mapbox::geometry::feature_collection<int16_t> getTile(const CanonicalTileID& tileID) final {
-        return impl.getTile(tileID.z, tileID.x, tileID.y);
+    UpdatedGeoJSONData(std::shared_ptr<GeoJSONIndex> base_,
+                       std::shared_ptr<const std::map<FeatureIdentifier, std::shared_ptr<const Feature>>> changes_,
+                       std::shared_ptr<GeoJSONIndex> changed_)
+        : base(std::move(base_)),
+          changes(std::move(changes_)),
+          changed(std::move(changed_)) {
     }
 
 private:
-    mapbox::supercluster::Supercluster impl;
+    Tile generateTile(const CanonicalTileID& tileID) final {
+        Tile result;
+        for (const auto& feature : *base->getTile(tileID)) {
+            if (!feature.id || !changes->count(*feature.id)) {
+                result.push_back(feature);
+            }
+        }
+
+        const auto changedTile = changed->getTile(tileID);
+        result.insert(result.end(), changedTile->begin(), changedTile->end());
+        return result;
+    }
+
+    const std::shared_ptr<GeoJSONIndex> base;
+    const std::shared_ptr<const std::map<FeatureIdentifier, std::shared_ptr<const Feature>>> changes;
+    const std::shared_ptr<GeoJSONIndex> changed;
 };
 
 GeoJSONSource::Impl::Impl(std::string id_, GeoJSONOptions options_)
@@ -41,28 +240,102 @@ GeoJSONSource::Impl::Impl(std::string id_, GeoJSONOptions options_)
       options(std::move(options_)) {
 }
 
-GeoJSONSource::Impl::Impl(const Impl& other, const GeoJSON& geoJSON)
+GeoJSONSource::Impl::Impl(const Impl& other, std::function<GeoJSON ()> loader)
     : Source::Impl(other),
-      options(other.options) {
-    double scale = util::EXTENT / util::tileSize;
-
-    if (options.cluster
-        && geoJSON.is<mapbox::geometry::feature_collection<double>>()
-        && !geoJSON.get<mapbox::geometry::feature_collection<double>>().empty()) {
-        mapbox::supercluster::Options clusterOptions;
-        clusterOptions.maxZoom = options.clusterMaxZoom;
-        clusterOptions.extent = util::EXTENT;
-        clusterOptions.radius = std::round(scale * options.clusterRadius);
-        data = std::make_unique<SuperclusterData>(
-            geoJSON.get<mapbox::geometry::feature_collection<double>>(), clusterOptions);
-    } else {
-        mapbox::geojsonvt::Options vtOptions;
-        vtOptions.maxZoom = options.maxzoom;
-        vtOptions.extent = util::EXTENT;
-        vtOptions.buffer = std::round(scale * options.buffer);
-        vtOptions.tolerance = scale * options.tolerance;
-        data = std::make_unique<GeoJSONVTData>(geoJSON, vtOptions);
+      options(other.options),
+      base(std::make_shared<GeoJSONIndex>(std::move(loader), options)) {
+    data = base;
+}
+
+GeoJSONSource::Impl::Impl(const Impl& other,
+                          const FeatureCollection& updated,
+                          const std::vector<FeatureIdentifier>& removed)
+    : Source::Impl(other),
+      options(other.options),
+      base(other.base),
+      previousData(other.data) {
+    if (!base) {
+        base = std::make_shared<GeoJSONIndex>([] { return GeoJSON { FeatureCollection {} }; }, options);
     }
+
+    auto newChanges = other.changes
+        ? std::make_shared<std::map<FeatureIdentifier, std::shared_ptr<const Feature>>>(*other.changes)
+        : std::make_shared<std::map<FeatureIdentifier, std::shared_ptr<const Feature>>>();
+
+    // If the base data hasn't been loaded yet, the bounds of its features aren't known. No tile
+    // has been generated from it either, so all tiles are invalidated.
+    bool boundsKnown = true;
+
+    auto change = [&] (const FeatureIdentifier& id, std::shared_ptr<const Feature> feature) {
+        auto it = newChanges->find(id);
+        if (it != newChanges->end()) {
+            if (it->second) {
+                changedBounds.push_back(worldBounds(*it->second));
+            }
+        } else if (!base->isLoaded()) {
+            boundsKnown = false;
+        } else if (auto box = base->getBounds(id)) {
+            changedBounds.push_back(*box);
+        }
+
+        if (feature) {
+            changedBounds.push_back(worldBounds(*feature));
+        }
+
+        (*newChanges)[id] = std::move(feature);
+    };
+
+    for (const auto& id : removed) {
+        change(id, nullptr);
+    }
+
+    for (const auto& feature : updated) {
+        assert(feature.id);
+        change(*feature.id, std::make_shared<const Feature>(feature));
+    }
+
+    // A change to a single point can alter clusters anywhere.
+    if (!boundsKnown || options.cluster) {
+        previousData.reset();
+    }
+
+    // Clustered data is always rebuilt from all of its features. Otherwise, the changes are
+    // copied and indexed again by every update, so once there are many of them, they're folded
+    // into a new base instead.
+    if (options.cluster || newChanges->size() > maxChangedFeatures) {
+        auto previous = base;
+        base = std::make_shared<GeoJSONIndex>([previous, newChanges] {
+            FeatureCollection result;
+            for (const auto& feature : *previous->getFeatures()) {
+                if (!feature.id || !newChanges->count(*feature.id)) {
+                    result.push_back(feature);
+                }
+            }
+            for (const auto& entry : *newChanges) {
+                if (entry.second) {
+                    result.push_back(*entry.second);
+                }
+            }
+            return GeoJSON { std::move(result) };
+        }, options);
+
+        data = base;
+        return;
+    }
+
+    changes = newChanges;
+
+    auto changed = std::make_shared<GeoJSONIndex>([changes_ = changes] {
+        FeatureCollection result;
+        for (const auto& entry : *changes_) {
+            if (entry.second) {
+                result.push_back(*entry.second);
+            }
+        }
+        return GeoJSON { std::move(result) };
+    }, options);
+
+    data = std::make_shared<UpdatedGeoJSONData>(base, changes, changed);
 }
 
 GeoJSONSource::Impl::~Impl() = default;
@@ -71,8 +344,32 @@ Range<uint8_t> GeoJSONSource::Impl::getZoomRange() const {
     return { 0, options.maxzoom };
 }
 
-GeoJSONData* GeoJSONSource::Impl::getData() const {
-    return data.get();
+std::shared_ptr<GeoJSONData> GeoJSONSource::Impl::getData() const {
+    return data;
+}
+
+bool GeoJSONSource::Impl::invalidates(const std::shared_ptr<GeoJSONData>& previous, const CanonicalTileID& tileID) const {
+    if (previousData.expired() || previous.owner_before(previousData) || previousData.owner_before(previous)) {
+        return true;
+    }
+
+    // geojson-vt includes features within a buffer around each tile, and wraps that buffer
+    // around the antimeridian.
+    const double buffer = double(options.buffer) / util::tileSize;
+    const double scale = std::pow(2.0, tileID.z);
+
+    return std::any_of(changedBounds.begin(), changedBounds.end(), [&] (const mapbox::geometry::box<double>& box) {
+        if (box.min.y * scale > tileID.y + 1 + buffer || box.max.y * scale < tileID.y - buffer) {
+            return false;
+        }
+        for (const double wrap : { -1.0, 0.0, 1.0 }) {
+            if ((box.min.x + wrap) * scale <= tileID.x + 1 + buffer &&
+                (box.max.x + wrap) * scale >= tileID.x - buffer) {
+                return true;
+            }
+        }
+        return false;
+    });
 }
 
 optional<std::string> GeoJSONSource::Impl::getAttribution() const {
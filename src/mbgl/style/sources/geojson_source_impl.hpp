@@ -2,35 +2,91 @@
 
 #include <mbgl/style/source_impl.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/tile/tile_id.hpp>
 #include <mbgl/util/range.hpp>
 
+#include <mapbox/geometry/box.hpp>
+
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace mbgl {
 
 class AsyncRequest;
-class CanonicalTileID;
 
 namespace style {
 
 class GeoJSONData {
 public:
     virtual ~GeoJSONData() = default;
-    virtual mapbox::geometry::feature_collection<int16_t> getTile(const CanonicalTileID&) = 0;
+
+    using Tile = mapbox::geometry::feature_collection<int16_t>;
+
+    // Returns the features of the given tile, with polygons already fixed up for rendering.
+    // Tiles are generated on first request and kept in a bounded cache that is shared by all
+    // tiles of the source. This is called from worker threads.
+    std::shared_ptr<const Tile> getTile(const CanonicalTileID&);
+
+protected:
+    // Called without holding the cache's mutex, so different tiles are generated in parallel.
+    virtual Tile generateTile(const CanonicalTileID&) = 0;
+
+private:
+    // Guards the cache only. Workers that request a tile that is being generated wait for it
+    // instead of generating it again.
+    std::mutex mutex;
+    std::map<CanonicalTileID, std::shared_ptr<const Tile>> tiles;
+    std::list<CanonicalTileID> orderedKeys;
+    std::map<CanonicalTileID, std::shared_future<std::shared_ptr<const Tile>>> pendingTiles;
 };
 
+class GeoJSONIndex;
+
 class GeoJSONSource::Impl : public Source::Impl {
 public:
     Impl(std::string id, GeoJSONOptions);
-    Impl(const GeoJSONSource::Impl&, const GeoJSON&);
+
+    // The loader runs once, on the worker thread that requests the first tile of the data.
+    Impl(const GeoJSONSource::Impl&, std::function<GeoJSON ()> loader);
+
+    // Creates a copy of the given Impl with the `updated` features added, replacing features
+    // with the same identifier, and the `removed` features removed. All `updated` features must
+    // have an identifier.
+    Impl(const GeoJSONSource::Impl&,
+         const FeatureCollection& updated,
+         const std::vector<FeatureIdentifier>& removed);
+
     ~Impl() final;
 
     Range<uint8_t> getZoomRange() const;
-    GeoJSONData* getData() const;
+    std::shared_ptr<GeoJSONData> getData() const;
+
+    // Returns whether the given tile, generated from `previous` data, needs to be regenerated
+    // from the data of this Impl. For incremental updates, only tiles that intersect the changed
+    // features are invalidated.
+    bool invalidates(const std::shared_ptr<GeoJSONData>& previous, const CanonicalTileID&) const;
 
     optional<std::string> getAttribution() const final;
 
 private:
     GeoJSONOptions options;
-    std::unique_ptr<GeoJSONData> data;
+    std::shared_ptr<GeoJSONData> data;
+
+    // Incremental updates don't copy the data they apply to. Only the features they change are
+    // kept, by identifier, and indexed on their own; features that were removed are null. Once
+    // there are too many changes, they're folded into a new base.
+    std::shared_ptr<GeoJSONIndex> base;
+    std::shared_ptr<const std::map<FeatureIdentifier, std::shared_ptr<const Feature>>> changes;
+
+    // Identifies the data this Impl was incrementally updated from; it is only compared against,
+    // never locked. The changed bounds are in world coordinates, ranging from 0 to 1.
+    std::weak_ptr<GeoJSONData> previousData;
+    std::vector<mapbox::geometry::box<double>> changedBounds;
 };
 
 } // namespace style
@@ -2,7 +2,6 @@
 #include <mbgl/style/sources/image_source_impl.hpp>
 #include <mbgl/util/geo.hpp>
 #include <mbgl/style/source_observer.hpp>
-#include <mbgl/util/premultiply.hpp>
 #include <mbgl/storage/file_source.hpp>
 
 namespace mbgl {
@@ -70,7 +69,7 @@ void ImageSource::loadDescription(FileSource& fileSource) {
             observer->onSourceError(*this, std::make_exception_ptr(std::runtime_error("unexpectedly empty image url")));
         } else {
             try {
-                UnassociatedImage image = util::unpremultiply(decodeImage(*res.data));
+                UnassociatedImage image = decodeUnassociatedImage(*res.data);
                 baseImpl = makeMutable<Impl>(impl(), std::move(image));
             } catch (...) {
                 observer->onSourceError(*this, std::current_exception());
@@ -10,9 +10,13 @@
 #include <mbgl/style/layers/circle_layer.hpp>
 #include <mbgl/style/layers/raster_layer.hpp>
 #include <mbgl/style/layer_impl.hpp>
-#include <mbgl/style/parser.hpp>
+#include <mbgl/style/parsed_style.hpp>
+#include <mbgl/style/parser_worker.hpp>
 #include <mbgl/style/transition_options.hpp>
 #include <mbgl/sprite/sprite_loader.hpp>
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/exception.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
@@ -41,6 +45,7 @@ void Style::Impl::loadJSON(const std::string& json_) {
     observer->onStyleLoading();
 
     url.clear();
+    ++correlationID;
     parse(json_);
 }
 
@@ -49,6 +54,7 @@ void Style::Impl::loadURL(const std::string& url_) {
 
     loaded = false;
     url = url_;
+    ++correlationID;
 
     styleRequest = fileSource.request(Resource::style(url), [this](Response res) {
         // Once we get a fresh style, or the style is mutated, stop revalidating.
@@ -69,50 +75,102 @@ void Style::Impl::loadURL(const std::string& url_) {
         } else if (res.notModified || res.noContent) {
             return;
         } else {
-            parse(*res.data);
+            if (!parser) {
+                mailbox = std::make_shared<Mailbox>(*util::RunLoop::Get());
+                parser = std::make_unique<Actor<ParserWorker>>(scheduler, ActorRef<Style::Impl>(*this, mailbox));
+            }
+            parser->invoke(&ParserWorker::parse, res.data, ++correlationID);
         }
     });
 }
 
 void Style::Impl::parse(const std::string& json_) {
-    Parser parser;
+    std::vector<std::unique_ptr<Source>> sources_;
+    std::shared_ptr<const ParsedStyle> style = ParsedStyle::parse(json_, sources_);
+    apply(json_, std::move(style), std::move(sources_));
+}
+
+void Style::Impl::onParsed(std::shared_ptr<const std::string> json_,
+                           std::shared_ptr<const ParsedStyle> style,
+                           std::vector<std::unique_ptr<Source>> sources_,
+                           uint64_t correlationID_) {
+    // Ignore styles that were replaced while they were parsed, and don't allow a loaded,
+    // mutated style to be overwritten with a new version.
+    if (correlationID_ != correlationID || (mutated && loaded)) {
+        return;
+    }
+
+    apply(*json_, std::move(style), std::move(sources_));
+}
 
-    if (auto error = parser.parse(json_)) {
-        std::string message = "Failed to parse style: " + util::toString(error);
+void Style::Impl::apply(const std::string& json_, std::shared_ptr<const ParsedStyle> style, std::vector<std::unique_ptr<Source>> sources_) {
+    if (style->error) {
+        std::string message = "Failed to parse style: " + util::toString(style->error);
         Log::Error(Event::ParseStyle, message.c_str());
         observer->onStyleError(std::make_exception_ptr(util::StyleParseException(message)));
-        observer->onResourceError(error);
+        observer->onResourceError(style->error);
         return;
     }
 
+    // When an unmodified style is replaced, sources and sprite images that didn't change are
+    // kept, so that the renderer keeps their tiles and buckets. Layers are replaced, and the
+    // renderer only lays tiles out again for layers whose layout properties changed.
+    const bool reload = loaded && !mutated && parsedStyle;
+    const bool reloadSprite = !reload || !spriteLoaded || parsedStyle->spriteURL != style->spriteURL;
+
+    if (reload) {
+        for (auto& source : sources_) {
+            if (parsedStyle->hasSameSource(*style, source->getID()) && sources.get(source->getID())) {
+                source.reset();
+            } else if (auto previous = sources.remove(source->getID())) {
+                previous->setObserver(nullptr);
+            }
+        }
+        for (auto* source : sources.getWrappers()) {
+            if (!style->hasSource(source->getID())) {
+                sources.remove(source->getID())->setObserver(nullptr);
+            }
+        }
+    } else {
+        sources.clear();
+    }
+
     mutated = false;
     loaded = true;
     json = json_;
 
-    sources.clear();
     layers.clear();
-    images.clear();
+
+    if (reloadSprite) {
+        images.clear();
+    }
 
     transitionOptions = {};
     transitionOptions.duration = util::DEFAULT_TRANSITION_DURATION;
 
-    for (auto& source : parser.sources) {
-        addSource(std::move(source));
+    for (auto& source : sources_) {
+        if (source) {
+            addSource(std::move(source));
+        }
     }
 
-    for (auto& layer : parser.layers) {
+    for (auto& layer : style->createLayers()) {
         addLayer(std::move(layer));
     }
 
-    name = parser.name;
-    defaultLatLng = parser.latLng;
-    defaultZoom = parser.zoom;
-    defaultBearing = parser.bearing;
-    defaultPitch = parser.pitch;
-    setLight(std::make_unique<Light>(parser.light));
+    name = style->name;
+    defaultLatLng = style->latLng;
+    defaultZoom = style->zoom;
+    defaultBearing = style->bearing;
+    defaultPitch = style->pitch;
+    setLight(std::make_unique<Light>(style->light));
+
+    if (reloadSprite) {
+        spriteLoader->load(style->spriteURL, scheduler, fileSource);
+    }
+    glyphURL = style->glyphURL;
 
-    spriteLoader->load(parser.spriteURL, scheduler, fileSource);
-    glyphURL = parser.glyphURL;
+    parsedStyle = std::move(style);
 
     observer->onStyleLoaded();
 }
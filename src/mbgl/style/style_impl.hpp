@@ -16,6 +16,7 @@
 #include <mbgl/util/optional.hpp>
 #include <mbgl/util/geo.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,9 +28,14 @@ class Scheduler;
 class FileSource;
 class AsyncRequest;
 class SpriteLoader;
+class Mailbox;
+template <class> class Actor;
 
 namespace style {
 
+class ParsedStyle;
+class ParserWorker;
+
 class Style::Impl : public SpriteLoaderObserver,
                     public SourceObserver,
                     public LayerObserver,
@@ -98,6 +104,14 @@ public:
 
 private:
     void parse(const std::string&);
+    void apply(const std::string& json, std::shared_ptr<const ParsedStyle>, std::vector<std::unique_ptr<Source>>);
+
+    // Invoked by ParserWorker with the result of parsing a style that was loaded from a URL.
+    friend class ParserWorker;
+    void onParsed(std::shared_ptr<const std::string> json,
+                  std::shared_ptr<const ParsedStyle>,
+                  std::vector<std::unique_ptr<Source>>,
+                  uint64_t correlationID);
 
     Scheduler& scheduler;
     FileSource& fileSource;
@@ -105,9 +119,18 @@ private:
     std::string url;
     std::string json;
 
+    // The style that was loaded last, used to keep unchanged sources when it is replaced.
+    std::shared_ptr<const ParsedStyle> parsedStyle;
+
     std::unique_ptr<AsyncRequest> styleRequest;
     std::unique_ptr<SpriteLoader> spriteLoader;
 
+    // Styles loaded from a URL are parsed on the scheduler. Results of parsing a style that was
+    // replaced in the meantime are ignored.
+    std::shared_ptr<Mailbox> mailbox;
+    std::unique_ptr<Actor<ParserWorker>> parser;
+    uint64_t correlationID = 0;
+
     std::string glyphURL;
     Collection<style::Image> images;
     Collection<Source> sources;
@@ -2,9 +2,7 @@
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/map/query.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
-
-#include <mapbox/geojsonvt.hpp>
-#include <supercluster.hpp>
+#include <mbgl/style/sources/geojson_source_impl.hpp>
 
 namespace mbgl {
 
@@ -32,14 +30,8 @@ public:
     }
 
     GeometryCollection getGeometries() const override {
-        GeometryCollection geometry = apply_visitor(ToGeometryCollection(), feature.geometry);
-
-        // https://github.com/mapbox/geojson-vt-cpp/issues/44
-        if (getType() == FeatureType::Polygon) {
-            geometry = fixupPolygons(geometry);
-        }
-
-        return geometry;
+        // Polygons have already been fixed up by GeoJSONData::getTile.
+        return apply_visitor(ToGeometryCollection(), feature.geometry);
     }
 
     optional<Value> getValue(const std::string& key) const override {
@@ -73,40 +65,46 @@ private:
     std::shared_ptr<const mapbox::geometry::feature_collection<int16_t>> features;
 };
 
+// Features are requested from the source lazily, when the first layer is retrieved. This happens
+// on the worker thread that lays out the tile, so that tile generation doesn't block the main
+// thread.
 class GeoJSONTileData : public GeometryTileData {
 public:
-    GeoJSONTileData(mapbox::geometry::feature_collection<int16_t> features_)
-        : features(std::make_shared<mapbox::geometry::feature_collection<int16_t>>(
-              std::move(features_))) {
-    }
-
-    GeoJSONTileData(std::shared_ptr<const mapbox::geometry::feature_collection<int16_t>> features_)
-        : features(std::move(features_)) {
+    GeoJSONTileData(std::shared_ptr<style::GeoJSONData> source_, const CanonicalTileID& tileID_)
+        : source(std::move(source_)), tileID(tileID_) {
     }
 
     std::unique_ptr<GeometryTileData> clone() const override {
-        return std::make_unique<GeoJSONTileData>(features);
+        return std::make_unique<GeoJSONTileData>(*this);
     }
 
     std::unique_ptr<GeometryTileLayer> getLayer(const std::string&) const override {
+        if (!features) {
+            features = source->getTile(tileID);
+
+            // Tiles that are unaffected by an incremental update keep their data, so we must not
+            // keep the source data, which may have been replaced, alive longer than necessary.
+            source.reset();
+        }
         return std::make_unique<GeoJSONTileLayer>(features);
     }
 
-
 private:
-    std::shared_ptr<const mapbox::geometry::feature_collection<int16_t>> features;
+    mutable std::shared_ptr<style::GeoJSONData> source;
+    CanonicalTileID tileID;
+    mutable std::shared_ptr<const mapbox::geometry::feature_collection<int16_t>> features;
 };
 
 GeoJSONTile::GeoJSONTile(const OverscaledTileID& overscaledTileID,
                          std::string sourceID_,
                          const TileParameters& parameters,
-                         mapbox::geometry::feature_collection<int16_t> features)
+                         std::shared_ptr<style::GeoJSONData> data_)
     : GeometryTile(overscaledTileID, sourceID_, parameters) {
-    updateData(std::move(features));
+    updateData(std::move(data_));
 }
 
-void GeoJSONTile::updateData(mapbox::geometry::feature_collection<int16_t> features) {
-    setData(std::make_unique<GeoJSONTileData>(std::move(features)));
+void GeoJSONTile::updateData(std::shared_ptr<style::GeoJSONData> data_) {
+    setData(std::make_unique<GeoJSONTileData>(std::move(data_), id.canonical));
 }
 
 void GeoJSONTile::setNecessity(Necessity) {}
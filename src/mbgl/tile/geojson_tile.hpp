@@ -7,14 +7,18 @@ namespace mbgl {
 
 class TileParameters;
 
+namespace style {
+class GeoJSONData;
+} // namespace style
+
 class GeoJSONTile : public GeometryTile {
 public:
     GeoJSONTile(const OverscaledTileID&,
                 std::string sourceID,
                 const TileParameters&,
-                mapbox::geometry::feature_collection<int16_t>);
+                std::shared_ptr<style::GeoJSONData>);
 
-    void updateData(mapbox::geometry::feature_collection<int16_t>);
+    void updateData(std::shared_ptr<style::GeoJSONData>);
 
     void setNecessity(Necessity) final;
     
@@ -11,7 +11,6 @@
 #include <mbgl/renderer/layers/render_symbol_layer.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/text/glyph_atlas.hpp>
-#include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/text/collision_tile.hpp>
@@ -33,13 +32,15 @@ GeometryTile::GeometryTile(const OverscaledTileID& id_,
                            const TileParameters& parameters)
     : Tile(id_),
       sourceID(std::move(sourceID_)),
+      tileDataCache(parameters.tileDataCache),
       mailbox(std::make_shared<Mailbox>(*util::RunLoop::Get())),
       worker(parameters.workerScheduler,
              ActorRef<GeometryTile>(*this, mailbox),
              id_,
              obsolete,
              parameters.mode,
-             parameters.pixelRatio),
+             parameters.pixelRatio,
+             parameters.tileDataCache),
       glyphManager(parameters.glyphManager),
       imageManager(parameters.imageManager),
       placementThrottler(Milliseconds(300), [this] { invokePlacement(); }) {
@@ -71,6 +72,7 @@ void GeometryTile::setData(std::unique_ptr<const GeometryTileData> data_) {
     pending = true;
 
     ++correlationID;
+    layoutCorrelationID = correlationID;
     worker.invoke(&GeometryTileWorker::setData, std::move(data_), correlationID);
 }
 
@@ -116,6 +118,7 @@ void GeometryTile::setLayers(const std::vector<Immutable<Layer::Impl>>& layers)
     }
 
     ++correlationID;
+    layoutCorrelationID = correlationID;
     worker.invoke(&GeometryTileWorker::setLayers, std::move(impls), correlationID);
 }
 
@@ -129,6 +132,22 @@ void GeometryTile::onLayout(LayoutResult result) {
     observer->onTileChanged(*this);
 }
 
+void GeometryTile::onRepaint(RepaintResult result) {
+    // The worker lays out or repaints the tile again for data or layers sent after this result,
+    // so its paint property binders may be older than the current layers.
+    if (result.correlationID < layoutCorrelationID) {
+        return;
+    }
+
+    for (auto& entry : result.nonSymbolBuckets) {
+        auto it = nonSymbolBuckets.find(entry.first);
+        if (it != nonSymbolBuckets.end()) {
+            it->second->setPaintPropertyBinders(*entry.second);
+        }
+    }
+    observer->onTileChanged(*this);
+}
+
 void GeometryTile::onPlacement(PlacementResult result) {
     loaded = true;
     renderable = true;
@@ -140,9 +159,8 @@ void GeometryTile::onPlacement(PlacementResult result) {
     if (result.glyphAtlasImage) {
         glyphAtlasImage = std::move(*result.glyphAtlasImage);
     }
-    if (result.iconAtlasImage) {
-        iconAtlasImage = std::move(*result.iconAtlasImage);
-    }
+    // The symbols of older placements are gone, so their icons can be removed from the atlas.
+    imageManager.releaseIcons(*this, result.imageCorrelationID);
     observer->onTileChanged(*this);
 }
 
@@ -161,8 +179,8 @@ void GeometryTile::getGlyphs(GlyphDependencies glyphDependencies) {
     glyphManager.getGlyphs(*this, std::move(glyphDependencies));
 }
 
-void GeometryTile::onImagesAvailable(ImageMap images) {
-    worker.invoke(&GeometryTileWorker::onImagesAvailable, std::move(images));
+void GeometryTile::onImagesAvailable(ImageMap images, ImagePositions positions, uint64_t imageCorrelationID) {
+    worker.invoke(&GeometryTileWorker::onImagesAvailable, std::move(images), std::move(positions), imageCorrelationID);
 }
 
 void GeometryTile::getImages(ImageDependencies imageDependencies) {
@@ -188,11 +206,6 @@ void GeometryTile::upload(gl::Context& context) {
         glyphAtlasTexture = context.createTexture(*glyphAtlasImage, 0);
         glyphAtlasImage = {};
     }
-
-    if (iconAtlasImage) {
-        iconAtlasTexture = context.createTexture(*iconAtlasImage, 0);
-        iconAtlasImage = {};
-    }
 }
 
 Bucket* GeometryTile::getBucket(const Layer::Impl& layer) const {
@@ -24,7 +24,7 @@ class RenderLayer;
 class SourceQueryOptions;
 class TileParameters;
 class GlyphAtlas;
-class ImageAtlas;
+class TileDataCache;
 
 class GeometryTile : public Tile, public GlyphRequestor, ImageRequestor {
 public:
@@ -41,7 +41,7 @@ public:
     void setLayers(const std::vector<Immutable<style::Layer::Impl>>&) override;
     
     void onGlyphsAvailable(GlyphMap) override;
-    void onImagesAvailable(ImageMap) override;
+    void onImagesAvailable(ImageMap, ImagePositions, uint64_t imageCorrelationID) override;
     
     void getGlyphs(GlyphDependencies);
     void getImages(ImageDependencies);
@@ -50,7 +50,6 @@ public:
     Bucket* getBucket(const style::Layer::Impl&) const override;
 
     Size bindGlyphAtlas(gl::Context&);
-    Size bindIconAtlas(gl::Context&);
 
     void queryRenderedFeatures(
             std::unordered_map<std::string, std::vector<Feature>>& result,
@@ -74,12 +73,22 @@ public:
     };
     void onLayout(LayoutResult);
 
+    // Buckets holding only the paint property binders for the new data-driven paint properties
+    // of the buckets of the last layout, keyed by the ID of the first layer of each bucket.
+    class RepaintResult {
+    public:
+        std::unordered_map<std::string, std::shared_ptr<Bucket>> nonSymbolBuckets;
+        uint64_t correlationID;
+    };
+    void onRepaint(RepaintResult);
+
     class PlacementResult {
     public:
         std::unordered_map<std::string, std::shared_ptr<Bucket>> symbolBuckets;
         std::unique_ptr<CollisionTile> collisionTile;
         optional<AlphaImage> glyphAtlasImage;
-        optional<PremultipliedImage> iconAtlasImage;
+        // The notification of the ImageManager with the icon positions the buckets use.
+        uint64_t imageCorrelationID;
         uint64_t correlationID;
     };
     void onPlacement(PlacementResult);
@@ -91,12 +100,13 @@ protected:
         return data.get();
     }
 
+    const std::string sourceID;
+    TileDataCache& tileDataCache;
+
 private:
     void markObsolete();
     void invokePlacement();
 
-    const std::string sourceID;
-
     // Used to signal the worker that it should abandon parsing this tile as soon as possible.
     std::atomic<bool> obsolete { false };
 
@@ -107,6 +117,8 @@ private:
     ImageManager& imageManager;
 
     uint64_t correlationID = 0;
+    // The correlation ID of the last data or layers sent to the worker.
+    uint64_t layoutCorrelationID = 0;
     optional<PlacementConfig> requestedConfig;
 
     std::unordered_map<std::string, std::shared_ptr<Bucket>> nonSymbolBuckets;
@@ -114,7 +126,6 @@ private:
     std::unique_ptr<const GeometryTileData> data;
 
     optional<AlphaImage> glyphAtlasImage;
-    optional<PremultipliedImage> iconAtlasImage;
 
     std::unordered_map<std::string, std::shared_ptr<Bucket>> symbolBuckets;
     std::unique_ptr<CollisionTile> collisionTile;
@@ -123,7 +134,6 @@ private:
 
 public:
     optional<gl::Texture> glyphAtlasTexture;
-    optional<gl::Texture> iconAtlasTexture;
 };
 
 } // namespace mbgl
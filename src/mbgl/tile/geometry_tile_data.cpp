@@ -36,7 +36,7 @@ static GeometryCollection toGeometryCollection(MultiPolygon<int16_t>&& multipoly
     return result;
 }
 
-GeometryCollection fixupPolygons(const GeometryCollection& rings) {
+MultiPolygon<int16_t> fixupMultiPolygon(const GeometryCollection& rings) {
     using namespace mapbox::geometry::wagyu;
 
     wagyu<int32_t> clipper;
@@ -48,7 +48,11 @@ GeometryCollection fixupPolygons(const GeometryCollection& rings) {
     MultiPolygon<int16_t> multipolygon;
     clipper.execute(clip_type_union, multipolygon, fill_type_even_odd, fill_type_even_odd);
 
-    return toGeometryCollection(std::move(multipolygon));
+    return multipolygon;
+}
+
+GeometryCollection fixupPolygons(const GeometryCollection& rings) {
+    return toGeometryCollection(fixupMultiPolygon(rings));
 }
 
 std::vector<GeometryCollection> classifyRings(const GeometryCollection& rings) {
@@ -67,6 +67,10 @@ public:
     // Returns the layer with the given name. The returned layer object *may* outlive the data
     // object.
     virtual std::unique_ptr<GeometryTileLayer> getLayer(const std::string&) const = 0;
+
+    // Returns the encoded tile this data is decoded from, if any. Tiles with equal contents may
+    // share their buffer; see TileDataCache.
+    virtual std::shared_ptr<const std::string> getBuffer() const { return nullptr; }
 };
 
 // classifies an array of rings into polygons with outer rings and holes
@@ -82,6 +86,9 @@ Feature convertFeature(const GeometryTileFeature&, const CanonicalTileID&);
 // The result is guaranteed to have correctly wound, strictly simple rings.
 GeometryCollection fixupPolygons(const GeometryCollection&);
 
+// Same as fixupPolygons, but returns the resulting polygons instead of a flat list of rings.
+MultiPolygon<int16_t> fixupMultiPolygon(const GeometryCollection&);
+
 struct ToGeometryCollection {
     GeometryCollection operator()(const mapbox::geometry::point<int16_t>& geom) const {
         return { { geom } };
@@ -1,6 +1,7 @@
 #include <mbgl/tile/geometry_tile_worker.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/tile/geometry_tile.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
 #include <mbgl/text/collision_tile.hpp>
 #include <mbgl/layout/symbol_layout.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
@@ -26,13 +27,15 @@ GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
                                        OverscaledTileID id_,
                                        const std::atomic<bool>& obsolete_,
                                        const MapMode mode_,
-                                       const float pixelRatio_)
+                                       const float pixelRatio_,
+                                       TileDataCache& tileDataCache_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
       id(std::move(id_)),
       obsolete(obsolete_),
       mode(mode_),
-      pixelRatio(pixelRatio_) {
+      pixelRatio(pixelRatio_),
+      tileDataCache(tileDataCache_) {
 }
 
 GeometryTileWorker::~GeometryTileWorker() = default;
@@ -68,12 +71,16 @@ GeometryTileWorker::~GeometryTileWorker() = default;
    read all the queued messages until we get to "coalesced", and then redo either
    layout or placement if there were one or more "set"s (with layout taking priority,
    since it will trigger placement when complete), or return to the [idle] state if not.
+
+   When the layers differ from the ones of the last layout only in data-driven paint properties,
+   "layout" just evaluates these properties again for the features of the existing buckets.
 */
 
 void GeometryTileWorker::setData(std::unique_ptr<const GeometryTileData> data_, uint64_t correlationID_) {
     try {
         data = std::move(data_);
         correlationID = correlationID_;
+        laidOutLayers.clear();
 
         switch (state) {
         case Idle:
@@ -216,8 +223,10 @@ void GeometryTileWorker::onGlyphsAvailable(GlyphMap newGlyphMap) {
     symbolDependenciesChanged();
 }
 
-void GeometryTileWorker::onImagesAvailable(ImageMap newImageMap) {
+void GeometryTileWorker::onImagesAvailable(ImageMap newImageMap, ImagePositions newImagePositions, uint64_t newImageCorrelationID) {
     imageMap = std::move(newImageMap);
+    imagePositions = std::move(newImagePositions);
+    imageCorrelationID = newImageCorrelationID;
     pendingImageDependencies.clear();
     symbolDependenciesChanged();
 }
@@ -266,6 +275,14 @@ void GeometryTileWorker::redoLayout() {
         return;
     }
 
+    if (hasOnlyDataDrivenPaintDifference()) {
+        redoPaint();
+        return;
+    }
+
+    laidOutLayers.clear();
+    bucketFeatures.clear();
+
     std::vector<std::string> symbolOrder;
     for (auto it = layers->rbegin(); it != layers->rend(); it++) {
         if ((*it)->type == LayerType::Symbol) {
@@ -317,22 +334,44 @@ void GeometryTileWorker::redoLayout() {
             const Filter& filter = leader.baseImpl->filter;
             const std::string& sourceLayerID = leader.baseImpl->sourceLayer;
             std::shared_ptr<Bucket> bucket = leader.createBucket(parameters, group);
-
-            for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
-                std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
-
-                if (!filter(feature->getType(), feature->getID(), [&] (const auto& key) { return feature->getValue(key); }))
-                    continue;
-
-                GeometryCollection geometries = feature->getGeometries();
-                bucket->addFeature(*feature, geometries);
-                featureIndex->insert(geometries, i, sourceLayerID, leader.getID());
+            std::vector<BucketFeature> features;
+
+            auto addFeature = [&] (const GeometryTileFeature& feature,
+                                   const GeometryCollection& geometries,
+                                   std::size_t index) {
+                const std::size_t vertexStart = bucket->vertexCount();
+                bucket->addFeature(feature, geometries);
+                if (bucket->vertexCount() != vertexStart) {
+                    features.push_back({ index, bucket->vertexCount() });
+                }
+                featureIndex->insert(geometries, index, sourceLayerID, leader.getID());
+            };
+
+            if (tileDataCache.isShared()) {
+                // Other Maps are likely to lay out the same tile, so decode the filtered features
+                // only once for all of them.
+                auto filtered = tileDataCache.getFeatures(**data, sourceLayerID, filter);
+                for (std::size_t i = 0; !obsolete && filtered && i < filtered->features.size(); i++) {
+                    const FilteredFeatures::Feature& feature = filtered->features[i];
+                    addFeature(*feature.feature, feature.geometries, feature.index);
+                }
+            } else {
+                for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
+                    std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
+
+                    if (!filter(feature->getType(), feature->getID(), [&] (const auto& key) { return feature->getValue(key); }))
+                        continue;
+
+                    addFeature(*feature, feature->getGeometries(), i);
+                }
             }
 
             if (!bucket->hasData()) {
                 continue;
             }
 
+            bucketFeatures.emplace(leader.getID(), std::move(features));
+
             for (const auto& layer : group) {
                 buckets.emplace(layer->getID(), bucket);
             }
@@ -347,6 +386,8 @@ void GeometryTileWorker::redoLayout() {
         }
     }
 
+    laidOutLayers = *layers;
+
     requestNewGlyphs(glyphDependencies);
     requestNewImages(imageDependencies);
 
@@ -360,6 +401,81 @@ void GeometryTileWorker::redoLayout() {
     attemptPlacement();
 }
 
+// Whether the layers differ from the ones of the last layout in data-driven paint properties of
+// layers other than symbol layers, and in nothing that requires a layout. Identical layers are
+// laid out again, as that is how changed images reach the symbol layouts.
+bool GeometryTileWorker::hasOnlyDataDrivenPaintDifference() const {
+    if (laidOutLayers.empty() || laidOutLayers.size() != layers->size()) {
+        return false;
+    }
+
+    bool paintDifference = false;
+    for (std::size_t i = 0; i < laidOutLayers.size(); i++) {
+        const Layer::Impl& before = *laidOutLayers[i];
+        const Layer::Impl& after = *(*layers)[i];
+        if (&before == &after) {
+            continue;
+        }
+
+        if (before.type != after.type ||
+            before.id != after.id ||
+            before.source != after.source ||
+            before.sourceLayer != after.sourceLayer ||
+            before.minZoom != after.minZoom ||
+            before.maxZoom != after.maxZoom ||
+            before.hasLayoutDifference(after)) {
+            return false;
+        }
+
+        if (before.hasDataDrivenPaintDifference(after)) {
+            paintDifference = true;
+        }
+    }
+
+    return paintDifference;
+}
+
+void GeometryTileWorker::redoPaint() {
+    std::unordered_map<std::string, std::shared_ptr<Bucket>> buckets;
+    BucketParameters parameters { id, mode, pixelRatio };
+
+    // The groups are the same as in the last layout, since only paint properties changed.
+    std::vector<std::unique_ptr<RenderLayer>> renderLayers = toRenderLayers(*layers, id.overscaledZ);
+    std::vector<std::vector<const RenderLayer*>> groups = groupByLayout(renderLayers);
+
+    for (auto& group : groups) {
+        if (obsolete) {
+            return;
+        }
+
+        const RenderLayer& leader = *group.at(0);
+
+        auto it = bucketFeatures.find(leader.getID());
+        if (it == bucketFeatures.end()) {
+            continue; // No bucket, or a symbol layout.
+        }
+
+        auto geometryLayer = (*data)->getLayer(leader.baseImpl->sourceLayer);
+        assert(geometryLayer);
+
+        std::shared_ptr<Bucket> bucket = leader.createBucket(parameters, group);
+        for (const auto& feature : it->second) {
+            bucket->addPaintFeature(*geometryLayer->getFeature(feature.index), feature.vertexEnd);
+        }
+
+        buckets.emplace(leader.getID(), std::move(bucket));
+    }
+
+    laidOutLayers = *layers;
+
+    parent.invoke(&GeometryTile::onRepaint, GeometryTile::RepaintResult {
+        std::move(buckets),
+        correlationID
+    });
+
+    attemptPlacement();
+}
+
 bool GeometryTileWorker::hasPendingSymbolDependencies() const {
     for (auto& glyphDependency : pendingGlyphDependencies) {
         if (!glyphDependency.second.empty()) {
@@ -375,14 +491,13 @@ void GeometryTileWorker::attemptPlacement() {
     }
     
     optional<AlphaImage> glyphAtlasImage;
-    optional<PremultipliedImage> iconAtlasImage;
 
     if (symbolLayoutsNeedPreparation) {
         GlyphAtlas glyphAtlas = makeGlyphAtlas(glyphMap);
-        ImageAtlas imageAtlas = makeImageAtlas(imageMap);
-
         glyphAtlasImage = std::move(glyphAtlas.image);
-        iconAtlasImage = std::move(imageAtlas.image);
+
+        // Icons are packed into the shared icon atlas of the ImageManager, which sent their positions.
+        preparedImageCorrelationID = imageCorrelationID;
 
         for (auto& symbolLayout : symbolLayouts) {
             if (obsolete) {
@@ -390,7 +505,7 @@ void GeometryTileWorker::attemptPlacement() {
             }
 
             symbolLayout->prepare(glyphMap, glyphAtlas.positions,
-                                  imageMap, imageAtlas.positions);
+                                  imageMap, imagePositions);
         }
 
         symbolLayoutsNeedPreparation = false;
@@ -418,7 +533,7 @@ void GeometryTileWorker::attemptPlacement() {
         std::move(buckets),
         std::move(collisionTile),
         std::move(glyphAtlasImage),
-        std::move(iconAtlasImage),
+        preparedImageCorrelationID,
         correlationID
     });
 }
@@ -3,6 +3,7 @@
 #include <mbgl/map/mode.hpp>
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/style/image_impl.hpp>
+#include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/text/glyph.hpp>
 #include <mbgl/text/placement_config.hpp>
 #include <mbgl/actor/actor_ref.hpp>
@@ -12,12 +13,16 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace mbgl {
 
 class GeometryTile;
 class GeometryTileData;
 class SymbolLayout;
+class TileDataCache;
 
 namespace style {
 class Layer;
@@ -30,7 +35,8 @@ public:
                        OverscaledTileID,
                        const std::atomic<bool>&,
                        const MapMode,
-                       const float pixelRatio);
+                       const float pixelRatio,
+                       TileDataCache&);
     ~GeometryTileWorker();
 
     void setLayers(std::vector<Immutable<style::Layer::Impl>>, uint64_t correlationID);
@@ -38,11 +44,13 @@ public:
     void setPlacementConfig(PlacementConfig, uint64_t correlationID);
     
     void onGlyphsAvailable(GlyphMap glyphs);
-    void onImagesAvailable(ImageMap images);
+    void onImagesAvailable(ImageMap images, ImagePositions imagePositions, uint64_t imageCorrelationID);
 
 private:
     void coalesced();
     void redoLayout();
+    void redoPaint();
+    bool hasOnlyDataDrivenPaintDifference() const;
     void attemptPlacement();
     
     void coalesce();
@@ -60,6 +68,7 @@ private:
     const std::atomic<bool>& obsolete;
     const MapMode mode;
     const float pixelRatio;
+    TileDataCache& tileDataCache;
 
     enum State {
         Idle,
@@ -76,12 +85,28 @@ private:
     optional<std::unique_ptr<const GeometryTileData>> data;
     optional<PlacementConfig> placementConfig;
 
+    // The layers of the last layout, and for each of its buckets, keyed by the ID of the first
+    // layer of the bucket, the features that have vertices and where their vertices end. These
+    // are enough to evaluate changed data-driven paint properties without a layout.
+    struct BucketFeature {
+        std::size_t index;
+        std::size_t vertexEnd;
+    };
+    std::vector<Immutable<style::Layer::Impl>> laidOutLayers;
+    std::unordered_map<std::string, std::vector<BucketFeature>> bucketFeatures;
+
     bool symbolLayoutsNeedPreparation = false;
     std::vector<std::unique_ptr<SymbolLayout>> symbolLayouts;
     GlyphDependencies pendingGlyphDependencies;
     ImageDependencies pendingImageDependencies;
     GlyphMap glyphMap;
     ImageMap imageMap;
+    ImagePositions imagePositions;
+
+    // The notifications of the ImageManager with the latest images, and with the images the symbol
+    // layouts were prepared with.
+    uint64_t imageCorrelationID = 0;
+    uint64_t preparedImageCorrelationID = 0;
 };
 
 } // namespace mbgl
@@ -2,7 +2,6 @@
 #include <mbgl/tile/raster_tile.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/actor/actor.hpp>
-#include <mbgl/util/premultiply.hpp>
 
 namespace mbgl {
 
@@ -17,7 +16,7 @@ void RasterTileWorker::parse(std::shared_ptr<const std::string> data) {
     }
 
     try {
-        auto bucket = std::make_unique<RasterBucket>(util::unpremultiply(decodeImage(*data)));
+        auto bucket = std::make_unique<RasterBucket>(decodeUnassociatedImage(*data));
         parent.invoke(&RasterTile::onParsed, std::move(bucket));
     } catch (...) {
         parent.invoke(&RasterTile::onError, std::current_exception());
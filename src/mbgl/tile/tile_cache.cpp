@@ -63,4 +63,15 @@ void TileCache::clear() {
     tiles.clear();
 }
 
+void TileCache::removeIf(std::function<bool (const OverscaledTileID&)> predicate) {
+    for (auto it = orderedKeys.begin(); it != orderedKeys.end();) {
+        if (predicate(*it)) {
+            tiles.erase(*it);
+            it = orderedKeys.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 } // namespace mbgl
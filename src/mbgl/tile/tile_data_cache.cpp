@@ -0,0 +1,191 @@
+#include <mbgl/tile/tile_data_cache.hpp>
+#include <mbgl/style/filter_evaluator.hpp>
+#include <mbgl/style/conversion/stringify.hpp>
+#include <mbgl/util/rapidjson.hpp>
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <cassert>
+#include <unordered_map>
+
+namespace mbgl {
+
+namespace {
+
+std::string filterKey(const std::string& sourceLayer, const style::Filter& filter) {
+    rapidjson::StringBuffer s;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+
+    writer.StartArray();
+    writer.String(sourceLayer);
+    style::conversion::stringify(writer, filter);
+    writer.EndArray();
+
+    return s.GetString();
+}
+
+std::unique_ptr<FilteredFeatures> filterFeatures(std::unique_ptr<GeometryTileLayer> layer,
+                                                 const style::Filter& filter) {
+    auto result = std::make_unique<FilteredFeatures>();
+
+    for (std::size_t i = 0; i < layer->featureCount(); i++) {
+        std::unique_ptr<GeometryTileFeature> feature = layer->getFeature(i);
+
+        if (!filter(feature->getType(), feature->getID(), [&] (const auto& key) { return feature->getValue(key); }))
+            continue;
+
+        GeometryCollection geometries = feature->getGeometries();
+
+        result->bytes += sizeof(FilteredFeatures::Feature);
+        for (const auto& ring : geometries) {
+            result->bytes += sizeof(GeometryCoordinates) + ring.size() * sizeof(GeometryCoordinate);
+        }
+
+        result->features.push_back({ i, std::move(feature), std::move(geometries) });
+    }
+
+    result->layer = std::move(layer);
+    return result;
+}
+
+} // namespace
+
+TileDataCache::TileDataCache(std::size_t maximumSize_)
+    : maximumSize(maximumSize_) {
+}
+
+std::shared_ptr<TileDataCache> TileDataCache::get(Scheduler& scheduler) {
+    // Entries are removed along with the last client of their cache, so that the registry doesn't
+    // grow, and a scheduler that is later created at the same address gets a new cache.
+    static std::mutex registryMutex;
+    static std::unordered_map<Scheduler*, std::shared_ptr<TileDataCache>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    std::shared_ptr<TileDataCache>& cache = registry[&scheduler];
+    if (!cache) {
+        cache = std::make_shared<TileDataCache>();
+    }
+
+    // Every client gets its own pointer, so that the number of Maps holding the cache is known.
+    cache->clients++;
+    return std::shared_ptr<TileDataCache>(cache.get(), [key = &scheduler] (TileDataCache*) {
+        std::shared_ptr<TileDataCache> released;
+        {
+            std::lock_guard<std::mutex> releaseLock(registryMutex);
+            auto it = registry.find(key);
+            assert(it != registry.end());
+            if (--it->second->clients == 0) {
+                released = std::move(it->second);
+                registry.erase(it);
+            }
+        }
+        // The cache is destroyed outside of the lock.
+    });
+}
+
+bool TileDataCache::isShared() const {
+    return clients > 1;
+}
+
+std::shared_ptr<const std::string> TileDataCache::shareData(const std::string& sourceID,
+                                                           const OverscaledTileID& tileID,
+                                                           std::shared_ptr<const std::string> data) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto& existing = buffers[{ sourceID, tileID }];
+    if (auto buffer = existing.lock()) {
+        if (buffer == data || *buffer == *data) {
+            stats.sharedBuffers++;
+            return buffer;
+        }
+    }
+    existing = data;
+
+    // Drop the buffers of tiles that are no longer loaded by any Map.
+    if (buffers.size() > 2 * buffersAtLastSweep) {
+        for (auto it = buffers.begin(); it != buffers.end();) {
+            it = it->second.expired() ? buffers.erase(it) : std::next(it);
+        }
+        buffersAtLastSweep = buffers.size();
+    }
+
+    return data;
+}
+
+std::shared_ptr<const FilteredFeatures> TileDataCache::getFeatures(const GeometryTileData& data,
+                                                                   const std::string& sourceLayer,
+                                                                   const style::Filter& filter) {
+    std::shared_ptr<const std::string> buffer = data.getBuffer();
+    if (!buffer) {
+        auto layer = data.getLayer(sourceLayer);
+        return layer ? filterFeatures(std::move(layer), filter) : nullptr;
+    }
+
+    Key key { buffer.get(), filterKey(sourceLayer, filter) };
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            stats.hits++;
+            entries.splice(entries.begin(), entries, it->second);
+            return it->second->features;
+        }
+        stats.misses++;
+    }
+
+    // Decode outside of the lock. If another worker decodes the same features meanwhile, the
+    // first result to be inserted is kept.
+    auto layer = data.getLayer(sourceLayer);
+    std::shared_ptr<const FilteredFeatures> features = layer ? filterFeatures(std::move(layer), filter) : nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        return it->second->features;
+    }
+
+    const std::size_t bytes = sizeof(Entry) + key.second.size() + (features ? features->bytes : 0);
+    entries.push_front({ key, std::move(buffer), features, bytes });
+    index.emplace(std::move(key), entries.begin());
+    stats.entries++;
+    stats.bytes += bytes;
+    evict();
+
+    return features;
+}
+
+void TileDataCache::evict() {
+    while (stats.bytes > maximumSize && !entries.empty()) {
+        const Entry& entry = entries.back();
+        stats.entries--;
+        stats.bytes -= entry.bytes;
+        index.erase(entry.key);
+        entries.pop_back();
+    }
+}
+
+void TileDataCache::setMaximumSize(std::size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maximumSize = size;
+    evict();
+}
+
+TileDataCache::Stats TileDataCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void TileDataCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    buffers.clear();
+    buffersAtLastSweep = 0;
+    stats.entries = 0;
+    stats.bytes = 0;
+}
+
+} // namespace mbgl
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/style/filter.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+
+class Scheduler;
+
+// The features of a source layer that pass a filter, with their geometries already decoded.
+class FilteredFeatures {
+public:
+    class Feature {
+    public:
+        std::size_t index;
+        std::unique_ptr<GeometryTileFeature> feature;
+        GeometryCollection geometries;
+    };
+
+    // Features may not outlive the layer they were obtained from.
+    std::unique_ptr<GeometryTileLayer> layer;
+    std::vector<Feature> features;
+
+    // Estimated memory used by the decoded geometries.
+    std::size_t bytes = 0;
+};
+
+// Worker-side cache of vector tile data that is shared by all Maps using the same scheduler, e.g.
+// the map instances of a render server. Maps that load the same tile share its buffer, and the
+// features of each source layer that pass a filter are decoded only once for all of them.
+//
+// Entries are immutable and reference counted, so a worker can keep using an entry after it was
+// evicted. Buckets are still built by every Map, because they are uploaded to its own GL context.
+class TileDataCache : private util::noncopyable {
+public:
+    class Stats {
+    public:
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t sharedBuffers = 0;
+        std::size_t entries = 0;
+        std::size_t bytes = 0;
+
+        double hitRate() const {
+            return hits + misses ? double(hits) / (hits + misses) : 0;
+        }
+    };
+
+    explicit TileDataCache(std::size_t maximumSize = 64 * 1024 * 1024);
+
+    // Returns the cache for the given scheduler, creating it if necessary. Every Map holds one of
+    // the returned pointers, and the cache is destroyed along with the last of them.
+    static std::shared_ptr<TileDataCache> get(Scheduler&);
+
+    // Returns true when more than one Map holds this cache. Tiles only use the cache in that case,
+    // since a single Map keeps its own tiles around already.
+    bool isShared() const;
+
+    // Returns a buffer with the same contents as the given one, which is the buffer of another
+    // tile with the same source and ID if there is one.
+    std::shared_ptr<const std::string> shareData(const std::string& sourceID,
+                                                 const OverscaledTileID&,
+                                                 std::shared_ptr<const std::string>);
+
+    // Returns the features of the given source layer that pass the filter, or null if the tile
+    // has no such layer. Results are only cached for tile data that was decoded from a buffer.
+    std::shared_ptr<const FilteredFeatures> getFeatures(const GeometryTileData&,
+                                                        const std::string& sourceLayer,
+                                                        const style::Filter&);
+
+    void setMaximumSize(std::size_t);
+    Stats getStats() const;
+    void clear();
+
+private:
+    using Key = std::pair<const std::string*, std::string>;
+
+    class Entry {
+    public:
+        Key key;
+        std::shared_ptr<const std::string> buffer;
+        std::shared_ptr<const FilteredFeatures> features;
+        std::size_t bytes;
+    };
+
+    void evict();
+
+    mutable std::mutex mutex;
+    std::atomic<std::size_t> clients { 0 };
+    std::size_t maximumSize;
+
+    // Most recently used entries come first.
+    std::list<Entry> entries;
+    std::map<Key, std::list<Entry>::iterator> index;
+    std::map<std::pair<std::string, OverscaledTileID>, std::weak_ptr<const std::string>> buffers;
+    std::size_t buffersAtLastSweep = 0;
+
+    Stats stats;
+};
+
+} // namespace mbgl
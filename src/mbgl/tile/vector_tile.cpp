@@ -1,5 +1,6 @@
 #include <mbgl/tile/vector_tile.hpp>
 #include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
 #include <mbgl/tile/tile_loader_impl.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
 
@@ -22,6 +23,12 @@ void VectorTile::setData(std::shared_ptr<const std::string> data_,
     modified = modified_;
     expires = expires_;
 
+    // Share the buffer with the same tile in other Maps, so that the workers can reuse its decoded
+    // features.
+    if (data_ && tileDataCache.isShared()) {
+        data_ = tileDataCache.shareData(sourceID, id, std::move(data_));
+    }
+
     GeometryTile::setData(data_ ? std::make_unique<VectorTileData>(data_) : nullptr);
 }
 
@@ -82,6 +82,10 @@ std::unique_ptr<GeometryTileLayer> VectorTileData::getLayer(const std::string& n
     return nullptr;
 }
 
+std::shared_ptr<const std::string> VectorTileData::getBuffer() const {
+    return data;
+}
+
 std::vector<std::string> VectorTileData::layerNames() const {
     return mapbox::vector_tile::buffer(*data).layerNames();
 }
@@ -2,9 +2,52 @@
 
 #include <cmath>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace mbgl {
 namespace util {
 
+#if defined(__SSE2__)
+
+// Premultiplies four pixels at a time. Blocks of opaque pixels are left untouched. The result is
+// identical to the scalar computation: for x <= 255 * 255, (x + 127) / 255 equals
+// (x + 128 + ((x + 128) >> 8)) >> 8.
+static size_t premultiplySSE2(uint8_t* data, size_t bytes) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i half = _mm_set1_epi16(128);
+    const __m128i alphaMask = _mm_set1_epi32(0xFF000000);
+
+    size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        __m128i* ptr = reinterpret_cast<__m128i*>(data + i);
+        const __m128i pixels = _mm_loadu_si128(ptr);
+        const __m128i alpha = _mm_and_si128(pixels, alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(alpha, alphaMask)) == 0xFFFF) {
+            continue;
+        }
+
+        __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+        __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+
+        const __m128i alphaLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128i alphaHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+        lo = _mm_add_epi16(_mm_mullo_epi16(lo, alphaLo), half);
+        hi = _mm_add_epi16(_mm_mullo_epi16(hi, alphaHi), half);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+        const __m128i color = _mm_andnot_si128(alphaMask, _mm_packus_epi16(lo, hi));
+        _mm_storeu_si128(ptr, _mm_or_si128(color, alpha));
+    }
+
+    return i;
+}
+
+#endif // defined(__SSE2__)
+
 PremultipliedImage premultiply(UnassociatedImage&& src) {
     PremultipliedImage dst;
 
@@ -13,14 +56,21 @@ PremultipliedImage premultiply(UnassociatedImage&& src) {
     dst.data = std::move(src.data);
 
     uint8_t* data = dst.data.get();
-    for (size_t i = 0; i < dst.bytes(); i += 4) {
+#if defined(__SSE2__)
+    size_t i = premultiplySSE2(data, dst.bytes());
+#else
+    size_t i = 0;
+#endif
+    for (; i < dst.bytes(); i += 4) {
         uint8_t& r = data[i + 0];
         uint8_t& g = data[i + 1];
         uint8_t& b = data[i + 2];
         uint8_t& a = data[i + 3];
-        r = (r * a + 127) / 255;
-        g = (g * a + 127) / 255;
-        b = (b * a + 127) / 255;
+        if (a != 255) {
+            r = (r * a + 127) / 255;
+            g = (g * a + 127) / 255;
+            b = (b * a + 127) / 255;
+        }
     }
 
     return dst;
@@ -33,13 +83,14 @@ UnassociatedImage unpremultiply(PremultipliedImage&& src) {
     src.size = { 0, 0 };
     dst.data = std::move(src.data);
 
+    // Opaque pixels are unchanged, so they are skipped.
     uint8_t* data = dst.data.get();
     for (size_t i = 0; i < dst.bytes(); i += 4) {
         uint8_t& r = data[i + 0];
         uint8_t& g = data[i + 1];
         uint8_t& b = data[i + 2];
         uint8_t& a = data[i + 3];
-        if (a) {
+        if (a && a != 255) {
             r = (255 * r + (a / 2)) / a;
             g = (255 * g + (a / 2)) / a;
             b = (255 * b + (a / 2)) / a;
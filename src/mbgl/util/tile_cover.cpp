@@ -1,9 +1,13 @@
 #include <mbgl/util/tile_cover.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/interpolate.hpp>
+#include <mbgl/util/mat4.hpp>
 #include <mbgl/map/transform_state.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <tuple>
 
 namespace mbgl {
 
@@ -169,5 +173,85 @@ std::vector<UnwrappedTileID> tileCover(const TransformState& state, int32_t z) {
         z);
 }
 
+std::vector<UnwrappedTileID> tileCoverWithLOD(const TransformState& state, int32_t z, int32_t minZ, int32_t overscaledZ) {
+    assert(state.valid());
+    assert(minZ <= z && z <= overscaledZ);
+
+    mat4 projMatrix;
+    state.getProjMatrix(projMatrix);
+
+    const double cameraToCenterDistance = state.getCameraToCenterDistance();
+    const Point<double> c = TileCoordinate::fromScreenCoordinate(
+        state, 0, { state.getSize().width / 2.0, state.getSize().height / 2.0 }).p;
+
+    struct ID {
+        UnwrappedTileID id;
+        double sqDist;
+    };
+
+    std::vector<ID> t;
+
+    // Descends the quadtree of tiles, skipping tiles outside of the view frustum, until the tiles
+    // are small enough at their distance from the camera.
+    std::function<void(const UnwrappedTileID&)> visit = [&](const UnwrappedTileID& tileID) {
+        mat4 matrix;
+        state.matrixFor(matrix, tileID);
+        matrix::multiply(matrix, projMatrix, matrix);
+
+        std::array<vec4, 4> corners;
+        for (std::size_t i = 0; i < corners.size(); i++) {
+            matrix::transformMat4(corners[i], {{ double(i % 2 * util::EXTENT), double(i / 2 * util::EXTENT), 0, 1 }}, matrix);
+        }
+
+        // The tile is invisible when all of its corners are outside of the same clip plane.
+        auto outside = [&](auto predicate) {
+            return std::all_of(corners.begin(), corners.end(), predicate);
+        };
+        if (outside([](const vec4& p) { return p[0] < -p[3]; }) ||
+            outside([](const vec4& p) { return p[0] > p[3]; }) ||
+            outside([](const vec4& p) { return p[1] < -p[3]; }) ||
+            outside([](const vec4& p) { return p[1] > p[3]; }) ||
+            outside([](const vec4& p) { return p[2] < -p[3]; }) ||
+            outside([](const vec4& p) { return p[2] > p[3]; })) {
+            return;
+        }
+
+        // The clip space w coordinate is the distance to the camera, which is smallest at one of
+        // the corners. The tile needs more detail when that corner is closer than the distance at
+        // which the tile's zoom level is right, or when the tile extends behind the camera.
+        const double distance = std::min({ corners[0][3], corners[1][3], corners[2][3], corners[3][3] });
+        const int32_t tileZ = tileID.canonical.z;
+        if (tileZ < z && (tileZ < minZ || distance <= 0 ||
+                          tileZ < overscaledZ - std::log2(distance / cameraToCenterDistance))) {
+            for (const auto& child : tileID.children()) {
+                visit(child);
+            }
+            return;
+        }
+
+        const double scale = 1.0 / (1 << tileZ);
+        const double dx = (tileID.canonical.x + int64_t(tileID.wrap) * (1 << tileZ) + 0.5) * scale - c.x;
+        const double dy = (tileID.canonical.y + 0.5) * scale - c.y;
+        t.push_back({ tileID, dx * dx + dy * dy });
+    };
+
+    // Start with the copies of the world that are in view.
+    for (const auto& root : tileCover(state, 0)) {
+        visit(root);
+    }
+
+    // Sort by distance to the center of the view, then by zoom level and x/y.
+    std::sort(t.begin(), t.end(), [](const ID& a, const ID& b) {
+        return std::tie(a.sqDist, a.id) < std::tie(b.sqDist, b.id);
+    });
+
+    std::vector<UnwrappedTileID> result;
+    result.reserve(t.size());
+    for (const auto& id : t) {
+        result.push_back(id.id);
+    }
+    return result;
+}
+
 } // namespace util
 } // namespace mbgl
@@ -18,5 +18,11 @@ int32_t coveringZoomLevel(double z, SourceType type, uint16_t tileSize);
 std::vector<UnwrappedTileID> tileCover(const TransformState&, int32_t z);
 std::vector<UnwrappedTileID> tileCover(const LatLngBounds&, int32_t z);
 
+// Returns the tiles that cover the view of a pitched map. Tiles in the distance appear smaller, so
+// lower zoom levels are used for them: the zoom level drops by one whenever the distance to the
+// camera doubles, relative to the distance of the center of the view, which is shown at zoom level
+// `overscaledZ`. The tiles have zoom levels between `minZ` and `z`.
+std::vector<UnwrappedTileID> tileCoverWithLOD(const TransformState&, int32_t z, int32_t minZ, int32_t overscaledZ);
+
 } // namespace util
 } // namespace mbgl
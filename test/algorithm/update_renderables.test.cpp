@@ -1259,3 +1259,35 @@ TEST(UpdateRenderables, LoadRequiredIfIdealTileCantBeFound) {
               }),
               log);
 }
+
+TEST(UpdateRenderables, MixedZoomLevels) {
+    ActionLog log;
+    MockSource source;
+    auto getTileData = getTileDataFn(log, source.dataTiles);
+    auto createTileData = createTileDataFn(log, source.dataTiles);
+    auto retainTileData = retainTileDataFn(log);
+    auto renderTile = renderTileFn(log);
+
+    // Pitched views have ideal tiles with several zoom levels. Only the tiles with the highest
+    // zoom level are overzoomed.
+    source.zoomRange.max = 2;
+    source.idealTiles.emplace(UnwrappedTileID{ 2, 0, 0 });
+    source.idealTiles.emplace(UnwrappedTileID{ 1, 1, 1 });
+
+    auto tile_3_2_0_0 = source.createTileData(OverscaledTileID{ 3, { 2, 0, 0 } });
+    tile_3_2_0_0->renderable = true;
+    auto tile_1_1_1_1 = source.createTileData(OverscaledTileID{ 1, { 1, 1, 1 } });
+    tile_1_1_1_1->renderable = true;
+
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 3);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 1, { 1, 1, 1 } }, Found }, // distant ideal tile
+                  RetainTileDataAction{ { 1, { 1, 1, 1 } }, Resource::Necessity::Required }, //
+                  RenderTileAction{ { 1, 1, 1 }, *tile_1_1_1_1 },  //
+                  GetTileDataAction{ { 3, { 2, 0, 0 } }, Found }, // overzoomed ideal tile
+                  RetainTileDataAction{ { 3, { 2, 0, 0 } }, Resource::Necessity::Required }, //
+                  RenderTileAction{ { 2, 0, 0 }, *tile_3_2_0_0 },  //
+              }),
+              log);
+}
@@ -357,6 +357,32 @@ TEST(Annotations, QueryRenderedFeatures) {
     EXPECT_EQ(*features2[0].id, uint64_t(1));
 }
 
+TEST(Annotations, QueryRenderedFeaturesAfterUpdate) {
+    AnnotationTest test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    test.map.setLatLngZoom({ 0, 0 }, 2);
+    AnnotationID moving = test.map.addAnnotation(SymbolAnnotation { Point<double> { -30, 30 }, "default_marker" });
+    AnnotationID fixed = test.map.addAnnotation(SymbolAnnotation { Point<double> { 30, -30 }, "default_marker" });
+
+    test::render(test.map, test.view);
+
+    // Moving one annotation only regenerates the tiles around its old and new positions.
+    test.map.updateAnnotation(moving, SymbolAnnotation { Point<double> { -30, -30 }, "default_marker" });
+    test::render(test.map, test.view);
+
+    EXPECT_TRUE(test.map.queryRenderedFeatures(test.map.pixelForLatLng({ 30, -30 })).empty());
+
+    auto moved = test.map.queryRenderedFeatures(test.map.pixelForLatLng({ -30, -30 }));
+    ASSERT_EQ(moved.size(), 1u);
+    EXPECT_EQ(*moved[0].id, uint64_t(moving));
+
+    auto unchanged = test.map.queryRenderedFeatures(test.map.pixelForLatLng({ -30, 30 }));
+    ASSERT_EQ(unchanged.size(), 1u);
+    EXPECT_EQ(*unchanged[0].id, uint64_t(fixed));
+}
+
 TEST(Annotations, QueryFractionalZoomLevels) {
     AnnotationTest test;
 
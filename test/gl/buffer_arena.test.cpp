@@ -0,0 +1,96 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/buffer_arena.hpp>
+
+#include <vector>
+
+using namespace mbgl;
+
+TEST(BufferArena, Allocate) {
+    HeadlessBackend backend { test::sharedDisplay() };
+    BackendScope scope { backend };
+
+    gl::Context context;
+    gl::BufferArena arena { context, gl::BufferType::Vertex, 1024 };
+    const std::vector<uint8_t> data(2048, 0xFF);
+
+    gl::BufferRange a = arena.allocate(data.data(), 100);
+    gl::BufferRange b = arena.allocate(data.data(), 100);
+    EXPECT_EQ(a.getID(), b.getID());
+    EXPECT_EQ(0u, a.getOffset());
+    EXPECT_EQ(112u, a.getSize());
+    EXPECT_EQ(112u, b.getOffset());
+
+    auto stats = arena.getStats();
+    EXPECT_EQ(1u, stats.blocks);
+    EXPECT_EQ(2u, stats.ranges);
+    EXPECT_EQ(1024u, stats.capacity);
+    EXPECT_EQ(224u, stats.used);
+    EXPECT_EQ(1u, context.statistics.buffers);
+    EXPECT_EQ(200u, context.statistics.bufferBytesUploaded);
+
+    // Released ranges are reused.
+    a = gl::BufferRange();
+    gl::BufferRange c = arena.allocate(data.data(), 50);
+    EXPECT_EQ(b.getID(), c.getID());
+    EXPECT_EQ(0u, c.getOffset());
+
+    // Data that doesn't fit into a block gets a buffer of its own, which is deleted along with
+    // the range.
+    gl::BufferRange large = arena.allocate(data.data(), 2048);
+    EXPECT_NE(b.getID(), large.getID());
+    EXPECT_EQ(0u, large.getOffset());
+    EXPECT_EQ(2u, arena.getStats().blocks);
+    large = gl::BufferRange();
+    EXPECT_EQ(1u, arena.getStats().blocks);
+
+    gl::BufferRange dedicated = arena.allocate(data.data(), 100, true);
+    EXPECT_NE(b.getID(), dedicated.getID());
+    EXPECT_EQ(2u, arena.getStats().blocks);
+
+    // A new block is created when the others are full.
+    gl::BufferRange full = arena.allocate(data.data(), 1024);
+    EXPECT_NE(b.getID(), full.getID());
+    EXPECT_NE(dedicated.getID(), full.getID());
+    EXPECT_EQ(3u, arena.getStats().blocks);
+}
+
+TEST(BufferArena, Merge) {
+    HeadlessBackend backend { test::sharedDisplay() };
+    BackendScope scope { backend };
+
+    gl::Context context;
+    gl::BufferArena arena { context, gl::BufferType::Element, 1024 };
+    const std::vector<uint8_t> data(1024, 0xFF);
+
+    gl::BufferRange a = arena.allocate(data.data(), 256);
+    gl::BufferRange b = arena.allocate(data.data(), 256);
+    gl::BufferRange c = arena.allocate(data.data(), 256);
+    const gl::BufferID id = a.getID();
+
+    // Adjacent free ranges are merged, so that the space can be used for larger data.
+    a = gl::BufferRange();
+    b = gl::BufferRange();
+    gl::BufferRange d = arena.allocate(data.data(), 512);
+    EXPECT_EQ(id, d.getID());
+    EXPECT_EQ(0u, d.getOffset());
+
+    // The last empty block is kept for later allocations.
+    c = gl::BufferRange();
+    d = gl::BufferRange();
+    EXPECT_EQ(1u, arena.getStats().blocks);
+    EXPECT_EQ(0u, arena.getStats().ranges);
+    EXPECT_EQ(0u, arena.getStats().used);
+
+    gl::BufferRange e = arena.allocate(data.data(), 1024);
+    EXPECT_EQ(id, e.getID());
+    EXPECT_EQ(0u, e.getOffset());
+
+    e = gl::BufferRange();
+    arena.releaseEmptyBlocks();
+    EXPECT_EQ(0u, arena.getStats().blocks);
+    EXPECT_EQ(0u, context.statistics.bufferBytes);
+}
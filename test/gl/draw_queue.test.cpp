@@ -0,0 +1,38 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gl/draw_queue.hpp>
+
+#include <vector>
+
+using namespace mbgl;
+
+TEST(DrawQueue, Flush) {
+    gl::DrawQueue queue;
+    EXPECT_TRUE(queue.empty());
+
+    std::vector<int> order;
+    auto draw = [&] (int id) {
+        return [&order, id] { order.push_back(id); };
+    };
+
+    const int segments[2] = { 0, 0 };
+
+    queue.push({ 2, 1, &segments[0] }, draw(0));
+    queue.push({ 1, 2, &segments[0] }, draw(1));
+    queue.push({ 2, 1, &segments[0] }, draw(2));
+    queue.push({ 1, 1, &segments[1] }, draw(3));
+    queue.push({ 1, 1, &segments[0] }, draw(4));
+    queue.push({ 1, 1, &segments[1] }, draw(5));
+    EXPECT_FALSE(queue.empty());
+    EXPECT_TRUE(order.empty());
+
+    queue.flush();
+    EXPECT_TRUE(queue.empty());
+
+    // Draws are grouped by program, then by clipping mask and vertex data. Draws with equal keys
+    // keep their order.
+    EXPECT_EQ(std::vector<int>({ 4, 3, 5, 1, 0, 2 }), order);
+
+    queue.flush();
+    EXPECT_EQ(6u, order.size());
+}
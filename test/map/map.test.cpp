@@ -21,6 +21,10 @@
 #include <mbgl/style/layers/background_layer.hpp>
 #include <mbgl/util/color.hpp>
 
+#include <mapbox/pixelmatch.hpp>
+
+#include <algorithm>
+
 using namespace mbgl;
 using namespace mbgl::style;
 using namespace std::literals::string_literals;
@@ -61,10 +65,17 @@ public:
         }
     }
 
+    void onDidFinishRenderingFrameStats(const RenderingStats& stats) final {
+        if (renderingStatsCallback) {
+            renderingStatsCallback(stats);
+        }
+    }
+
     std::function<void()> onWillStartLoadingMapCallback;
     std::function<void()> onDidFinishLoadingMapCallback;
     std::function<void()> didFailLoadingMapCallback;
     std::function<void()> didFinishLoadingStyleCallback;
+    std::function<void(const RenderingStats&)> renderingStatsCallback;
 };
 
 struct MapTest {
@@ -243,9 +254,13 @@ TEST(Map, StyleExpired) {
     response.data = std::make_shared<std::string>(util::read_file("test/fixtures/api/empty.json"));
     response.expires = util::now() - 1h;
 
+    test.backend.didFinishLoadingStyleCallback = [&] { test.runLoop.stop(); };
     fileSource.respond(Resource::Style, response);
     EXPECT_EQ(1u, fileSource.requests.size());
 
+    // Styles are parsed on the scheduler.
+    test.runLoop.run();
+
     map.getStyle().addLayer(std::make_unique<style::BackgroundLayer>("bg"));
     EXPECT_EQ(1u, fileSource.requests.size());
 
@@ -270,9 +285,13 @@ TEST(Map, StyleExpiredWithAnnotations) {
     response.data = std::make_shared<std::string>(util::read_file("test/fixtures/api/empty.json"));
     response.expires = util::now() - 1h;
 
+    test.backend.didFinishLoadingStyleCallback = [&] { test.runLoop.stop(); };
     fileSource.respond(Resource::Style, response);
     EXPECT_EQ(1u, fileSource.requests.size());
 
+    // Styles are parsed on the scheduler.
+    test.runLoop.run();
+
     map.addAnnotation(LineAnnotation { LineString<double> {{ { 0, 0 }, { 10, 10 } }} });
     EXPECT_EQ(1u, fileSource.requests.size());
 
@@ -296,9 +315,13 @@ TEST(Map, StyleExpiredWithRender) {
     response.data = std::make_shared<std::string>(util::read_file("test/fixtures/api/empty.json"));
     response.expires = util::now() - 1h;
 
+    test.backend.didFinishLoadingStyleCallback = [&] { test.runLoop.stop(); };
     fileSource.respond(Resource::Style, response);
     EXPECT_EQ(1u, fileSource.requests.size());
 
+    // Styles are parsed on the scheduler.
+    test.runLoop.run();
+
     map.render(test.view);
     EXPECT_EQ(1u, fileSource.requests.size());
 
@@ -318,7 +341,9 @@ TEST(Map, StyleEarlyMutation) {
 
     Response response;
     response.data = std::make_shared<std::string>(util::read_file("test/fixtures/api/water.json"));
+    test.backend.didFinishLoadingStyleCallback = [&] { test.runLoop.stop(); };
     fileSource.respond(Resource::Style, response);
+    test.runLoop.run();
 
     EXPECT_EQ(0u, fileSource.requests.size());
     EXPECT_NE(nullptr, map.getStyle().getLayer("water"));
@@ -439,6 +464,111 @@ TEST(Map, WithoutVAOExtension) {
     test::checkImage("test/fixtures/map/no_vao", test::render(map, test.view), 0.002);
 }
 
+TEST(Map, DrawSorting) {
+    MapTest test;
+
+    DefaultFileSource fileSource(":memory:", "test/fixtures/api/assets");
+
+    Map map(test.backend, test.view.getSize(), 1, fileSource, test.threadPool, MapMode::Still);
+    map.getStyle().loadJSON(util::read_file("test/fixtures/api/water.json"));
+    test::render(map, test.view);
+
+    auto& context = test.backend.getContext();
+
+    context.disableDrawSorting = true;
+    context.statistics = {};
+    const PremultipliedImage unsorted = test::render(map, test.view);
+    const gl::Context::Statistics unsortedStatistics = context.statistics;
+
+    context.disableDrawSorting = false;
+    context.statistics = {};
+    const PremultipliedImage sorted = test::render(map, test.view);
+
+    // Opaque draws give the same result in any order.
+    EXPECT_TRUE(sorted == unsorted);
+    EXPECT_GT(context.statistics.drawCalls, 0u);
+    EXPECT_EQ(unsortedStatistics.drawCalls, context.statistics.drawCalls);
+    EXPECT_LE(context.statistics.stateChanges, unsortedStatistics.stateChanges);
+}
+
+TEST(Map, DataDrivenFeatureTexture) {
+    MapTest test;
+
+    auto& context = test.backend.getContext();
+
+    auto render = [&] (bool disableVertexTextures) {
+        context.disableVertexTextures = disableVertexTextures;
+        context.statistics = {};
+
+        // Buckets choose where to store their paint values when they're uploaded, so each
+        // setting needs a new map.
+        Map map(test.backend, test.view.getSize(), 1, test.fileSource, test.threadPool, MapMode::Still);
+        map.getStyle().loadJSON(util::read_file("test/fixtures/api/data_driven.json"));
+        return test::render(map, test.view);
+    };
+
+    const PremultipliedImage attributes = render(true);
+    const std::size_t attributeTextureBytes = context.statistics.textureBytesUploaded;
+
+    const PremultipliedImage texture = render(false);
+    if (context.supportsVertexTextures()) {
+        EXPECT_GT(context.statistics.textureBytesUploaded, attributeTextureBytes);
+    }
+
+    // Both ways of storing the paint values render the same image.
+    ASSERT_EQ(attributes.size, texture.size);
+    PremultipliedImage diff { texture.size };
+    EXPECT_EQ(0u, mapbox::pixelmatch(attributes.data.get(), texture.data.get(),
+                                     texture.size.width, texture.size.height,
+                                     diff.data.get(), 0.1));
+}
+
+TEST(Map, RenderingStats) {
+    MapTest test;
+
+    DefaultFileSource fileSource(":memory:", "test/fixtures/api/assets");
+
+    std::vector<RenderingStats> frames;
+    test.backend.renderingStatsCallback = [&] (const RenderingStats& stats) {
+        frames.push_back(stats);
+    };
+
+    Map map(test.backend, test.view.getSize(), 1, fileSource, test.threadPool, MapMode::Still);
+    map.getStyle().loadJSON(util::read_file("test/fixtures/api/water.json"));
+    test::render(map, test.view);
+
+    ASSERT_EQ(1u, frames.size());
+    const RenderingStats& first = frames.back();
+
+    EXPECT_GT(first.drawCalls, 0u);
+    EXPECT_GT(first.uploads.bufferBytes, 0u);
+    EXPECT_GT(first.objects.programs, 0u);
+    EXPECT_GT(first.objects.buffers, 0u);
+
+    // Still images are only rendered once all tiles are loaded.
+    EXPECT_EQ(0u, first.tiles.loading);
+    EXPECT_EQ(0u, first.tiles.parsing);
+    EXPECT_GT(first.tiles.complete, 0u);
+    EXPECT_GT(first.tiles.renderable, 0u);
+
+    EXPECT_LE(first.timings.upload + first.timings.clip + first.timings.opaque + first.timings.translucent,
+              first.timings.total);
+
+    auto water = std::find_if(first.layers.begin(), first.layers.end(), [] (const auto& layer) {
+        return layer.id == "water";
+    });
+    ASSERT_NE(first.layers.end(), water);
+    EXPECT_GT(water->drawCalls, 0u);
+    EXPECT_LE(water->drawCalls, first.drawCalls);
+
+    // The buckets were uploaded with the first frame.
+    test::render(map, test.view);
+    ASSERT_EQ(2u, frames.size());
+    EXPECT_EQ(0u, frames.back().uploads.bufferBytes);
+    EXPECT_EQ(first.drawCalls, frames.back().drawCalls);
+    EXPECT_EQ(first.objects.buffers, frames.back().objects.buffers);
+}
+
 TEST(Map, RemoveLayer) {
     MapTest test;
 
@@ -562,6 +692,65 @@ TEST(Map, DontLoadUnneededTiles) {
     }
 }
 
+TEST(Map, RenderStills) {
+    MapTest test;
+
+    // Records requests as soon as they are made, rather than when they are responded to.
+    class RecordingFileSource : public StubFileSource {
+    public:
+        std::unique_ptr<AsyncRequest> request(const Resource& resource, Callback callback) override {
+            requested.emplace(resource.url);
+            return StubFileSource::request(resource, callback);
+        }
+
+        std::unordered_set<std::string> requested;
+    } fileSource;
+
+    fileSource.tileResponse = [](const Resource&) {
+        Response res;
+        res.noContent = true;
+        return res;
+    };
+
+    Map map(test.backend, test.view.getSize(), 1, fileSource, test.threadPool, MapMode::Still);
+    map.getStyle().loadJSON(R"STYLE({
+  "sources": {
+    "a": { "type": "vector", "tiles": [ "a/{z}/{x}/{y}" ] }
+  },
+  "layers": [{
+    "id": "a",
+    "type": "fill",
+    "source": "a",
+    "source-layer": "a"
+  }]
+})STYLE");
+
+    std::vector<CameraOptions> cameras(3);
+    cameras[0].zoom = 0.0;
+    cameras[1].zoom = 1.0;
+    cameras[2].zoom = 2.0;
+
+    std::vector<std::size_t> rendered;
+    map.renderStills(test.view, cameras, [&](std::size_t index, std::exception_ptr error, Duration) {
+        EXPECT_FALSE(error);
+        EXPECT_EQ(rendered.size(), index);
+        EXPECT_TRUE(test.view.readStillImage().valid());
+        rendered.push_back(index);
+
+        // The tiles of the next camera are requested before the callback is invoked.
+        if (index == 0) {
+            EXPECT_EQ(1u, fileSource.requested.count("a/1/0/0"));
+        } else if (index == 1) {
+            EXPECT_EQ(1u, fileSource.requested.count("a/2/1/1"));
+        } else {
+            test.runLoop.stop();
+        }
+    });
+
+    test.runLoop.run();
+
+    EXPECT_EQ(std::vector<std::size_t>({ 0, 1, 2 }), rendered);
+}
 
 class MockBackend : public HeadlessBackend {
 public:
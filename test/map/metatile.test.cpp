@@ -0,0 +1,155 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_file_source.hpp>
+
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/metatile.hpp>
+#include <mbgl/map/backend_scope.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/offscreen_view.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/style/layers/background_layer.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+
+#include <cstdlib>
+#include <set>
+#include <utility>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+TEST(Metatile, Camera) {
+    Metatile metatile(2, 0, 0, 2, 16);
+    EXPECT_EQ(Size(544, 544), metatile.getSize());
+
+    // 256 pixel tiles at z2 correspond to 512 pixel tiles at z1.
+    const CameraOptions camera = metatile.getCamera();
+    EXPECT_DOUBLE_EQ(1.0, *camera.zoom);
+    EXPECT_NEAR(-90.0, camera.center->longitude(), 1e-10);
+    EXPECT_NEAR(66.51326044311186, camera.center->latitude(), 1e-10);
+}
+
+TEST(Metatile, Slice) {
+    Metatile metatile(1, 1, 0, 2, 1, 2);
+
+    PremultipliedImage image({ 12, 12 });
+    for (uint32_t i = 0; i < image.bytes(); i += 4) {
+        const uint32_t pixel = i / 4;
+        image.data[i] = pixel % 12;
+        image.data[i + 1] = pixel / 12;
+    }
+
+    const auto tiles = metatile.slice(image, 2);
+    ASSERT_EQ(4u, tiles.size());
+
+    // Tiles to the right of the world are wrapped.
+    EXPECT_EQ(1u, tiles[0].x);
+    EXPECT_EQ(0u, tiles[1].x);
+    EXPECT_EQ(1u, tiles[3].y);
+
+    for (const auto& tile : tiles) {
+        EXPECT_EQ(1, tile.z);
+        EXPECT_EQ(Size(4, 4), tile.image.size);
+    }
+
+    // Each tile starts after the buffer.
+    EXPECT_EQ(2, tiles[0].image.data[0]);
+    EXPECT_EQ(2, tiles[0].image.data[1]);
+    EXPECT_EQ(6, tiles[1].image.data[0]);
+    EXPECT_EQ(6, tiles[3].image.data[1]);
+
+    EXPECT_THROW(metatile.slice(image, 1), std::invalid_argument);
+}
+
+TEST(Metatile, SliceBottom) {
+    Metatile metatile(1, 0, 1, 2);
+    EXPECT_EQ(2u, metatile.slice(PremultipliedImage({ 512, 512 })).size());
+}
+
+TEST(Metatile, WorldSize) {
+    // A 2x2 block doesn't fit in the single tile at z0.
+    EXPECT_THROW(Metatile(0, 0, 0, 2), std::invalid_argument);
+    EXPECT_EQ(1u, Metatile(0, 0, 0, 1).slice(PremultipliedImage({ 256, 256 })).size());
+
+    // At z1, it covers the world, starting from any of its tiles, without repeating tiles.
+    for (uint32_t x = 0; x < 2; x++) {
+        for (uint32_t y = 0; y < 2; y++) {
+            const auto tiles = Metatile(1, x, y, 2).slice(PremultipliedImage({ 512, 512 }));
+            ASSERT_EQ(y == 0 ? 4u : 2u, tiles.size());
+
+            std::set<std::pair<uint32_t, uint32_t>> ids;
+            for (const auto& tile : tiles) {
+                EXPECT_LT(tile.x, 2u);
+                EXPECT_LT(tile.y, 2u);
+                ids.emplace(tile.x, tile.y);
+            }
+            EXPECT_EQ(tiles.size(), ids.size());
+        }
+    }
+
+    EXPECT_THROW(Metatile(1, 2, 0, 2), std::invalid_argument);
+    EXPECT_THROW(Metatile(1, 0, 2, 2), std::invalid_argument);
+    EXPECT_THROW(Metatile(1, 0, 0, 3), std::invalid_argument);
+}
+
+namespace {
+
+class MetatileTest {
+public:
+    MetatileTest() = default;
+
+    PremultipliedImage render(const Metatile& metatile) {
+        OffscreenView view { backend.getContext(), metatile.getSize() };
+        Map map(backend, metatile.getSize(), 1, fileSource, threadPool, MapMode::Still,
+                GLContextMode::Unique, ConstrainMode::None);
+
+        map.getStyle().loadJSON(R"STYLE({ "version": 8, "sources": {}, "layers": [] })STYLE");
+
+        auto background = std::make_unique<BackgroundLayer>("background");
+        background->setBackgroundColor(Color::white());
+        map.getStyle().addLayer(std::move(background));
+
+        auto source = std::make_unique<GeoJSONSource>("source");
+        source->setGeoJSON(Feature { Polygon<double> { {
+            { -100, -20 }, { 30, -40 }, { 80, 50 }, { -40, 70 }, { -100, -20 }
+        } } });
+        map.getStyle().addSource(std::move(source));
+
+        auto fill = std::make_unique<FillLayer>("fill", "source");
+        fill->setFillColor(Color::red());
+        map.getStyle().addLayer(std::move(fill));
+
+        map.jumpTo(metatile.getCamera());
+        return test::render(map, view);
+    }
+
+    util::RunLoop loop;
+    HeadlessBackend backend { test::sharedDisplay() };
+    BackendScope scope { backend };
+    StubFileSource fileSource;
+    ThreadPool threadPool { 4 };
+};
+
+} // namespace
+
+TEST(Metatile, MatchesSingleTiles) {
+    MetatileTest test;
+
+    const Metatile metatile(2, 1, 1, 2, 32);
+    for (auto& tile : metatile.slice(test.render(metatile))) {
+        const PremultipliedImage expected = test.render(Metatile(tile.z, tile.x, tile.y, 1));
+        ASSERT_EQ(expected.size, tile.image.size);
+
+        // Polygon edges may be rasterized slightly differently, but the tiles must be otherwise
+        // identical.
+        std::size_t different = 0;
+        for (std::size_t i = 0; i < expected.bytes(); i++) {
+            if (std::abs(expected.data[i] - tile.image.data[i]) > 16) {
+                different++;
+            }
+        }
+        EXPECT_LT(different, expected.bytes() / 100) << "tile " << tile.x << "/" << tile.y;
+    }
+}
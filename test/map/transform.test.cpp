@@ -609,3 +609,31 @@ TEST(Transform, PitchBounds) {
     transform.setPitch(60.0 * util::DEG2RAD);
     ASSERT_NEAR(transform.getState().getPitch() * util::RAD2DEG, 55.0, 1e-5);
 }
+
+TEST(Transform, TransitionDestination) {
+    Transform transform;
+    transform.resize({ 1000, 1000 });
+    transform.setLatLngZoom({ 0, 0 }, 2);
+    EXPECT_FALSE(transform.getTransitionDestination());
+
+    CameraOptions camera;
+    camera.center = LatLng { 40.7, -74.0 };
+    camera.zoom = 10.0;
+    transform.flyTo(camera, AnimationOptions(Seconds(1)));
+
+    // The destination is known when the animation starts.
+    ASSERT_TRUE(transform.getTransitionDestination());
+    const TransformState& destination = *transform.getTransitionDestination();
+    EXPECT_NEAR(10.0, destination.getZoom(), 1e-6);
+    EXPECT_NEAR(40.7, destination.getLatLng().latitude(), 1e-6);
+    EXPECT_NEAR(-74.0, destination.getLatLng().longitude(), 1e-6);
+    EXPECT_DOUBLE_EQ(2.0, transform.getZoom());
+
+    transform.updateTransitions(transform.getTransitionStart() + transform.getTransitionDuration());
+    EXPECT_FALSE(transform.getTransitionDestination());
+    EXPECT_NEAR(10.0, transform.getZoom(), 1e-6);
+
+    // Camera changes without animation have no destination.
+    transform.setZoom(5.0);
+    EXPECT_FALSE(transform.getTransitionDestination());
+}
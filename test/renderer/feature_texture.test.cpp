@@ -0,0 +1,90 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/feature_texture.hpp>
+
+using namespace mbgl;
+
+TEST(FeatureTexture, Layout) {
+    auto texture = FeatureTexture::create(2500, 3, 1024);
+    ASSERT_TRUE(bool(texture));
+    EXPECT_EQ((Size { 1024, 9 }), texture->image.size);
+
+    EXPECT_EQ((std::array<uint16_t, 2> {{ 0, 0 }}), texture->position(0));
+    EXPECT_EQ((std::array<uint16_t, 2> {{ 6, 1 }}), texture->position(1030));
+    EXPECT_EQ((std::array<uint16_t, 2> {{ 451, 2 }}), texture->position(2499));
+
+    EXPECT_EQ(0.0f, texture->row(0));
+    EXPECT_EQ(3.0f, texture->row(1));
+    EXPECT_EQ(6.0f, texture->row(2));
+}
+
+TEST(FeatureTexture, SmallerThanMaxSize) {
+    auto texture = FeatureTexture::create(10, 2, 1024);
+    ASSERT_TRUE(bool(texture));
+    EXPECT_EQ((Size { 10, 2 }), texture->image.size);
+    EXPECT_EQ(1.0f, texture->row(1));
+}
+
+TEST(FeatureTexture, TooLarge) {
+    EXPECT_FALSE(bool(FeatureTexture::create(5, 3, 4)));
+    EXPECT_TRUE(bool(FeatureTexture::create(5, 2, 4)));
+}
+
+TEST(FeatureTexture, Empty) {
+    EXPECT_FALSE(bool(FeatureTexture::create(0, 1, 1024)));
+    EXPECT_FALSE(bool(FeatureTexture::create(1, 0, 1024)));
+    EXPECT_FALSE(bool(FeatureTexture::create(1, 1, 0)));
+}
+
+TEST(FeatureTexture, Color) {
+    auto texture = FeatureTexture::create(2, 2, 1024);
+    ASSERT_TRUE(bool(texture));
+
+    texture->set(1, 1, Color { 1.0f, 0.5f, 0.0f, 1.0f });
+
+    const uint8_t* data = texture->image.data.get();
+    const uint8_t* texel = data + 1 * texture->image.stride() + 1 * 4;
+    EXPECT_EQ(255, texel[0]);
+    EXPECT_EQ(127, texel[1]);
+    EXPECT_EQ(0, texel[2]);
+    EXPECT_EQ(255, texel[3]);
+
+    // Other texels are left transparent.
+    EXPECT_EQ(0, data[0]);
+    EXPECT_EQ(0, data[3]);
+}
+
+TEST(FeatureTexture, Float) {
+    auto texture = FeatureTexture::create(3, 1, 1024);
+    ASSERT_TRUE(bool(texture));
+
+    const Range<float> range { 10.0f, 20.0f };
+    texture->set(0, 0, 15.0f, range);
+    texture->set(0, 1, 25.0f, range);
+    texture->set(0, 2, 5.0f, range);
+
+    const uint8_t* data = texture->image.data.get();
+    EXPECT_EQ(128, data[0]);
+    EXPECT_EQ(0, data[1]);
+    EXPECT_EQ(0, data[2]);
+
+    // Values outside of the range are clamped.
+    EXPECT_EQ(255, data[4]);
+    EXPECT_EQ(255, data[5]);
+    EXPECT_EQ(255, data[6]);
+    EXPECT_EQ(0, data[8]);
+    EXPECT_EQ(0, data[9]);
+    EXPECT_EQ(0, data[10]);
+}
+
+TEST(FeatureTexture, FloatEmptyRange) {
+    auto texture = FeatureTexture::create(1, 1, 1024);
+    ASSERT_TRUE(bool(texture));
+
+    texture->set(0, 0, 7.0f, Range<float> { 7.0f, 7.0f });
+
+    const uint8_t* data = texture->image.data.get();
+    EXPECT_EQ(0, data[0]);
+    EXPECT_EQ(0, data[1]);
+    EXPECT_EQ(0, data[2]);
+}
@@ -108,11 +108,15 @@ TEST(ImageManager, RemoveReleasesBinPackRect) {
 
 class StubImageRequestor : public ImageRequestor {
 public:
-    void onImagesAvailable(ImageMap images) final {
+    void onImagesAvailable(ImageMap images, ImagePositions positions_, uint64_t correlationID_) final {
+        positions = std::move(positions_);
+        correlationID = correlationID_;
         if (imagesAvailable) imagesAvailable(images);
     }
 
     std::function<void (ImageMap)> imagesAvailable;
+    ImagePositions positions;
+    uint64_t correlationID = 0;
 };
 
 TEST(ImageManager, NotifiesRequestorWhenSpriteIsLoaded) {
@@ -145,3 +149,61 @@ TEST(ImageManager, NotifiesRequestorImmediatelyIfDependenciesAreSatisfied) {
 
     ASSERT_TRUE(notified);
 }
+
+TEST(ImageManager, IconAtlas) {
+    ImageManager imageManager;
+    StubImageRequestor a;
+    StubImageRequestor b;
+
+    PremultipliedImage image({ 16, 12 });
+    image.fill(255);
+    imageManager.addImage(makeMutable<style::Image::Impl>("one", std::move(image), 1));
+    imageManager.addImage(makeMutable<style::Image::Impl>("two", PremultipliedImage({ 8, 8 }), 1));
+
+    imageManager.getImages(a, {"one", "missing"});
+    imageManager.getImages(b, {"one", "two"});
+
+    // Requestors share the icons in the atlas.
+    ASSERT_EQ(1u, a.positions.size());
+    ASSERT_EQ(2u, b.positions.size());
+    EXPECT_TRUE(a.positions.at("one").textureRect == b.positions.at("one").textureRect);
+    EXPECT_EQ(1, a.positions.at("one").tl()[0]);
+    EXPECT_EQ(1, a.positions.at("one").tl()[1]);
+    EXPECT_EQ(17, a.positions.at("one").br()[0]);
+    EXPECT_EQ(13, a.positions.at("one").br()[1]);
+
+    const PremultipliedImage& atlas = imageManager.getIconAtlasImage();
+    EXPECT_EQ(imageManager.getIconPixelSize(), atlas.size);
+    EXPECT_EQ(255, atlas.data[1 * atlas.stride() + 1 * 4]);
+    EXPECT_EQ(0, atlas.data[0]);
+}
+
+TEST(ImageManager, IconAtlasReleasesIcons) {
+    ImageManager imageManager;
+    StubImageRequestor a;
+    StubImageRequestor b;
+
+    imageManager.addImage(makeMutable<style::Image::Impl>("one", PremultipliedImage({ 16, 16 }), 1));
+    imageManager.addImage(makeMutable<style::Image::Impl>("two", PremultipliedImage({ 16, 16 }), 1));
+
+    imageManager.getImages(a, {"one"});
+    const auto one = a.positions.at("one").textureRect;
+    const uint64_t first = a.correlationID;
+
+    // Icons stay in the atlas until the notifications that reference them are released.
+    imageManager.getImages(a, {"one"});
+    imageManager.getImages(b, {"one"});
+    imageManager.releaseIcons(a, a.correlationID);
+    imageManager.removeRequestor(b);
+    EXPECT_LT(first, a.correlationID);
+
+    imageManager.getImages(b, {"two"});
+    EXPECT_FALSE(one == b.positions.at("two").textureRect);
+
+    // Once no requestor uses an icon, its space is reused.
+    StubImageRequestor c;
+    imageManager.addImage(makeMutable<style::Image::Impl>("three", PremultipliedImage({ 16, 16 }), 1));
+    imageManager.removeRequestor(a);
+    imageManager.getImages(c, {"three"});
+    EXPECT_TRUE(one == c.positions.at("three").textureRect);
+}
@@ -3,6 +3,7 @@
 
 #include <mbgl/sprite/sprite_parser.hpp>
 #include <mbgl/style/image.hpp>
+#include <mbgl/style/image_impl.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/string.hpp>
@@ -22,10 +23,10 @@ auto readImage(const std::string& name) {
 TEST(Sprite, SpriteImageCreationInvalid) {
     FixtureLog log;
 
-    const PremultipliedImage image_1x = decodeImage(util::read_file("test/fixtures/annotations/emerald.png"));
+    const auto image_1x = std::make_shared<const PremultipliedImage>(decodeImage(util::read_file("test/fixtures/annotations/emerald.png")));
 
-    ASSERT_EQ(200u, image_1x.size.width);
-    ASSERT_EQ(299u, image_1x.size.height);
+    ASSERT_EQ(200u, image_1x->size.width);
+    ASSERT_EQ(299u, image_1x->size.height);
 
     ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, 0, 0, 16, 1, false));    // width == 0
     ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, 0, 16, 0, 1, false));    // height == 0
@@ -38,8 +39,8 @@ TEST(Sprite, SpriteImageCreationInvalid) {
     ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, 0, 16, 1025, 1, false)); // too tall
     ASSERT_EQ(nullptr, createStyleImage("test", image_1x, -1, 0, 16, 16, 1, false));  // srcX < 0
     ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, -1, 16, 16, 1, false));  // srcY < 0
-    ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, 0, image_1x.size.width + 1, 16, 1, false));   // right edge out of bounds
-    ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, 0, 16, image_1x.size.height + 1, 1, false));  // bottom edge out of bounds
+    ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, 0, image_1x->size.width + 1, 16, 1, false));   // right edge out of bounds
+    ASSERT_EQ(nullptr, createStyleImage("test", image_1x, 0, 0, 16, image_1x->size.height + 1, 1, false));  // bottom edge out of bounds
 
     EXPECT_EQ(1u, log.count({
                       EventSeverity::Error,
@@ -135,10 +136,10 @@ TEST(Sprite, SpriteImageCreationInvalid) {
 }
 
 TEST(Sprite, SpriteImageCreation1x) {
-    const PremultipliedImage image_1x = decodeImage(util::read_file("test/fixtures/annotations/emerald.png"));
+    const auto image_1x = std::make_shared<const PremultipliedImage>(decodeImage(util::read_file("test/fixtures/annotations/emerald.png")));
 
-    ASSERT_EQ(200u, image_1x.size.width);
-    ASSERT_EQ(299u, image_1x.size.height);
+    ASSERT_EQ(200u, image_1x->size.width);
+    ASSERT_EQ(299u, image_1x->size.height);
 
     { // "museum_icon":{"x":177,"y":187,"width":18,"height":18,"pixelRatio":1,"sdf":false}
         const auto sprite = createStyleImage("test", image_1x, 177, 187, 18, 18, 1, false);
@@ -152,7 +153,7 @@ TEST(Sprite, SpriteImageCreation1x) {
 }
 
 TEST(Sprite, SpriteImageCreation2x) {
-    const PremultipliedImage image_2x = decodeImage(util::read_file("test/fixtures/annotations/emerald@2x.png"));
+    const auto image_2x = std::make_shared<const PremultipliedImage>(decodeImage(util::read_file("test/fixtures/annotations/emerald@2x.png")));
 
     // "museum_icon":{"x":354,"y":374,"width":36,"height":36,"pixelRatio":2,"sdf":false}
     const auto sprite = createStyleImage("test", image_2x, 354, 374, 36, 36, 2, false);
@@ -165,7 +166,7 @@ TEST(Sprite, SpriteImageCreation2x) {
 }
 
 TEST(Sprite, SpriteImageCreation1_5x) {
-    const PremultipliedImage image_2x = decodeImage(util::read_file("test/fixtures/annotations/emerald@2x.png"));
+    const auto image_2x = std::make_shared<const PremultipliedImage>(decodeImage(util::read_file("test/fixtures/annotations/emerald@2x.png")));
 
     // "museum_icon":{"x":354,"y":374,"width":36,"height":36,"pixelRatio":2,"sdf":false}
     const auto sprite = createStyleImage("test", image_2x, 354, 374, 36, 36, 1.5, false);
@@ -186,6 +187,26 @@ TEST(Sprite, SpriteImageCreation1_5x) {
               sprite2->getImage());
 }
 
+TEST(Sprite, SpriteImageView) {
+    const auto image_1x = std::make_shared<const PremultipliedImage>(decodeImage(util::read_file("test/fixtures/annotations/emerald.png")));
+
+    // "museum_icon":{"x":177,"y":187,"width":18,"height":18,"pixelRatio":1,"sdf":false}
+    const auto sprite = createStyleImage("test", image_1x, 177, 187, 18, 18, 1, false);
+    ASSERT_TRUE(sprite.get());
+    EXPECT_EQ((Size { 18, 18 }), sprite->baseImpl->size);
+
+    // Copying a region of the image reads it from the sheet.
+    PremultipliedImage copy({ 20, 20 });
+    sprite->baseImpl->copy({ 0, 0 }, copy, { 1, 1 }, { 18, 18 });
+
+    PremultipliedImage expected({ 20, 20 });
+    PremultipliedImage::copy(*image_1x, expected, { 177, 187 }, { 1, 1 }, { 18, 18 });
+    EXPECT_EQ(expected, copy);
+
+    EXPECT_EQ(readImage("test/fixtures/annotations/result-spriteimagecreation1x-museum.png"),
+              sprite->getImage());
+}
+
 TEST(Sprite, SpriteParsing) {
     const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
     const auto json_1x = util::read_file("test/fixtures/annotations/emerald.json");
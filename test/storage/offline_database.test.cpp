@@ -324,6 +324,20 @@ TEST(OfflineDatabase, GetRegionDefinition) {
     EXPECT_EQ(definition.pixelRatio, result.pixelRatio);
 }
 
+TEST(OfflineDatabase, GetRegionGlyphRangeCount) {
+    using namespace mbgl;
+
+    OfflineDatabase db(":memory:");
+    OfflineRegionDefinition definition { "http://example.com/style", LatLngBounds::hull({1, 2}, {3, 4}), 5, 6, 2.0 };
+    OfflineRegionMetadata metadata {{ 1, 2, 3 }};
+    OfflineRegion region = db.createRegion(definition, metadata);
+
+    EXPECT_FALSE(bool(db.getRegionGlyphRangeCount(region.getID())));
+
+    db.setRegionGlyphRangeCount(region.getID(), 3);
+    EXPECT_EQ(3u, *db.getRegionGlyphRangeCount(region.getID()));
+}
+
 TEST(OfflineDatabase, DeleteRegion) {
     using namespace mbgl;
 
@@ -639,19 +653,19 @@ TEST(OfflineDatabase, MigrateFromV2Schema) {
 
     // v2.db is a v2 database containing a single offline region with a small number of resources.
 
-    deleteFile("test/fixtures/offline_database/v5.db");
-    writeFile("test/fixtures/offline_database/v5.db", util::read_file("test/fixtures/offline_database/v2.db"));
+    deleteFile("test/fixtures/offline_database/v6.db");
+    writeFile("test/fixtures/offline_database/v6.db", util::read_file("test/fixtures/offline_database/v2.db"));
 
     {
-        OfflineDatabase db("test/fixtures/offline_database/v5.db", 0);
+        OfflineDatabase db("test/fixtures/offline_database/v6.db", 0);
         auto regions = db.listRegions();
         for (auto& region : regions) {
             db.deleteRegion(std::move(region));
         }
     }
 
-    EXPECT_EQ(5, databaseUserVersion("test/fixtures/offline_database/v5.db"));
-    EXPECT_LT(databasePageCount("test/fixtures/offline_database/v5.db"),
+    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/v6.db"));
+    EXPECT_LT(databasePageCount("test/fixtures/offline_database/v6.db"),
               databasePageCount("test/fixtures/offline_database/v2.db"));
 }
 
@@ -660,18 +674,18 @@ TEST(OfflineDatabase, MigrateFromV3Schema) {
 
     // v3.db is a v3 database, migrated from v2.
 
-    deleteFile("test/fixtures/offline_database/v5.db");
-    writeFile("test/fixtures/offline_database/v5.db", util::read_file("test/fixtures/offline_database/v3.db"));
+    deleteFile("test/fixtures/offline_database/v6.db");
+    writeFile("test/fixtures/offline_database/v6.db", util::read_file("test/fixtures/offline_database/v3.db"));
 
     {
-        OfflineDatabase db("test/fixtures/offline_database/v5.db", 0);
+        OfflineDatabase db("test/fixtures/offline_database/v6.db", 0);
         auto regions = db.listRegions();
         for (auto& region : regions) {
             db.deleteRegion(std::move(region));
         }
     }
 
-    EXPECT_EQ(5, databaseUserVersion("test/fixtures/offline_database/v5.db"));
+    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/v6.db"));
 }
 
 TEST(OfflineDatabase, MigrateFromV4Schema) {
@@ -679,22 +693,43 @@ TEST(OfflineDatabase, MigrateFromV4Schema) {
 
     // v4.db is a v4 database, migrated from v2 & v3. This database used `journal_mode = WAL` and `synchronous = NORMAL`.
 
-    deleteFile("test/fixtures/offline_database/v5.db");
-    writeFile("test/fixtures/offline_database/v5.db", util::read_file("test/fixtures/offline_database/v4.db"));
+    deleteFile("test/fixtures/offline_database/v6.db");
+    writeFile("test/fixtures/offline_database/v6.db", util::read_file("test/fixtures/offline_database/v4.db"));
 
     {
-        OfflineDatabase db("test/fixtures/offline_database/v5.db", 0);
+        OfflineDatabase db("test/fixtures/offline_database/v6.db", 0);
         auto regions = db.listRegions();
         for (auto& region : regions) {
             db.deleteRegion(std::move(region));
         }
     }
 
-    EXPECT_EQ(5, databaseUserVersion("test/fixtures/offline_database/v5.db"));
+    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/v6.db"));
 
     // Journal mode should be DELETE after migration to v5.
-    EXPECT_EQ("delete", databaseJournalMode("test/fixtures/offline_database/v5.db"));
+    EXPECT_EQ("delete", databaseJournalMode("test/fixtures/offline_database/v6.db"));
 
     // Synchronous setting should be FULL (2) after migration to v5.
-    EXPECT_EQ(2, databaseSyncMode("test/fixtures/offline_database/v5.db"));
+    EXPECT_EQ(2, databaseSyncMode("test/fixtures/offline_database/v6.db"));
+}
+
+TEST(OfflineDatabase, MigrateFromV5Schema) {
+    using namespace mbgl;
+
+    // v5.db is a v5 database, migrated from v2, v3 & v4. Its regions have no glyph range count.
+
+    deleteFile("test/fixtures/offline_database/v6.db");
+    writeFile("test/fixtures/offline_database/v6.db", util::read_file("test/fixtures/offline_database/v5.db"));
+
+    {
+        OfflineDatabase db("test/fixtures/offline_database/v6.db", 0);
+        auto regions = db.listRegions();
+        ASSERT_EQ(1u, regions.size());
+        EXPECT_FALSE(bool(db.getRegionGlyphRangeCount(regions[0].getID())));
+
+        db.setRegionGlyphRangeCount(regions[0].getID(), 1);
+        EXPECT_EQ(1u, *db.getRegionGlyphRangeCount(regions[0].getID()));
+    }
+
+    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/v6.db"));
 }
@@ -12,6 +12,7 @@
 
 #include <gtest/gtest.h>
 #include <iostream>
+#include <set>
 
 using namespace mbgl;
 using namespace std::literals::string_literals;
@@ -224,7 +225,8 @@ TEST(OfflineDownload, Activate) {
 
     observer->statusChangedFn = [&] (OfflineRegionStatus status) {
         if (status.complete()) {
-            EXPECT_EQ(262u, status.completedResourceCount); // 256 glyphs, 1 tile, 1 style, source, image, sprite image, and sprite json
+            EXPECT_EQ(7u, status.completedResourceCount); // 1 glyph range, 1 tile, 1 style, source, image, sprite image, and sprite json
+            EXPECT_EQ(1u, status.requiredGlyphRangeCount);
             EXPECT_EQ(test.size, status.completedResourceSize);
 
             download.setState(OfflineRegionDownloadState::Inactive);
@@ -235,6 +237,7 @@ TEST(OfflineDownload, Activate) {
             EXPECT_EQ(status.completedResourceSize, computedStatus.completedResourceSize);
             EXPECT_EQ(status.completedTileCount, computedStatus.completedTileCount);
             EXPECT_EQ(status.completedTileSize, computedStatus.completedTileSize);
+            EXPECT_EQ(status.requiredGlyphRangeCount, computedStatus.requiredGlyphRangeCount);
             EXPECT_TRUE(status.requiredResourceCountIsPrecise);
 
             test.loop.stop();
@@ -247,13 +250,164 @@ TEST(OfflineDownload, Activate) {
     test.loop.run();
 }
 
+TEST(OfflineDownload, GlyphRangesOfTiles) {
+    OfflineTest test;
+    OfflineRegion region = test.createRegion();
+    OfflineDownload download(
+        region.getID(),
+        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
+        test.db, test.fileSource);
+
+    test.fileSource.styleResponse = [&] (const Resource&) {
+        return test.response("text.style.json");
+    };
+
+    test.fileSource.tileResponse = [&] (const Resource&) {
+        return test.response("0-0-0.vector.pbf");
+    };
+
+    std::set<std::string> glyphURLs;
+    test.fileSource.glyphsResponse = [&] (const Resource& resource) {
+        glyphURLs.insert(resource.url);
+        return test.response("glyph.pbf");
+    };
+
+    auto observer = std::make_unique<MockObserver>();
+
+    observer->statusChangedFn = [&] (OfflineRegionStatus status) {
+        if (status.complete()) {
+            // Instead of the 256 ranges of both font stacks, only the ranges of the admin levels
+            // and the water labels are downloaded. The tile has no places.
+            EXPECT_EQ(2u, status.requiredGlyphRangeCount);
+            EXPECT_EQ(4u, status.completedResourceCount); // 2 glyph ranges, 1 tile, and 1 style
+            EXPECT_EQ(test.size, status.completedResourceSize);
+            EXPECT_TRUE(status.requiredResourceCountIsPrecise);
+
+            download.setState(OfflineRegionDownloadState::Inactive);
+            OfflineRegionStatus computedStatus = download.getStatus();
+            EXPECT_EQ(status.requiredResourceCount, computedStatus.requiredResourceCount);
+            EXPECT_EQ(status.requiredGlyphRangeCount, computedStatus.requiredGlyphRangeCount);
+            EXPECT_TRUE(computedStatus.requiredResourceCountIsPrecise);
+
+            test.loop.stop();
+        }
+    };
+
+    download.setObserver(std::move(observer));
+    download.setState(OfflineRegionDownloadState::Active);
+
+    test.loop.run();
+
+    EXPECT_EQ(std::set<std::string>({
+        "http://127.0.0.1:3000/Helvetica/0-255.pbf",
+        "http://127.0.0.1:3000/Helvetica/1024-1279.pbf",
+    }), glyphURLs);
+}
+
+TEST(OfflineDownload, GlyphRangesOfGeoJSON) {
+    OfflineTest test;
+    OfflineRegion region = test.createRegion();
+    OfflineDownload download(
+        region.getID(),
+        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
+        test.db, test.fileSource);
+
+    test.fileSource.styleResponse = [&] (const Resource&) {
+        return test.response("geojson_text.style.json");
+    };
+
+    std::set<std::string> glyphURLs;
+    test.fileSource.glyphsResponse = [&] (const Resource& resource) {
+        glyphURLs.insert(resource.url);
+        return test.response("glyph.pbf");
+    };
+
+    auto observer = std::make_unique<MockObserver>();
+
+    observer->statusChangedFn = [&] (OfflineRegionStatus status) {
+        if (status.complete()) {
+            // GeoJSON sources aren't read, so all ranges of their font stacks are downloaded.
+            EXPECT_EQ(256u, status.requiredGlyphRangeCount);
+            EXPECT_EQ(257u, status.completedResourceCount); // 256 glyph ranges and 1 style
+            EXPECT_TRUE(status.requiredResourceCountIsPrecise);
+
+            download.setState(OfflineRegionDownloadState::Inactive);
+            OfflineRegionStatus computedStatus = download.getStatus();
+            EXPECT_EQ(status.requiredResourceCount, computedStatus.requiredResourceCount);
+            EXPECT_EQ(status.requiredGlyphRangeCount, computedStatus.requiredGlyphRangeCount);
+            EXPECT_TRUE(computedStatus.requiredResourceCountIsPrecise);
+
+            test.loop.stop();
+        }
+    };
+
+    download.setObserver(std::move(observer));
+    download.setState(OfflineRegionDownloadState::Active);
+
+    test.loop.run();
+
+    EXPECT_EQ(256u, glyphURLs.size());
+    EXPECT_EQ(1u, glyphURLs.count("http://127.0.0.1:3000/Helvetica/1024-1279.pbf"));
+}
+
+TEST(OfflineDownload, RegionDownloadedBeforeGlyphRangeCount) {
+    // v5.db holds a complete region that was downloaded before the glyph range count was stored,
+    // with all 256 ranges of both font stacks of its style.
+    util::write_file("test/fixtures/offline_download/v6.db",
+                     util::read_file("test/fixtures/offline_download/v5.db"));
+
+    {
+        util::RunLoop loop;
+        StubFileSource fileSource;
+        OfflineDatabase db("test/fixtures/offline_download/v6.db");
+
+        std::vector<OfflineRegion> regions = db.listRegions();
+        ASSERT_EQ(1u, regions.size());
+        OfflineDownload download(
+            regions[0].getID(),
+            OfflineRegionDefinition(regions[0].getDefinition()),
+            db, fileSource);
+
+        OfflineRegionStatus legacyStatus = download.getStatus();
+        EXPECT_EQ(512u, legacyStatus.requiredGlyphRangeCount);
+        EXPECT_EQ(514u, legacyStatus.requiredResourceCount); // 512 glyph ranges, 1 tile, and 1 style
+        EXPECT_EQ(514u, legacyStatus.completedResourceCount);
+        EXPECT_TRUE(legacyStatus.requiredResourceCountIsPrecise);
+        EXPECT_TRUE(legacyStatus.complete());
+
+        // Downloading the region again only keeps the ranges that the text of its tile uses.
+        auto observer = std::make_unique<MockObserver>();
+        observer->statusChangedFn = [&] (OfflineRegionStatus status) {
+            if (status.complete()) {
+                EXPECT_EQ(2u, status.requiredGlyphRangeCount);
+                EXPECT_EQ(4u, status.completedResourceCount); // 2 glyph ranges, 1 tile, and 1 style
+                loop.stop();
+            }
+        };
+
+        download.setObserver(std::move(observer));
+        download.setState(OfflineRegionDownloadState::Active);
+
+        loop.run();
+
+        download.setState(OfflineRegionDownloadState::Inactive);
+        OfflineRegionStatus computedStatus = download.getStatus();
+        EXPECT_EQ(2u, computedStatus.requiredGlyphRangeCount);
+        EXPECT_EQ(4u, computedStatus.requiredResourceCount);
+        EXPECT_EQ(4u, computedStatus.completedResourceCount);
+        EXPECT_TRUE(computedStatus.complete());
+    }
+
+    util::deleteFile("test/fixtures/offline_download/v6.db");
+}
+
 TEST(OfflineDownload, DoesNotFloodTheFileSourceWithRequests) {
     FakeFileSource fileSource;
     OfflineTest test;
     OfflineRegion region = test.createRegion();
     OfflineDownload download(
         region.getID(),
-        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
+        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 3.0, 1.0),
         test.db, fileSource);
 
     auto observer = std::make_unique<MockObserver>();
@@ -267,6 +421,9 @@ TEST(OfflineDownload, DoesNotFloodTheFileSourceWithRequests) {
     fileSource.respond(Resource::Kind::Style, test.response("style.json"));
     test.loop.runOnce();
 
+    fileSource.respond(Resource::Kind::Source, test.response("streets.json"));
+    test.loop.runOnce();
+
     EXPECT_EQ(HTTPFileSource::maximumConcurrentRequests(), fileSource.requests.size());
 }
 
@@ -304,7 +461,8 @@ TEST(OfflineDownload, GetStatusStyleComplete) {
     EXPECT_EQ(OfflineRegionDownloadState::Inactive, status.downloadState);
     EXPECT_EQ(1u, status.completedResourceCount);
     EXPECT_EQ(test.size, status.completedResourceSize);
-    EXPECT_EQ(261u, status.requiredResourceCount);
+    EXPECT_EQ(5u, status.requiredResourceCount); // The glyphs aren't known before the tiles
+    EXPECT_EQ(0u, status.requiredGlyphRangeCount);
     EXPECT_FALSE(status.requiredResourceCountIsPrecise);
     EXPECT_FALSE(status.complete());
 }
@@ -330,8 +488,9 @@ TEST(OfflineDownload, GetStatusStyleAndSourceComplete) {
     EXPECT_EQ(OfflineRegionDownloadState::Inactive, status.downloadState);
     EXPECT_EQ(2u, status.completedResourceCount);
     EXPECT_EQ(test.size, status.completedResourceSize);
-    EXPECT_EQ(262u, status.requiredResourceCount);
-    EXPECT_TRUE(status.requiredResourceCountIsPrecise);
+    EXPECT_EQ(6u, status.requiredResourceCount); // The glyphs aren't known before the tiles
+    EXPECT_EQ(0u, status.requiredGlyphRangeCount);
+    EXPECT_FALSE(status.requiredResourceCountIsPrecise);
     EXPECT_FALSE(status.complete());
 }
 
@@ -492,6 +651,64 @@ TEST(OfflineDownload, TileCountLimitExceededWithTileResponse) {
     test.loop.run();
 }
 
+TEST(OfflineDownload, TileCountLimitExceededWithText) {
+    OfflineTest test;
+    OfflineRegion region = test.createRegion();
+    OfflineDownload download(
+        region.getID(),
+        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 3.0, 1.0),
+        test.db, test.fileSource);
+
+    test.db.setOfflineMapboxTileCountLimit(2);
+
+    test.fileSource.styleResponse = [&] (const Resource&) {
+        return test.response("mapbox_text.style.json");
+    };
+
+    test.fileSource.tileResponse = [&] (const Resource&) {
+        return test.response("0-0-0.vector.pbf");
+    };
+
+    std::set<std::string> glyphURLs;
+    test.fileSource.glyphsResponse = [&] (const Resource& resource) {
+        glyphURLs.insert(resource.url);
+        return test.response("glyph.pbf");
+    };
+
+    auto observer = std::make_unique<MockObserver>();
+    bool mapboxTileCountLimitExceededCalled = false;
+
+    observer->mapboxTileCountLimitExceededFn = [&] (uint64_t) {
+        EXPECT_FALSE(mapboxTileCountLimitExceededCalled);
+        mapboxTileCountLimitExceededCalled = true;
+    };
+
+    observer->statusChangedFn = [&] (OfflineRegionStatus status) {
+        if (status.downloadState == OfflineRegionDownloadState::Inactive) {
+            test.loop.stop();
+        }
+    };
+
+    download.setObserver(std::move(observer));
+    download.setState(OfflineRegionDownloadState::Active);
+
+    test.loop.run();
+
+    EXPECT_TRUE(mapboxTileCountLimitExceededCalled);
+
+    // The region didn't get all of its 85 tiles, but it has the glyphs of the ones it stored.
+    EXPECT_EQ(std::set<std::string>({
+        "http://127.0.0.1:3000/Helvetica/0-255.pbf",
+        "http://127.0.0.1:3000/Helvetica/1024-1279.pbf",
+    }), glyphURLs);
+
+    OfflineRegionStatus status = download.getStatus();
+    EXPECT_FALSE(status.complete());
+    EXPECT_FALSE(status.requiredResourceCountIsPrecise);
+    EXPECT_EQ(2u, status.requiredGlyphRangeCount);
+    EXPECT_LT(status.completedResourceCount, status.requiredResourceCount);
+}
+
 TEST(OfflineDownload, WithPreviouslyExistingTile) {
     OfflineTest test;
     OfflineRegion region = test.createRegion();
@@ -0,0 +1,63 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/style/conversion.hpp>
+#include <mbgl/style/conversion/geojson.hpp>
+#include <mbgl/style/conversion/json.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style::conversion;
+
+static void expectSameAsDocument(const std::string& json) {
+    Error chunkedError;
+    optional<GeoJSON> chunked = convert<GeoJSON>(json, chunkedError);
+
+    Error documentError;
+    optional<GeoJSON> document = convertJSON<GeoJSON>(json, documentError);
+
+    ASSERT_TRUE((bool) chunked) << chunkedError.message;
+    ASSERT_TRUE((bool) document) << documentError.message;
+    EXPECT_EQ(*document, *chunked);
+}
+
+TEST(GeoJSONConversion, FeatureCollection) {
+    expectSameAsDocument(R"JSON({
+        "type": "FeatureCollection",
+        "features": [
+            { "type": "Feature", "id": 1, "properties": { "name": "a \"quoted\" {name}" },
+              "geometry": { "type": "Point", "coordinates": [1, 2] } },
+            { "type": "Feature", "properties": { "nested": [[], {}, [{ "x": "]" }]] },
+              "geometry": { "type": "LineString", "coordinates": [[1, 2], [3, 4]] } }
+        ]
+    })JSON");
+}
+
+TEST(GeoJSONConversion, FeatureCollectionMemberOrder) {
+    expectSameAsDocument(R"JSON({ "features": [], "bbox": [0, 0, 1, 1], "type": "FeatureCollection" })JSON");
+    expectSameAsDocument(R"JSON({ "crs": null, "features": [
+        { "type": "Feature", "properties": {}, "geometry": { "type": "Point", "coordinates": [0, 0] } }
+    ], "type": "FeatureCollection" })JSON");
+}
+
+TEST(GeoJSONConversion, OtherTypes) {
+    expectSameAsDocument(R"JSON({ "type": "Feature", "properties": {}, "geometry": { "type": "Point", "coordinates": [0, 0] } })JSON");
+    expectSameAsDocument(R"JSON({ "type": "Point", "coordinates": [0, 0] })JSON");
+}
+
+TEST(GeoJSONConversion, Errors) {
+    Error error;
+
+    EXPECT_FALSE((bool) convert<GeoJSON>(std::string(R"JSON({ "type": "FeatureCollection", "features": [ { "type": "Feature" ] })JSON"), error));
+    EXPECT_FALSE(error.message.empty());
+
+    error = {};
+    EXPECT_FALSE((bool) convert<GeoJSON>(std::string(R"JSON({ "type": "FeatureCollection", "features": [ { "type": "Point", "coordinates": [0, 0] } ] })JSON"), error));
+    EXPECT_FALSE(error.message.empty());
+
+    error = {};
+    EXPECT_FALSE((bool) convert<GeoJSON>(std::string(R"JSON({ "type": "FeatureCollection", "features": [], "bbox": [0, ] })JSON"), error));
+    EXPECT_FALSE(error.message.empty());
+
+    error = {};
+    EXPECT_FALSE((bool) convert<GeoJSON>(std::string(R"JSON({ "type": "FeatureCollection", "features": [] } trailing)JSON"), error));
+    EXPECT_FALSE(error.message.empty());
+}
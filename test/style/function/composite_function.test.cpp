@@ -69,3 +69,22 @@ TEST(CompositeFunction, Issue8460) {
     EXPECT_NEAR(600.0f, fn2.evaluate(18.0f, oneInteger, -1.0f), 0.00);
     EXPECT_NEAR(600.0f, fn2.evaluate(19.0f, oneInteger, -1.0f), 0.00);
 }
+
+TEST(CompositeFunction, CoveringRanges) {
+    CompositeFunction<float> function("property", CompositeExponentialStops<float>({
+        {0.0f, {{uint64_t(1), 24.0f}}},
+        {1.5f, {{uint64_t(1), 36.0f}}},
+        {3.0f, {{uint64_t(1), 48.0f}}}
+    }), 0.0f);
+
+    auto ranges = function.rangeOfCoveringRanges({ 1.0f, 2.0f });
+    EXPECT_EQ(0.0f, ranges.min.coveringZoomRange.min);
+    EXPECT_EQ(1.5f, ranges.min.coveringZoomRange.max);
+    EXPECT_EQ(1.5f, ranges.max.coveringZoomRange.min);
+    EXPECT_EQ(3.0f, ranges.max.coveringZoomRange.max);
+
+    // Partial evaluation gives the same results as evaluating at each zoom level.
+    Range<float> result = function.evaluate(ranges, oneInteger, -1.0f);
+    EXPECT_EQ(function.evaluate(1.0f, oneInteger, -1.0f), result.min);
+    EXPECT_EQ(function.evaluate(2.0f, oneInteger, -1.0f), result.max);
+}
@@ -0,0 +1,60 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/style/function/evaluation_cache.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+using namespace std::string_literals;
+
+TEST(EvaluationCache, EvaluatesEachValueOnce) {
+    EvaluationCache<float> cache;
+    int evaluations = 0;
+    auto evaluate = [&] (float result) {
+        return [&evaluations, result] {
+            evaluations++;
+            return result;
+        };
+    };
+
+    EXPECT_EQ(1.0f, cache.get(Value("a"s), evaluate(1.0f)));
+    EXPECT_EQ(1.0f, cache.get(Value("a"s), evaluate(2.0f)));
+    EXPECT_EQ(1, evaluations);
+
+    // Values of different types are different keys.
+    EXPECT_EQ(3.0f, cache.get(Value(uint64_t(1)), evaluate(3.0f)));
+    EXPECT_EQ(4.0f, cache.get(Value(int64_t(1)), evaluate(4.0f)));
+    EXPECT_EQ(5.0f, cache.get(Value(1.0), evaluate(5.0f)));
+    EXPECT_EQ(6.0f, cache.get(Value(true), evaluate(6.0f)));
+    EXPECT_EQ(7.0f, cache.get(Value(NullValue()), evaluate(7.0f)));
+    EXPECT_EQ(8.0f, cache.get(optional<Value>(), evaluate(8.0f)));
+    EXPECT_EQ(7, evaluations);
+    EXPECT_EQ(7u, cache.size());
+
+    EXPECT_EQ(3.0f, cache.get(Value(uint64_t(1)), evaluate(0.0f)));
+    EXPECT_EQ(8.0f, cache.get(optional<Value>(), evaluate(0.0f)));
+    EXPECT_EQ(7, evaluations);
+}
+
+TEST(EvaluationCache, SkipsArraysAndObjects) {
+    EvaluationCache<float> cache;
+    int evaluations = 0;
+    auto evaluate = [&] {
+        evaluations++;
+        return 1.0f;
+    };
+
+    cache.get(Value(std::vector<Value>{ uint64_t(1) }), evaluate);
+    cache.get(Value(std::vector<Value>{ uint64_t(1) }), evaluate);
+    cache.get(Value(std::unordered_map<std::string, Value>()), evaluate);
+    EXPECT_EQ(3, evaluations);
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST(EvaluationCache, MaxSize) {
+    EvaluationCache<float> cache;
+    for (uint64_t i = 0; i < EvaluationCache<float>::maxSize * 2; i++) {
+        EXPECT_EQ(float(i), cache.get(Value(i), [&] { return float(i); }));
+    }
+    EXPECT_EQ(EvaluationCache<float>::maxSize, cache.size());
+}
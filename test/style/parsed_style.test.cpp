@@ -0,0 +1,86 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/style/parsed_style.hpp>
+#include <mbgl/style/layer_impl.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <limits>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+TEST(ParsedStyle, Cache) {
+    const std::string json = util::read_file("test/fixtures/api/water.json");
+
+    auto first = ParsedStyle::parse(json);
+    auto second = ParsedStyle::parse(std::string(json));
+    EXPECT_FALSE(first->error);
+    EXPECT_EQ(first, second);
+
+    auto other = ParsedStyle::parse(util::read_file("test/fixtures/api/empty.json"));
+    EXPECT_NE(first, other);
+}
+
+TEST(ParsedStyle, Error) {
+    auto style = ParsedStyle::parse("invalid");
+    EXPECT_TRUE(bool(style->error));
+    EXPECT_TRUE(style->createSources().empty());
+    EXPECT_TRUE(style->createLayers().empty());
+}
+
+TEST(ParsedStyle, CreateLayers) {
+    auto style = ParsedStyle::parse(util::read_file("test/fixtures/api/water.json"));
+
+    auto first = style->createLayers();
+    auto second = style->createLayers();
+    ASSERT_EQ(2u, first.size());
+    ASSERT_EQ(2u, second.size());
+    EXPECT_EQ("water", first[1]->getID());
+
+    // Layers share their implementation until they are changed.
+    EXPECT_EQ(first[1]->baseImpl.get(), second[1]->baseImpl.get());
+    first[1]->setMinZoom(5);
+    EXPECT_NE(first[1]->baseImpl.get(), second[1]->baseImpl.get());
+    EXPECT_EQ(5, first[1]->getMinZoom());
+    EXPECT_EQ(-std::numeric_limits<float>::infinity(), second[1]->getMinZoom());
+}
+
+TEST(ParsedStyle, CreateSources) {
+    auto style = ParsedStyle::parse(util::read_file("test/fixtures/api/water.json"));
+
+    auto first = style->createSources();
+    auto second = style->createSources();
+    ASSERT_EQ(1u, first.size());
+    ASSERT_EQ(1u, second.size());
+    EXPECT_NE(first[0].get(), second[0].get());
+    EXPECT_EQ(first[0]->getID(), second[0]->getID());
+}
+
+TEST(ParsedStyle, ParseSources) {
+    const std::string json = util::read_file("test/fixtures/api/data_driven.json");
+
+    // Sources are handed to every caller, whether the style was parsed or cached.
+    std::vector<std::unique_ptr<Source>> first;
+    auto style = ParsedStyle::parse(json, first);
+    std::vector<std::unique_ptr<Source>> second;
+    EXPECT_EQ(style, ParsedStyle::parse(json, second));
+
+    ASSERT_EQ(2u, first.size());
+    ASSERT_EQ(2u, second.size());
+    EXPECT_NE(first[0].get(), second[0].get());
+    EXPECT_EQ(first[0]->getID(), second[0]->getID());
+}
+
+TEST(ParsedStyle, SourceDescriptions) {
+    auto style = ParsedStyle::parse(util::read_file("test/fixtures/api/water.json"));
+
+    ASSERT_EQ(1u, style->sourceDescriptions.size());
+    const SourceDescription& source = style->sourceDescriptions[0];
+    EXPECT_EQ("mapbox", source.id);
+    EXPECT_EQ(SourceType::Vector, source.type);
+    ASSERT_TRUE(bool(source.urlOrTileset));
+    ASSERT_TRUE(source.urlOrTileset->is<Tileset>());
+    EXPECT_EQ(std::vector<std::string>{ "asset://streets/{z}-{x}-{y}.vector.pbf" },
+              source.urlOrTileset->get<Tileset>().tiles);
+    EXPECT_FALSE(bool(source.url));
+}
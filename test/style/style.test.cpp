@@ -4,11 +4,14 @@
 
 #include <mbgl/style/style_impl.hpp>
 #include <mbgl/style/source_impl.hpp>
+#include <mbgl/style/sources/raster_source.hpp>
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/layer.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
 #include <mbgl/style/layers/line_layer.hpp>
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/tileset.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
 
 #include <memory>
@@ -99,3 +102,48 @@ TEST(Style, RemoveSourceInUse) {
 
     EXPECT_EQ(log->count(logMessage), 1u);
 }
+
+TEST(Style, ReloadKeepsUnchangedSources) {
+    util::RunLoop loop;
+
+    ThreadPool threadPool{ 1 };
+    StubFileSource fileSource;
+    Style::Impl style { threadPool, fileSource, 1.0 };
+
+    const auto makeStyle = [] (const std::string& color, const std::string& rasterURL) {
+        return R"STYLE({
+            "version": 8,
+            "sources": {
+                "vector": { "type": "vector", "tiles": ["http://example.com/{z}-{x}-{y}.pbf"] },
+                "raster": { "type": "raster", "tiles": [")STYLE" + rasterURL + R"STYLE("] }
+            },
+            "layers": [{
+                "id": "water",
+                "type": "fill",
+                "source": "vector",
+                "source-layer": "water",
+                "paint": { "fill-color": ")STYLE" + color + R"STYLE(" }
+            }]
+        })STYLE";
+    };
+
+    style.loadJSON(makeStyle("blue", "http://example.com/{z}-{x}-{y}.png"));
+    Source* vector = style.getSource("vector");
+    ASSERT_NE(nullptr, vector);
+    ASSERT_NE(nullptr, style.getSource("raster"));
+
+    // Only the changed source is replaced.
+    style.loadJSON(makeStyle("red", "http://example.com/{z}/{x}/{y}.png"));
+    EXPECT_EQ(vector, style.getSource("vector"));
+    ASSERT_NE(nullptr, style.getSource("raster"));
+    EXPECT_EQ("http://example.com/{z}/{x}/{y}.png",
+              style.getSource("raster")->as<RasterSource>()->getURLOrTileset().get<Tileset>().tiles.at(0));
+    EXPECT_EQ(DataDrivenPropertyValue<Color>(Color::red()), style.getLayer("water")->as<FillLayer>()->getFillColor());
+
+    // Styles that were changed are loaded again from scratch.
+    style.addLayer(std::make_unique<LineLayer>("line", "vector"));
+    style.mutated = true;
+    style.loadJSON(makeStyle("red", "http://example.com/{z}/{x}/{y}.png"));
+    EXPECT_EQ(nullptr, style.getLayer("line"));
+    EXPECT_NE(nullptr, style.getSource("vector"));
+}
@@ -291,3 +291,38 @@ TEST(Layer, DuplicateLayer) {
     }
 }
 
+
+TEST(Layer, DataDrivenPaintDifference) {
+    auto layer = std::make_unique<FillLayer>("fill", "source");
+    const Immutable<Layer::Impl> constant = layer->baseImpl;
+
+    layer->setFillColor(SourceFunction<Color>("a", IdentityStops<Color>()));
+    const Immutable<Layer::Impl> a = layer->baseImpl;
+    EXPECT_TRUE(constant->hasDataDrivenPaintDifference(*a));
+    EXPECT_FALSE(constant->hasLayoutDifference(*a));
+
+    layer->setFillColor(SourceFunction<Color>("b", IdentityStops<Color>()));
+    const Immutable<Layer::Impl> b = layer->baseImpl;
+    EXPECT_TRUE(a->hasDataDrivenPaintDifference(*b));
+    EXPECT_FALSE(a->hasLayoutDifference(*b));
+
+    layer->setFillOpacity(opacity);
+    const Immutable<Layer::Impl> opaque = layer->baseImpl;
+    EXPECT_FALSE(b->hasDataDrivenPaintDifference(*opaque));
+    EXPECT_FALSE(b->hasLayoutDifference(*opaque));
+
+    layer->setVisibility(VisibilityType::None);
+    const Immutable<Layer::Impl> hidden = layer->baseImpl;
+    EXPECT_FALSE(opaque->hasDataDrivenPaintDifference(*hidden));
+    EXPECT_TRUE(opaque->hasLayoutDifference(*hidden));
+}
+
+TEST(Layer, SymbolDataDrivenPaintDifference) {
+    auto layer = std::make_unique<SymbolLayer>("symbol", "source");
+    const Immutable<Layer::Impl> constant = layer->baseImpl;
+
+    // Symbol buckets get their paint values during layout.
+    layer->setIconOpacity(SourceFunction<float>("a", IdentityStops<float>()));
+    EXPECT_TRUE(constant->hasLayoutDifference(*layer->baseImpl));
+    EXPECT_FALSE(constant->hasDataDrivenPaintDifference(*layer->baseImpl));
+}
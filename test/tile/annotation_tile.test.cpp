@@ -14,6 +14,7 @@
 #include <mbgl/annotation/annotation_tile.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
 #include <mbgl/map/backend_scope.hpp>
 #include <mbgl/gl/headless_backend.hpp>
 
@@ -33,6 +34,7 @@ public:
     RenderStyle style { threadPool, fileSource };
     ImageManager imageManager;
     GlyphManager glyphManager { fileSource };
+    TileDataCache tileDataCache;
 
     TileParameters tileParameters {
         1.0,
@@ -43,7 +45,11 @@ public:
         MapMode::Continuous,
         annotationManager,
         imageManager,
-        glyphManager
+        glyphManager,
+        tileDataCache,
+        {},
+        0,
+        0
     };
 };
 
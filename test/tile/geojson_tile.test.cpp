@@ -8,12 +8,16 @@
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/map/transform.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/renderer/buckets/circle_bucket.hpp>
 #include <mbgl/style/layers/circle_layer.hpp>
+#include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
 
 #include <memory>
+#include <set>
 
 using namespace mbgl;
 using namespace mbgl::style;
@@ -27,6 +31,7 @@ public:
     AnnotationManager annotationManager;
     ImageManager imageManager;
     GlyphManager glyphManager { fileSource };
+    TileDataCache tileDataCache;
     Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
 
     TileParameters tileParameters {
@@ -38,7 +43,11 @@ public:
         MapMode::Continuous,
         annotationManager,
         imageManager,
-        glyphManager
+        glyphManager,
+        tileDataCache,
+        {},
+        0,
+        0
     };
 };
 
@@ -47,12 +56,11 @@ TEST(GeoJSONTile, Issue7648) {
 
     CircleLayer layer("circle", "source");
 
-    mapbox::geometry::feature_collection<int16_t> features;
-    features.push_back(mapbox::geometry::feature<int16_t> {
-        mapbox::geometry::point<int16_t>(0, 0)
-    });
+    GeoJSONSource source("source");
+    source.setGeoJSON(FeatureCollection { Feature { Point<double>(0, 0) } });
+    auto data = source.impl().getData();
 
-    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, features);
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, data);
 
     StubTileObserver observer;
     observer.tileChanged = [&] (const Tile&) {
@@ -69,8 +77,178 @@ TEST(GeoJSONTile, Issue7648) {
         test.loop.runOnce();
     }
 
-    tile.updateData(features);
+    tile.updateData(data);
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+}
+
+TEST(GeoJSONTile, StaleRepaint) {
+    GeoJSONTileTest test;
+
+    CircleLayer layer("circle", "source");
+
+    GeoJSONSource source("source");
+    source.setGeoJSON(FeatureCollection { Feature { Point<double>(0, 0) } });
+
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, source.impl().getData());
+    tile.setLayers({{ layer.baseImpl }});
+    tile.setPlacementConfig({});
+
     while (!tile.isComplete()) {
         test.loop.runOnce();
     }
+
+    StubTileObserver observer;
+    bool changed = false;
+    observer.tileChanged = [&] (const Tile&) {
+        changed = true;
+    };
+    tile.setObserver(&observer);
+
+    // Paint property binders from before the last layers were set are dropped.
+    tile.onRepaint({ {}, 0 });
+    EXPECT_FALSE(changed);
+}
+
+TEST(GeoJSONTile, SharedTileCache) {
+    GeoJSONSource source("source");
+    source.setGeoJSON(FeatureCollection { Feature { Polygon<double> {
+        { { -10, -10 }, { 10, -10 }, { 10, 10 }, { -10, 10 }, { -10, -10 } }
+    } } });
+    auto data = source.impl().getData();
+
+    // Tiles are generated once and shared between requests.
+    auto tile = data->getTile(CanonicalTileID(0, 0, 0));
+    ASSERT_EQ(1u, tile->size());
+    EXPECT_EQ(tile, data->getTile(CanonicalTileID(0, 0, 0)));
+
+    // Polygons are fixed up when the tile is generated.
+    EXPECT_TRUE(tile->front().geometry.is<mapbox::geometry::multi_polygon<int16_t>>());
+}
+
+TEST(GeoJSONTile, IncrementalUpdate) {
+    GeoJSONSource source("source");
+    source.setGeoJSON(FeatureCollection {
+        Feature { Point<double>(-100, 40), {}, { uint64_t(1) } },
+        Feature { Point<double>(100, 40), {}, { uint64_t(2) } }
+    });
+    auto previous = source.impl().getData();
+
+    // Until the data has been loaded, the bounds of its features aren't known, so an update
+    // invalidates every tile.
+    source.updateFeatures(FeatureCollection {
+        Feature { Point<double>(-101, 40), {}, { uint64_t(1) } }
+    });
+    EXPECT_TRUE(source.impl().invalidates(previous, CanonicalTileID(2, 3, 1)));
+
+    source.setGeoJSON(FeatureCollection {
+        Feature { Point<double>(-100, 40), {}, { uint64_t(1) } },
+        Feature { Point<double>(100, 40), {}, { uint64_t(2) } }
+    });
+    previous = source.impl().getData();
+    ASSERT_EQ(2u, previous->getTile(CanonicalTileID(0, 0, 0))->size());
+
+    source.updateFeatures(FeatureCollection {
+        Feature { Point<double>(-101, 40), {}, { uint64_t(1) } }
+    });
+    ASSERT_EQ(2u, source.impl().getData()->getTile(CanonicalTileID(0, 0, 0))->size());
+
+    // Only tiles intersecting the old or new location of the feature are invalidated.
+    EXPECT_TRUE(source.impl().invalidates(previous, CanonicalTileID(0, 0, 0)));
+    EXPECT_TRUE(source.impl().invalidates(previous, CanonicalTileID(2, 0, 1)));
+    EXPECT_FALSE(source.impl().invalidates(previous, CanonicalTileID(2, 3, 1)));
+    EXPECT_FALSE(source.impl().invalidates(previous, CanonicalTileID(2, 0, 3)));
+
+    // Tiles generated from any other data are always invalidated.
+    EXPECT_TRUE(source.impl().invalidates(source.impl().getData(), CanonicalTileID(2, 3, 1)));
+
+    previous = source.impl().getData();
+    source.removeFeatures({ uint64_t(2) });
+    auto tile = source.impl().getData()->getTile(CanonicalTileID(0, 0, 0));
+    ASSERT_EQ(1u, tile->size());
+    EXPECT_EQ(FeatureIdentifier(uint64_t(1)), *tile->front().id);
+    EXPECT_TRUE(source.impl().invalidates(previous, CanonicalTileID(2, 3, 1)));
+    EXPECT_FALSE(source.impl().invalidates(previous, CanonicalTileID(2, 0, 1)));
+
+    // A feature that was updated before is replaced again.
+    previous = source.impl().getData();
+    source.updateFeatures(FeatureCollection {
+        Feature { Point<double>(-100, 40), {}, { uint64_t(1) } }
+    });
+    EXPECT_EQ(1u, source.impl().getData()->getTile(CanonicalTileID(0, 0, 0))->size());
+    EXPECT_TRUE(source.impl().invalidates(previous, CanonicalTileID(2, 0, 1)));
+    EXPECT_FALSE(source.impl().invalidates(previous, CanonicalTileID(2, 3, 1)));
+}
+
+TEST(GeoJSONTile, IncrementalUpdateFolding) {
+    GeoJSONSource source("source");
+    source.setGeoJSON(FeatureCollection {
+        Feature { Point<double>(-100, 40), {}, { uint64_t(0) } },
+        Feature { Point<double>(100, 40), {}, { uint64_t(1) } }
+    });
+
+    // Many changes are folded into new base data, which keeps both the features that were
+    // changed earlier and those that were never changed.
+    for (uint64_t id = 1; id <= 1000; id++) {
+        source.updateFeatures(FeatureCollection {
+            Feature { Point<double>(100, 40 - id * 0.01), {}, { id } }
+        });
+        source.impl().getData()->getTile(CanonicalTileID(0, 0, 0));
+    }
+    source.removeFeatures({ uint64_t(500) });
+
+    auto tile = source.impl().getData()->getTile(CanonicalTileID(0, 0, 0));
+    ASSERT_EQ(1000u, tile->size());
+    std::set<FeatureIdentifier> ids;
+    for (const auto& feature : *tile) {
+        ids.insert(*feature.id);
+    }
+    EXPECT_EQ(1000u, ids.size());
+    EXPECT_EQ(1u, ids.count(uint64_t(0)));
+    EXPECT_EQ(0u, ids.count(uint64_t(500)));
+
+    // Features without an identifier couldn't be replaced or removed later.
+    EXPECT_THROW(source.updateFeatures(FeatureCollection { Feature { Point<double>(0, 0) } }),
+                 std::runtime_error);
+}
+
+TEST(GeoJSONTile, DataDrivenPaintChange) {
+    GeoJSONTileTest test;
+
+    CircleLayer layer("circle", "source");
+    layer.setCircleRadius(SourceFunction<float>("radius", IdentityStops<float>()));
+
+    GeoJSONSource source("source");
+    source.setGeoJSON(FeatureCollection {
+        Feature { Point<double>(0, 0), PropertyMap { { "radius", 2.0 }, { "size", 4.0 } } }
+    });
+    auto data = source.impl().getData();
+
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, data);
+
+    StubTileObserver observer;
+    tile.setObserver(&observer);
+    tile.setLayers({{ layer.baseImpl }});
+    tile.setPlacementConfig({});
+
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    Bucket* bucket = tile.getBucket(*layer.baseImpl);
+    ASSERT_NE(nullptr, bucket);
+
+    // Changing a data-driven paint property keeps the bucket that was laid out, and only
+    // replaces its paint property binders.
+    layer.setCircleRadius(SourceFunction<float>("size", IdentityStops<float>()));
+    tile.setLayers({{ layer.baseImpl }});
+
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    EXPECT_EQ(bucket, tile.getBucket(*layer.baseImpl));
+    EXPECT_EQ(4.0f, *static_cast<CircleBucket*>(bucket)->paintPropertyBinders.at("circle")
+        .statistics<CircleRadius>().max());
 }
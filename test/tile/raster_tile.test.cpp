@@ -11,6 +11,7 @@
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
 
 using namespace mbgl;
 
@@ -23,6 +24,7 @@ public:
     AnnotationManager annotationManager;
     ImageManager imageManager;
     GlyphManager glyphManager { fileSource };
+    TileDataCache tileDataCache;
     Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
 
     TileParameters tileParameters {
@@ -34,7 +36,11 @@ public:
         MapMode::Continuous,
         annotationManager,
         imageManager,
-        glyphManager
+        glyphManager,
+        tileDataCache,
+        {},
+        0,
+        0
     };
 };
 
@@ -0,0 +1,106 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <memory>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+std::shared_ptr<const std::string> readTile() {
+    return std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf"));
+}
+
+} // namespace
+
+TEST(TileDataCache, Shared) {
+    ThreadPool threadPool { 1 };
+    ThreadPool otherThreadPool { 1 };
+
+    auto a = TileDataCache::get(threadPool);
+    EXPECT_FALSE(a->isShared());
+
+    auto b = TileDataCache::get(threadPool);
+    EXPECT_EQ(a.get(), b.get());
+    EXPECT_TRUE(a->isShared());
+
+    auto c = TileDataCache::get(otherThreadPool);
+    EXPECT_NE(a.get(), c.get());
+    EXPECT_FALSE(c->isShared());
+
+    b.reset();
+    EXPECT_FALSE(a->isShared());
+}
+
+TEST(TileDataCache, ShareData) {
+    TileDataCache cache;
+    const OverscaledTileID tileID { 10, 163, 395 };
+
+    auto first = cache.shareData("source", tileID, readTile());
+    auto second = cache.shareData("source", tileID, readTile());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1u, cache.getStats().sharedBuffers);
+
+    // Buffers are only shared by tiles with the same source and ID.
+    EXPECT_NE(first, cache.shareData("other", tileID, readTile()));
+    EXPECT_NE(first, cache.shareData("source", OverscaledTileID { 11, 10, 163, 395 }, readTile()));
+
+    // Changed tiles replace the buffer.
+    auto changed = cache.shareData("source", tileID, std::make_shared<std::string>("changed"));
+    EXPECT_NE(first, changed);
+    EXPECT_EQ(changed, cache.shareData("source", tileID, std::make_shared<std::string>("changed")));
+}
+
+TEST(TileDataCache, Features) {
+    TileDataCache cache;
+    auto buffer = readTile();
+
+    auto all = cache.getFeatures(VectorTileData(buffer), "landcover", NullFilter());
+    ASSERT_TRUE(all);
+    EXPECT_EQ(344u, all->features.size());
+    EXPECT_EQ(0u, cache.getStats().hits);
+    EXPECT_EQ(1u, cache.getStats().misses);
+
+    // Other tile data objects with the same buffer share the decoded features.
+    EXPECT_EQ(all, cache.getFeatures(VectorTileData(buffer), "landcover", NullFilter()));
+    EXPECT_EQ(1u, cache.getStats().hits);
+    EXPECT_EQ(0.5, cache.getStats().hitRate());
+
+    auto filtered = cache.getFeatures(VectorTileData(buffer), "landcover", EqualsFilter { "class", std::string("wood") });
+    ASSERT_TRUE(filtered);
+    EXPECT_NE(all, filtered);
+    EXPECT_EQ(79u, filtered->features.size());
+    for (const auto& feature : filtered->features) {
+        EXPECT_EQ(Value(std::string("wood")), *feature.feature->getValue("class"));
+        EXPECT_FALSE(feature.geometries.empty());
+    }
+
+    EXPECT_FALSE(cache.getFeatures(VectorTileData(buffer), "missing", NullFilter()));
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(3u, stats.entries);
+    EXPECT_LT(all->bytes + filtered->bytes, stats.bytes);
+}
+
+TEST(TileDataCache, Evict) {
+    TileDataCache cache;
+    auto buffer = readTile();
+
+    auto features = cache.getFeatures(VectorTileData(buffer), "road", NullFilter());
+    ASSERT_TRUE(features);
+    EXPECT_EQ(1u, cache.getStats().entries);
+
+    cache.setMaximumSize(0);
+    EXPECT_EQ(0u, cache.getStats().entries);
+    EXPECT_EQ(0u, cache.getStats().bytes);
+
+    // Evicted entries remain valid while they are in use.
+    EXPECT_EQ(28u, features->features.size());
+    EXPECT_FALSE(features->features[0].geometries.empty());
+    EXPECT_NE(features, cache.getFeatures(VectorTileData(buffer), "road", NullFilter()));
+}
@@ -15,6 +15,7 @@
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/tile_data_cache.hpp>
 
 #include <memory>
 
@@ -29,6 +30,7 @@ public:
     AnnotationManager annotationManager;
     ImageManager imageManager;
     GlyphManager glyphManager { fileSource };
+    TileDataCache tileDataCache;
     Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
 
     TileParameters tileParameters {
@@ -40,7 +42,11 @@ public:
         MapMode::Continuous,
         annotationManager,
         imageManager,
-        glyphManager
+        glyphManager,
+        tileDataCache,
+        {},
+        0,
+        0
     };
 };
 
@@ -34,6 +34,87 @@ TEST(Image, PNGRoundTripAlpha) {
     EXPECT_EQ(128, image.data[3]);
 }
 
+namespace {
+
+// A premultiplied gradient with 64 * 64 distinct colors and varying alpha.
+PremultipliedImage gradient(Size size) {
+    UnassociatedImage image(size);
+    for (uint32_t y = 0; y < size.height; y++) {
+        for (uint32_t x = 0; x < size.width; x++) {
+            uint8_t* pixel = image.data.get() + (y * size.width + x) * 4;
+            pixel[0] = (x % 64) * 4;
+            pixel[1] = (y % 64) * 4;
+            pixel[2] = 128;
+            pixel[3] = x < size.width / 2 ? 255 : 128 + y % 128;
+        }
+    }
+    return util::premultiply(std::move(image));
+}
+
+} // namespace
+
+TEST(Image, PNGRoundTripFiltered) {
+    const PremultipliedImage rgba = gradient({ 64, 64 });
+
+    // Encoding unpremultiplies, so the result matches an unpremultiply/premultiply round trip.
+    const PremultipliedImage expected = util::premultiply(util::unpremultiply(rgba.clone()));
+    EXPECT_EQ(expected, decodeImage(encodePNG(rgba)));
+}
+
+TEST(Image, PNGRoundTripThreads) {
+    // Large enough to be compressed in several bands.
+    const PremultipliedImage rgba = gradient({ 512, 1024 });
+
+    PNGOptions options;
+    options.threads = 4;
+    EXPECT_EQ(decodeImage(encodePNG(rgba)), decodeImage(encodePNG(rgba, options)));
+}
+
+TEST(Image, PNGQuantizeExact) {
+    PremultipliedImage rgba({ 16, 16 });
+    for (uint32_t i = 0; i < 256; i++) {
+        rgba.data[i * 4 + 0] = i % 2 ? 0 : i / 2;
+        rgba.data[i * 4 + 1] = i / 4;
+        rgba.data[i * 4 + 2] = 0;
+        rgba.data[i * 4 + 3] = i % 2 ? 255 : 128;
+    }
+
+    PNGOptions options;
+    options.quantize = true;
+    const std::string png = encodePNG(rgba, options);
+
+    // Color type 3 (palette) in the IHDR chunk.
+    EXPECT_EQ(3, png[25]);
+
+    // Images with no more than 256 colors are encoded losslessly.
+    const PremultipliedImage expected = util::premultiply(util::unpremultiply(rgba.clone()));
+    EXPECT_EQ(expected, decodeImage(png));
+}
+
+TEST(Image, PNGQuantizeLossy) {
+    const PremultipliedImage rgba = gradient({ 64, 64 });
+
+    PNGOptions options;
+    options.quantize = true;
+    const PremultipliedImage image = decodeImage(encodePNG(rgba, options));
+
+    ASSERT_EQ(rgba.size, image.size);
+    for (size_t i = 0; i < rgba.bytes(); i++) {
+        ASSERT_NEAR(rgba.data[i], image.data[i], 16) << "at byte " << i;
+    }
+}
+
+TEST(Image, PNGQuantizeEmpty) {
+    const PremultipliedImage rgba({ 0, 0 });
+
+    PNGOptions options;
+    options.quantize = true;
+    const std::string png = encodePNG(rgba, options);
+
+    // An empty image has no palette, so it is encoded as RGBA (color type 6).
+    EXPECT_EQ(6, png[25]);
+}
+
 TEST(Image, PNGReadNoProfile) {
     PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/no_profile.png"));
     EXPECT_EQ(128, image.data[0]);
@@ -66,6 +147,14 @@ TEST(Image, PNGReadProfileAlpha) {
     EXPECT_EQ(128, image.data[3]);
 }
 
+TEST(Image, PNGReadUnassociated) {
+    UnassociatedImage image = decodeUnassociatedImage(util::read_file("test/fixtures/image/no_profile_alpha.png"));
+    EXPECT_EQ(128, image.data[0]);
+    EXPECT_EQ(0, image.data[1]);
+    EXPECT_EQ(0, image.data[2]);
+    EXPECT_EQ(128, image.data[3]);
+}
+
 TEST(Image, PNGTile) {
     PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/tile.png"));
     EXPECT_EQ(256u, image.size.width);
@@ -78,14 +167,51 @@ TEST(Image, JPEGTile) {
     EXPECT_EQ(256u, image.size.height);
 }
 
+TEST(Image, JPEGTileUnassociated) {
+    const std::string data = util::read_file("test/fixtures/image/tile.jpeg");
+    UnassociatedImage unassociated = decodeUnassociatedImage(data);
+    PremultipliedImage premultiplied = decodeImage(data);
+    ASSERT_EQ(premultiplied.size, unassociated.size);
+    EXPECT_TRUE(std::equal(premultiplied.data.get(), premultiplied.data.get() + premultiplied.bytes(),
+                           unassociated.data.get()));
+}
+
 #if !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
 TEST(Image, WebPTile) {
     PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/tile.webp"));
     EXPECT_EQ(256u, image.size.width);
     EXPECT_EQ(256u, image.size.height);
 }
+
+TEST(Image, WebPRoundTrip) {
+    const PremultipliedImage rgba = decodeImage(util::read_file("test/fixtures/image/tile.png"));
+    const std::string webp = encodeWebP(rgba, 90);
+    EXPECT_EQ("RIFF", webp.substr(0, 4));
+    EXPECT_EQ("WEBP", webp.substr(8, 4));
+
+    const PremultipliedImage image = decodeImage(webp);
+    EXPECT_EQ(rgba.size, image.size);
+}
 #endif // !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
 
+#if !defined(__ANDROID__)
+TEST(Image, JPEGRoundTrip) {
+    const PremultipliedImage rgba = decodeImage(util::read_file("test/fixtures/image/tile.png"));
+    const PremultipliedImage image = decodeImage(encodeJPEG(rgba, 100));
+    ASSERT_EQ(rgba.size, image.size);
+
+    // Lossy, but close to the original at the highest quality.
+    double error = 0;
+    for (size_t i = 0; i < rgba.bytes(); i++) {
+        error += std::abs(rgba.data[i] - image.data[i]);
+    }
+    EXPECT_LT(error / rgba.bytes(), 4);
+
+    // Lower qualities produce smaller images.
+    EXPECT_LT(encodeJPEG(rgba, 50).size(), encodeJPEG(rgba, 90).size());
+}
+#endif // !defined(__ANDROID__)
+
 TEST(Image, Resize) {
     AlphaImage image({0, 0});
 
@@ -163,3 +289,30 @@ TEST(Image, Premultiply) {
     EXPECT_EQ(0u, rgba.size.width);
     EXPECT_EQ(0u, rgba.size.height);
 }
+
+TEST(Image, PremultiplyMixedAlpha) {
+    // Wide enough to cover both vectorized blocks and the remainder, with opaque and
+    // translucent pixels mixed within blocks.
+    UnassociatedImage rgba({ 7, 1 });
+    for (uint8_t i = 0; i < 7; i++) {
+        rgba.data[i * 4 + 0] = 255;
+        rgba.data[i * 4 + 1] = 254;
+        rgba.data[i * 4 + 2] = 253;
+        rgba.data[i * 4 + 3] = i % 2 ? 255 : 128;
+    }
+
+    PremultipliedImage image = util::premultiply(std::move(rgba));
+    for (uint8_t i = 0; i < 7; i++) {
+        if (i % 2) {
+            EXPECT_EQ(255, image.data[i * 4 + 0]);
+            EXPECT_EQ(254, image.data[i * 4 + 1]);
+            EXPECT_EQ(253, image.data[i * 4 + 2]);
+            EXPECT_EQ(255, image.data[i * 4 + 3]);
+        } else {
+            EXPECT_EQ(128, image.data[i * 4 + 0]);
+            EXPECT_EQ(127, image.data[i * 4 + 1]);
+            EXPECT_EQ(127, image.data[i * 4 + 2]);
+            EXPECT_EQ(128, image.data[i * 4 + 3]);
+        }
+    }
+}
@@ -171,3 +171,62 @@ void main() {
     image = view.readStillImage();
     test::checkImage("test/fixtures/offscreen_texture/render-to-fbo-composited", image, 0, 0.1);
 }
+
+TEST(OffscreenTexture, AsynchronousRead) {
+    HeadlessBackend backend { test::sharedDisplay() };
+    BackendScope scope { backend };
+    auto& context = backend.getContext();
+
+    OffscreenView view(context, { 512, 256 });
+    view.bind();
+
+    // Reads are returned in the order they were started, even when the framebuffer has been
+    // drawn to in between.
+    context.clear(Color::red(), {}, {});
+    view.startStillImageRead();
+    context.clear(Color::blue(), {}, {});
+    view.startStillImageRead();
+
+    test::checkImage("test/fixtures/offscreen_texture/empty-red", view.finishStillImageRead(), 0, 0);
+    const PremultipliedImage blue = view.finishStillImageRead();
+    EXPECT_EQ(view.readStillImage(), blue);
+
+    // Pixel buffers are reused for subsequent reads.
+    context.clear(Color::red(), {}, {});
+    view.startStillImageRead();
+    test::checkImage("test/fixtures/offscreen_texture/empty-red", view.finishStillImageRead(), 0, 0);
+
+    EXPECT_THROW(view.finishStillImageRead(), std::runtime_error);
+}
+
+TEST(OffscreenTexture, FlippedYRead) {
+    HeadlessBackend backend { test::sharedDisplay() };
+    BackendScope scope { backend };
+    auto& context = backend.getContext();
+
+    OffscreenView view(context, { 512, 256 });
+    OffscreenView flippedView(context, { 512, 256 }, ViewportMode::FlippedY);
+
+    // Fill the bottom half of the framebuffer with red. Images read from the default view are
+    // flipped so that the first row is the top of the framebuffer; images read from the FlippedY
+    // view are returned as stored.
+    for (auto* target : { &view, &flippedView }) {
+        target->bind();
+        context.clear(Color(), {}, {});
+        MBGL_CHECK_ERROR(glScissor(0, 0, 512, 128));
+        context.scissorTest = true;
+        context.clear(Color::red(), {}, {});
+        context.scissorTest = false;
+    }
+
+    const PremultipliedImage image = view.readStillImage();
+    EXPECT_EQ(0, image.data[0]);
+    EXPECT_EQ(255, image.data[image.bytes() - 4]);
+
+    const PremultipliedImage flipped = flippedView.readStillImage();
+    EXPECT_EQ(255, flipped.data[0]);
+    EXPECT_EQ(0, flipped.data[flipped.bytes() - 4]);
+
+    flippedView.startStillImageRead();
+    EXPECT_EQ(flipped, flippedView.finishStillImageRead());
+}
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 using namespace mbgl;
 
 TEST(TileCover, Empty) {
@@ -42,6 +44,49 @@ TEST(TileCover, Pitch) {
               util::tileCover(transform.getState(), 2));
 }
 
+TEST(TileCover, LODWithoutPitch) {
+    Transform transform;
+    transform.resize({ 512, 512 });
+    transform.setLatLng({ 0.1, -0.1 });
+    transform.setZoom(3);
+
+    // Without pitch, all tiles have the same zoom level.
+    auto expected = util::tileCover(transform.getState(), 3);
+    auto actual = util::tileCoverWithLOD(transform.getState(), 3, 0, 3);
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(TileCover, LODWithPitch) {
+    Transform transform;
+    transform.resize({ 512, 512 });
+    transform.setLatLng({ 37.77, -122.42 });
+    transform.setZoom(10);
+    transform.setPitch(60.0 * M_PI / 180.0);
+
+    const auto cover = util::tileCoverWithLOD(transform.getState(), 10, 5, 10);
+    ASSERT_FALSE(cover.empty());
+
+    // Tiles in the distance have lower zoom levels, so fewer tiles cover the view.
+    EXPECT_LT(cover.size(), util::tileCover(transform.getState(), 10).size());
+    EXPECT_EQ(10, cover.front().canonical.z);
+    EXPECT_TRUE(std::any_of(cover.begin(), cover.end(), [](const auto& id) {
+        return id.canonical.z < 10;
+    }));
+    for (const auto& id : cover) {
+        EXPECT_GE(id.canonical.z, 5);
+        EXPECT_LE(id.canonical.z, 10);
+    }
+
+    // The tiles don't overlap.
+    for (const auto& a : cover) {
+        for (const auto& b : cover) {
+            EXPECT_FALSE(a != b && a.isChildOf(b)) << a << " overlaps " << b;
+        }
+    }
+}
+
 TEST(TileCover, WorldZ1) {
     EXPECT_EQ((std::vector<UnwrappedTileID>{
                   { 1, 0, 0 }, { 1, 0, 1 }, { 1, 1, 0 }, { 1, 1, 1 },